@@ -0,0 +1,147 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Compares a parameter-perturbation ensemble with one deep mechanism copy per member
+//
+//   benchmark_ensemble [<config>] [--members N]
+//
+// Builds --members members (1000 by default) that each change one rate parameter, then reports the time to
+// set the members up and to evaluate the rate constants of all of them, for v1::Ensemble and for a
+// v1::types::Mechanism copy and v1::RateConstants per member, and the largest relative difference.
+
+#include <mechanism_configuration/v1/ensemble.hpp>
+#include <mechanism_configuration/v1/parser.hpp>
+#include <mechanism_configuration/v1/rate_constants.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+  namespace mc = mechanism_configuration;
+
+  int Usage()
+  {
+    std::cerr << "usage: benchmark_ensemble [<config>] [--members N]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  /// @brief Runs f repeatedly for at least a tenth of a second and returns the mean time per call in seconds
+  template<typename Func>
+  double Time(Func&& f)
+  {
+    std::size_t calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed{};
+    do
+    {
+      f();
+      ++calls;
+      elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed.count() < 0.1);
+    return elapsed.count() / static_cast<double>(calls);
+  }
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  std::string config = DEFAULT_CONFIGURATION;
+  std::size_t members = 1000;
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+    if (arg == "--members" && i + 1 < argc)
+      members = std::stoul(argv[++i]);
+    else if (arg.starts_with("--"))
+      return Usage();
+    else
+      config = arg;
+  }
+
+  auto parsed = mc::v1::Parser().Parse(config);
+  if (!parsed)
+  {
+    for (const auto& error : parsed.errors)
+    {
+      std::cerr << error.to_string() << std::endl;
+    }
+    return EXIT_FAILURE;
+  }
+  auto mechanism = std::make_shared<const mc::v1::types::Mechanism>(std::move(*parsed.mechanism));
+
+  mc::v1::Ensemble ensemble(mechanism);
+  if (ensemble.NumberOfParameters() == 0)
+  {
+    std::cerr << "The mechanism has no rate parameters" << std::endl;
+    return EXIT_FAILURE;
+  }
+  // Member m scales parameter m % NumberOfParameters() by 1.1
+  auto perturb = [&](mc::v1::Ensemble& e)
+  {
+    for (std::size_t m = 0; m < members; ++m)
+    {
+      const std::size_t member = e.AddMember();
+      const std::size_t parameter = m % e.NumberOfParameters();
+      e.Set(member, parameter, 1.1 * e.Parameters()[parameter].value);
+    }
+  };
+  perturb(ensemble);
+
+  std::vector<double> external(ensemble.NumberOfExternalRates(), 1.0e-3);
+  mc::v1::Conditions conditions{ 272.5, 101253.3, 42.2 };
+  std::vector<double> k(ensemble.Size() * members);
+  std::vector<double> copies_k(k.size());
+  std::vector<double> member_k(ensemble.Size());
+
+  double ensemble_setup = Time(
+      [&]
+      {
+        mc::v1::Ensemble e(mechanism);
+        perturb(e);
+      });
+  double copies_setup = Time(
+      [&]
+      {
+        for (std::size_t m = 0; m < members; ++m)
+        {
+          mc::v1::RateConstants rates(ensemble.Materialize(m));
+        }
+      });
+  double ensemble_seconds = Time([&] { ensemble.Calculate(conditions, external, k); });
+  std::vector<mc::v1::RateConstants> copies;
+  for (std::size_t m = 0; m < members; ++m)
+  {
+    copies.emplace_back(ensemble.Materialize(m));
+  }
+  double copies_seconds = Time(
+      [&]
+      {
+        for (std::size_t m = 0; m < members; ++m)
+        {
+          copies[m].Calculate(conditions, external, member_k);
+          for (std::size_t i = 0; i < member_k.size(); ++i)
+            copies_k[i * members + m] = member_k[i];
+        }
+      });
+
+  double difference = 0.0;
+  for (std::size_t i = 0; i < k.size(); ++i)
+  {
+    if (copies_k[i] != 0.0)
+      difference = std::max(difference, std::abs(k[i] - copies_k[i]) / std::abs(copies_k[i]));
+  }
+  std::cout << members << " members, " << ensemble.Size() << " rate constants, " << ensemble.NumberOfParameters() << " parameters\n";
+  std::cout << std::setw(12) << "" << std::setw(16) << "setup us" << std::setw(16) << "evaluate us" << "\n";
+  std::cout << std::setw(12) << "ensemble" << std::setw(16) << 1.0e6 * ensemble_setup << std::setw(16) << 1.0e6 * ensemble_seconds << "\n";
+  std::cout << std::setw(12) << "copies" << std::setw(16) << 1.0e6 * copies_setup << std::setw(16) << 1.0e6 * copies_seconds << "\n";
+  std::cout << "max rel diff " << difference << "\n";
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,106 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Compares the batched species-tendency kernel with its scalar reference
+//
+//   benchmark_forcing [<config>] [--max-cells N]
+//
+// For 10^3 cells up to --max-cells (10^6 by default), in powers of ten, reports the time per cell of
+// v1::Forcing and of v1::ReferenceForcing and the largest relative difference between them.
+
+#include <mechanism_configuration/v1/forcing.hpp>
+#include <mechanism_configuration/v1/parser.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  namespace mc = mechanism_configuration;
+
+  int Usage()
+  {
+    std::cerr << "usage: benchmark_forcing [<config>] [--max-cells N]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  /// @brief Runs f repeatedly for at least a tenth of a second and returns the mean time per call in seconds
+  template<typename Func>
+  double Time(Func&& f)
+  {
+    std::size_t calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::duration<double> elapsed{};
+    do
+    {
+      f();
+      ++calls;
+      elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed.count() < 0.1);
+    return elapsed.count() / static_cast<double>(calls);
+  }
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  std::string config = DEFAULT_CONFIGURATION;
+  std::size_t max_cells = 1000000;
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+    if (arg == "--max-cells" && i + 1 < argc)
+      max_cells = std::stoul(argv[++i]);
+    else if (arg.starts_with("--"))
+      return Usage();
+    else
+      config = arg;
+  }
+
+  auto parsed = mc::v1::Parser().Parse(config);
+  if (!parsed)
+  {
+    for (const auto& error : parsed.errors)
+    {
+      std::cerr << error.to_string() << std::endl;
+    }
+    return EXIT_FAILURE;
+  }
+  const auto& mechanism = *parsed.mechanism;
+  mc::v1::Forcing forcing(mechanism);
+  std::cout << forcing.NumberOfSpecies() << " species, " << forcing.NumberOfProcesses() << " processes\n";
+  std::cout << std::setw(10) << "cells" << std::setw(18) << "batched ns/cell" << std::setw(20) << "reference ns/cell" << std::setw(10) << "speedup"
+            << std::setw(16) << "max rel diff" << "\n";
+
+  for (std::size_t cells = 1000; cells <= max_cells; cells *= 10)
+  {
+    std::vector<double> k(forcing.NumberOfProcesses() * cells);
+    std::vector<double> y(forcing.NumberOfSpecies() * cells);
+    for (std::size_t i = 0; i < k.size(); ++i)
+      k[i] = 1.0e-3 * (1.0 + static_cast<double>(i % 101) / 101.0);
+    for (std::size_t i = 0; i < y.size(); ++i)
+      y[i] = 1.0 + static_cast<double>(i % 53) / 53.0;
+    std::vector<double> batched(y.size());
+    std::vector<double> reference(y.size());
+
+    double batched_seconds = Time([&] { forcing.Calculate(k, y, batched, cells); });
+    double reference_seconds = Time([&] { mc::v1::ReferenceForcing(mechanism, k, y, reference, cells); });
+
+    double difference = 0.0;
+    for (std::size_t i = 0; i < batched.size(); ++i)
+    {
+      if (reference[i] != 0.0)
+        difference = std::max(difference, std::abs(batched[i] - reference[i]) / std::abs(reference[i]));
+    }
+    std::cout << std::setw(10) << cells << std::setw(18) << 1.0e9 * batched_seconds / cells << std::setw(20)
+              << 1.0e9 * reference_seconds / cells << std::setw(10) << reference_seconds / batched_seconds << std::setw(16) << difference
+              << "\n";
+  }
+  return EXIT_SUCCESS;
+}
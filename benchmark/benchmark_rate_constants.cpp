@@ -0,0 +1,138 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Compares the generic rate constant path with a rate kernel specialized to the same mechanism
+//
+//   benchmark_rate_constants [<config> <rate kernel library>] [--iterations N]
+//
+// Both paths evaluate the rate constants over a sweep of temperatures and pressures. The report gives the time
+// per evaluation of all rate constants and the largest relative difference between the two paths.
+
+#include <mechanism_configuration/constants.hpp>
+#include <mechanism_configuration/v1/parser.hpp>
+#include <mechanism_configuration/v1/rate_constants.hpp>
+#include <mechanism_configuration/v1/rate_kernel.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  namespace mc = mechanism_configuration;
+
+  int Usage()
+  {
+    std::cerr << "usage: benchmark_rate_constants [<config> <rate kernel library>] [--iterations N]" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<mc::v1::Conditions> Sweep()
+  {
+    std::vector<mc::v1::Conditions> sweep;
+    for (int i = 0; i < 64; ++i)
+    {
+      double temperature = 200.0 + 2.0 * i;
+      double pressure = 2.0e4 + 1.25e3 * i;
+      sweep.push_back({ temperature, pressure, pressure / (mc::constants::R * temperature) });
+    }
+    return sweep;
+  }
+
+  /// @brief Times iterations passes over the sweep and returns nanoseconds per evaluation, summing the results
+  ///        into checksum so the work cannot be optimized away
+  template<typename Rates>
+  double Time(const Rates& rates, const std::vector<mc::v1::Conditions>& sweep, std::size_t iterations, double& checksum)
+  {
+    std::vector<double> external(rates.NumberOfExternalRates(), 1.0e-3);
+    std::vector<double> k(rates.Size());
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t iteration = 0; iteration < iterations; ++iteration)
+    {
+      for (const auto& conditions : sweep)
+      {
+        rates.Calculate(conditions, external, k);
+        checksum += k.empty() ? 0.0 : k[iteration % k.size()];
+      }
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return elapsed / static_cast<double>(iterations * sweep.size());
+  }
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  std::string config = DEFAULT_CONFIGURATION;
+  std::string library = DEFAULT_RATE_KERNEL;
+  std::size_t iterations = 20000;
+  std::vector<std::string> positional;
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+    if (arg == "--iterations" && i + 1 < argc)
+      iterations = std::stoul(argv[++i]);
+    else if (arg.starts_with("--"))
+      return Usage();
+    else
+      positional.push_back(arg);
+  }
+  if (positional.size() == 2)
+  {
+    config = positional[0];
+    library = positional[1];
+  }
+  else if (!positional.empty())
+  {
+    return Usage();
+  }
+
+  auto parsed = mc::v1::Parser().Parse(config);
+  if (!parsed)
+  {
+    for (const auto& error : parsed.errors)
+    {
+      std::cerr << error.to_string() << std::endl;
+    }
+    return EXIT_FAILURE;
+  }
+  mc::v1::RateConstants generic(*parsed.mechanism);
+  mc::v1::RateKernelPlugin kernel(library);
+  if (kernel.Size() != generic.Size() || kernel.NumberOfExternalRates() != generic.NumberOfExternalRates())
+  {
+    std::cerr << library << " was not generated from " << config << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  auto sweep = Sweep();
+  double checksum = 0.0;
+  double generic_ns = Time(generic, sweep, iterations, checksum);
+  double kernel_ns = Time(kernel, sweep, iterations, checksum);
+
+  double difference = 0.0;
+  std::vector<double> external(generic.NumberOfExternalRates(), 1.0e-3);
+  std::vector<double> expected(generic.Size());
+  std::vector<double> actual(kernel.Size());
+  for (const auto& conditions : sweep)
+  {
+    generic.Calculate(conditions, external, expected);
+    kernel.Calculate(conditions, external, actual);
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+      if (expected[i] != 0.0)
+        difference = std::max(difference, std::abs(actual[i] - expected[i]) / std::abs(expected[i]));
+    }
+  }
+
+  std::cout << "rate constants:           " << generic.Size() << "\n";
+  std::cout << "generic path:             " << generic_ns << " ns per evaluation\n";
+  std::cout << "specialized kernel:       " << kernel_ns << " ns per evaluation\n";
+  std::cout << "speedup:                  " << generic_ns / kernel_ns << "x\n";
+  std::cout << "max relative difference:  " << difference << "\n";
+  std::cout << "(checksum " << checksum << ")" << std::endl;
+  return EXIT_SUCCESS;
+}
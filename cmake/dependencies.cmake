@@ -11,6 +11,11 @@ function(set_git_default git_var git_val)
 
 endfunction(set_git_default)
 
+################################################################################
+# threads
+
+find_package(Threads REQUIRED)
+
 ################################################################################
 # google test
 
@@ -0,0 +1,70 @@
+################################################################################
+# Embed a mechanism configuration in a target
+#
+#   mechanism_configuration_embed(<target> <config> [NAMESPACE <name>] [HEADER <file name>] [ALLOW_APPROXIMATE])
+#
+# Runs mechanism_embed on the configuration at build time and makes the header it writes available to the
+# target, as <config name>_mechanism.hpp unless HEADER is given. The header declares the mechanism's tables
+# and a Mechanism() function in the namespace given by NAMESPACE, embedded_mechanism by default. It is
+# regenerated whenever the configuration changes. The target gets the include directories of the library and
+# of yaml-cpp, whose headers the mechanism types include, but is linked to neither, so it does not depend on
+# yaml-cpp at run time. A version 0 configuration whose conversion changes the rate of any reaction fails the
+# build unless ALLOW_APPROXIMATE is given.
+
+function(mechanism_configuration_embed target config)
+  set(prefix EMBED)
+  set(optionalValues ALLOW_APPROXIMATE)
+  set(singleValues NAMESPACE HEADER)
+  set(multiValues)
+
+  include(CMakeParseArguments)
+  cmake_parse_arguments(${prefix} "${optionalValues}" "${singleValues}" "${multiValues}" ${ARGN})
+
+  if(TARGET mechanism_embed)
+    set(embed_tool mechanism_embed)
+  elseif(TARGET open_atmos::mechanism_embed)
+    set(embed_tool open_atmos::mechanism_embed)
+  else()
+    message(FATAL_ERROR "mechanism_configuration_embed needs the mechanism_embed tool (OPEN_ATMOS_ENABLE_TOOLS)")
+  endif()
+
+  if(TARGET mechanism_configuration)
+    set(library mechanism_configuration)
+  else()
+    set(library open_atmos::mechanism_configuration)
+  endif()
+
+  get_filename_component(config_path "${config}" ABSOLUTE)
+  if(NOT EMBED_HEADER)
+    get_filename_component(config_name "${config}" NAME_WE)
+    set(EMBED_HEADER "${config_name}_mechanism.hpp")
+  endif()
+  if(NOT EMBED_NAMESPACE)
+    set(EMBED_NAMESPACE embedded_mechanism)
+  endif()
+
+  set(output_dir "${CMAKE_CURRENT_BINARY_DIR}/${target}_embedded")
+  set(header "${output_dir}/${EMBED_HEADER}")
+  set(embed_options --namespace ${EMBED_NAMESPACE})
+  if(EMBED_ALLOW_APPROXIMATE)
+    list(APPEND embed_options --allow-approximate)
+  endif()
+
+  add_custom_command(
+    OUTPUT ${header}
+    COMMAND ${embed_tool} ${embed_options} ${config_path} ${header}
+    DEPENDS ${embed_tool} ${config_path}
+    COMMENT "Embedding mechanism ${config}"
+    VERBATIM)
+
+  target_sources(${target} PRIVATE ${header})
+  target_compile_features(${target} PRIVATE cxx_std_20)
+  target_include_directories(${target}
+    PRIVATE
+      ${output_dir}
+      $<TARGET_PROPERTY:${library},INTERFACE_INCLUDE_DIRECTORIES>
+  )
+  if(TARGET yaml-cpp::yaml-cpp)
+    target_include_directories(${target} PRIVATE $<TARGET_PROPERTY:yaml-cpp::yaml-cpp,INTERFACE_INCLUDE_DIRECTORIES>)
+  endif()
+endfunction(mechanism_configuration_embed)
@@ -0,0 +1,49 @@
+################################################################################
+# Build a rate kernel specialized to a mechanism configuration
+#
+#   mechanism_configuration_rate_kernel(<target> <config> [ALLOW_APPROXIMATE])
+#
+# Runs mechanism_rate_kernel on the configuration at build time and compiles the source it writes into a
+# plugin library named <target>, to be loaded with v1::RateKernelPlugin from $<TARGET_FILE:<target>>. The
+# kernel is regenerated whenever the configuration changes and depends only on the standard library. A
+# version 0 configuration whose conversion changes the rate of any reaction fails the build unless
+# ALLOW_APPROXIMATE is given.
+
+function(mechanism_configuration_rate_kernel target config)
+  set(prefix RATE_KERNEL)
+  set(optionalValues ALLOW_APPROXIMATE)
+  set(singleValues)
+  set(multiValues)
+
+  include(CMakeParseArguments)
+  cmake_parse_arguments(${prefix} "${optionalValues}" "${singleValues}" "${multiValues}" ${ARGN})
+
+  if(TARGET mechanism_rate_kernel)
+    set(generator mechanism_rate_kernel)
+  elseif(TARGET open_atmos::mechanism_rate_kernel)
+    set(generator open_atmos::mechanism_rate_kernel)
+  else()
+    message(FATAL_ERROR "mechanism_configuration_rate_kernel needs the mechanism_rate_kernel tool (OPEN_ATMOS_ENABLE_TOOLS)")
+  endif()
+
+  get_filename_component(config_path "${config}" ABSOLUTE)
+  set(source "${CMAKE_CURRENT_BINARY_DIR}/${target}.cpp")
+  set(generator_options)
+  if(RATE_KERNEL_ALLOW_APPROXIMATE)
+    list(APPEND generator_options --allow-approximate)
+  endif()
+
+  add_custom_command(
+    OUTPUT ${source}
+    COMMAND ${generator} ${generator_options} ${config_path} ${source}
+    DEPENDS ${generator} ${config_path}
+    COMMENT "Generating rate kernel for ${config}"
+    VERBATIM)
+
+  add_library(${target} MODULE ${source})
+  target_compile_features(${target} PRIVATE cxx_std_17)
+  set_target_properties(${target} PROPERTIES
+    PREFIX ""
+    CXX_VISIBILITY_PRESET hidden
+  )
+endfunction(mechanism_configuration_rate_kernel)
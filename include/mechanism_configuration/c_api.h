@@ -0,0 +1,126 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// A C interface to parsed v1 mechanisms, for hosts written in C or Fortran.
+//
+// Every function is safe to call with a handle returned by mc_parse, including one for a file that failed to
+// parse, which has no species or reactions, and with NULL, which behaves as a handle with no errors, species or
+// reactions that is not valid. No function lets a C++ exception escape. Bulk data is copied into caller-owned buffers in a single call.
+// Indices are 0-based. Multi-column parameters are written one reaction at a time, so a Fortran caller
+// receives them as an array of shape (columns, reactions).
+#pragma once
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+  /// @brief Reaction types, numbered as mechanism_configuration::v1::types::ReactionType
+  typedef enum
+  {
+    MC_ARRHENIUS = 0,
+    MC_BRANCHED = 1,
+    MC_CONDENSED_PHASE_ARRHENIUS = 2,
+    MC_CONDENSED_PHASE_PHOTOLYSIS = 3,
+    MC_EMISSION = 4,
+    MC_FIRST_ORDER_LOSS = 5,
+    MC_SIMPOL_PHASE_TRANSFER = 6,
+    MC_AQUEOUS_EQUILIBRIUM = 7,
+    MC_WET_DEPOSITION = 8,
+    MC_HENRYS_LAW = 9,
+    MC_PHOTOLYSIS = 10,
+    MC_SURFACE = 11,
+    MC_TROE = 12,
+    MC_TUNNELING = 13,
+    MC_NUM_REACTION_TYPES = 14
+  } mc_reaction_type;
+
+  typedef struct mc_mechanism mc_mechanism;
+
+  /// @brief Parses a v1 configuration file. Free the result with mc_free.
+  ///
+  /// Problems with the file, and any failure while parsing it, are reported as errors of the returned handle.
+  /// Returns NULL only if the handle itself cannot be allocated.
+  mc_mechanism* mc_parse(const char* path);
+
+  void mc_free(mc_mechanism* mechanism);
+
+  /// @brief Returns 1 if the configuration parsed without errors, 0 otherwise
+  int mc_is_valid(const mc_mechanism* mechanism);
+
+  size_t mc_num_errors(const mc_mechanism* mechanism);
+
+  /// @brief The ConfigParseStatus of an error, as an integer, or -1 if error is out of range
+  int mc_error_status(const mc_mechanism* mechanism, size_t error);
+
+  /// @brief A formatted message for an error, owned by the mechanism, or NULL if error is out of range
+  const char* mc_error_message(const mc_mechanism* mechanism, size_t error);
+
+  size_t mc_num_species(const mc_mechanism* mechanism);
+
+  size_t mc_num_phases(const mc_mechanism* mechanism);
+
+  /// @brief The name of a species, owned by the mechanism, or NULL if species is out of range
+  const char* mc_species_name(const mc_mechanism* mechanism, size_t species);
+
+  /// @brief The length of the longest species name
+  size_t mc_max_species_name_length(const mc_mechanism* mechanism);
+
+  /// @brief Writes every species name into names as a fixed-width, blank-padded field of name_length characters,
+  ///        without terminators. Longer names are truncated.
+  void mc_get_species_names(const mc_mechanism* mechanism, char* names, size_t name_length);
+
+  size_t mc_num_reactions(const mc_mechanism* mechanism, mc_reaction_type type);
+
+  /// @brief The number of parameters mc_get_reaction_params writes per reaction of a type
+  ///
+  /// Arrhenius and condensed-phase Arrhenius: A, B, C, D, E. Branched: X, Y, a0, n. Troe: k0_A, k0_B, k0_C,
+  /// kinf_A, kinf_B, kinf_C, Fc, N. Tunneling: A, B, C. SIMPOL: B[0..3]. Aqueous equilibrium: A, C, k_reverse.
+  /// Surface: reaction probability. Photolysis, emission, first-order loss and wet deposition: scaling factor.
+  /// Henry's law: none.
+  size_t mc_num_reaction_params(mc_reaction_type type);
+
+  /// @brief Writes mc_num_reaction_params(type) values per reaction into params
+  void mc_get_reaction_params(const mc_mechanism* mechanism, mc_reaction_type type, double* params);
+
+  /// @brief Writes A, B, C, D, E for every Arrhenius reaction into params
+  void mc_get_arrhenius_params(const mc_mechanism* mechanism, double* params);
+
+  /// @brief The total number of reactant entries over all reactions of a type
+  size_t mc_num_reactant_entries(const mc_mechanism* mechanism, mc_reaction_type type);
+
+  /// @brief The total number of product entries over all reactions of a type
+  size_t mc_num_product_entries(const mc_mechanism* mechanism, mc_reaction_type type);
+
+  /// @brief Writes the reactants of every reaction of a type in compressed sparse row form
+  ///
+  /// offsets receives mc_num_reactions(type) + 1 values; the reactants of reaction r are entries
+  /// offsets[r] to offsets[r + 1] - 1 of species and coefficients. species holds species indices, or SIZE_MAX for
+  /// a species the mechanism does not define, which a valid mechanism never has.
+  void mc_get_reactants(const mc_mechanism* mechanism, mc_reaction_type type, size_t* offsets, size_t* species, double* coefficients);
+
+  /// @brief Writes the products of every reaction of a type, laid out as in mc_get_reactants
+  void mc_get_products(const mc_mechanism* mechanism, mc_reaction_type type, size_t* offsets, size_t* species, double* coefficients);
+
+  /// @brief The number of rates the host supplies at run time, for photolysis, condensed-phase photolysis,
+  ///        emission, first-order loss and wet deposition reactions
+  ///
+  /// Rate i is the rate of the i-th such reaction, walking the types in reaction type order. A host keeps these
+  /// rates in an array of mc_num_external_rates rows, with the cells of each row contiguous, and looks each key up
+  /// once with mc_find_external_rate.
+  size_t mc_num_external_rates(const mc_mechanism* mechanism);
+
+  /// @brief The unique key of an external rate, owned by the mechanism: the reaction name prefixed by PHOTO.,
+  ///        CONDENSED_PHOTO., EMIS., LOSS. or WET_DEP., with a suffix #2, #3, ... for repeated names. NULL if
+  ///        parameter is out of range.
+  const char* mc_external_rate_key(const mc_mechanism* mechanism, size_t parameter);
+
+  /// @brief Writes the index of the external rate with a key to parameter. Returns 1 if there is one, 0 otherwise.
+  int mc_find_external_rate(const mc_mechanism* mechanism, const char* key, size_t* parameter);
+
+#ifdef __cplusplus
+}
+#endif
@@ -6,12 +6,56 @@
 
 #include <yaml-cpp/yaml.h>
 
+#include <filesystem>
 #include <mechanism_configuration/parse_status.hpp>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 namespace mechanism_configuration
 {
-  using Errors = std::vector<std::pair<ConfigParseStatus, std::string>>;
-}  // namespace mechanism_configuration
\ No newline at end of file
+  /// @brief A single problem found while parsing a configuration
+  ///
+  /// The record holds the raw location and context of the problem. The human-readable message is only built
+  /// when to_string() is called, so collecting errors does no string formatting.
+  struct ParseError
+  {
+    ConfigParseStatus status{ ConfigParseStatus::None };
+    /// @brief The file the error was found in, shared by every error from that file. Null if not yet known.
+    std::shared_ptr<const std::filesystem::path> file;
+    /// @brief 1-based line number, 0 if unknown
+    int line{ 0 };
+    /// @brief 1-based column number, 0 if unknown
+    int column{ 0 };
+    /// @brief The configuration key the error refers to, if any
+    std::string key;
+    /// @brief Additional context, such as the offending value
+    std::string detail;
+
+    ParseError() = default;
+
+    ParseError(ConfigParseStatus status, std::string detail = {})
+        : status(status),
+          detail(std::move(detail))
+    {
+    }
+
+    ParseError(ConfigParseStatus status, const YAML::Mark& mark, std::string key = {}, std::string detail = {})
+        : status(status),
+          line(mark.line + 1),
+          column(mark.column + 1),
+          key(std::move(key)),
+          detail(std::move(detail))
+    {
+    }
+
+    /// @brief Formats the error as "file:line:column: error: description: detail [key]"
+    std::string to_string() const;
+  };
+
+  using Errors = std::vector<ParseError>;
+
+  /// @brief Records the file every error was found in
+  void SetErrorFile(Errors& errors, const std::filesystem::path& file);
+}  // namespace mechanism_configuration
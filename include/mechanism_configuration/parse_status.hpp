@@ -28,8 +28,14 @@ namespace mechanism_configuration
     RequestedAerosolSpeciesNotIncludedInAerosolPhase,
     TooManyReactionComponents,
     InvalidIonPair,
-    UnknownType
+    UnknownType,
+    DuplicateReactionDetected,
+    UnhandledException
   };
 
+  /// @brief The name of a status, as it is spelled in ConfigParseStatus
   std::string configParseStatusToString(const ConfigParseStatus &status);
+
+  /// @brief A short human-readable description of a status, as used in ParseError::to_string
+  std::string configParseStatusDescription(const ConfigParseStatus &status);
 }  // namespace mechanism_configuration
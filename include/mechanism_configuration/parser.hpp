@@ -1,14 +1,76 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
+#include <future>
 #include <mechanism_configuration/parser_result.hpp>
 #include <mechanism_configuration/v0/parser.hpp>
 #include <mechanism_configuration/v1/parser.hpp>
 #include <memory>
+#include <span>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace mechanism_configuration
 {
+  /// @brief Parses many configurations concurrently, with one ParserT per worker thread
+  /// @param config_paths The configurations to parse
+  /// @param max_concurrency The maximum number of parses in flight at once, which bounds peak memory use.
+  ///        A value of 0 uses the number of hardware threads.
+  /// @return One result per configuration, in the same order as config_paths. An exception thrown while parsing
+  ///         a configuration is reported in its result as a ConfigParseStatus::UnhandledException error.
+  template<typename ParserT>
+  auto ParseConcurrently(std::span<const std::filesystem::path> config_paths, std::size_t max_concurrency = 0)
+  {
+    using Result = decltype(std::declval<ParserT&>().Parse(std::declval<const std::filesystem::path&>()));
+    std::vector<Result> results(config_paths.size());
+    if (config_paths.empty())
+    {
+      return results;
+    }
+
+    if (max_concurrency == 0)
+    {
+      max_concurrency = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+    std::size_t n_workers = std::min(max_concurrency, config_paths.size());
+
+    // each worker claims the next unparsed configuration, so a slow file never holds up the others
+    std::atomic<std::size_t> next{ 0 };
+    auto work = [&]()
+    {
+      ParserT parser;
+      for (std::size_t i = next++; i < config_paths.size(); i = next++)
+      {
+        try
+        {
+          results[i] = parser.Parse(config_paths[i]);
+        }
+        catch (const std::exception& e)
+        {
+          results[i].errors.push_back({ ConfigParseStatus::UnhandledException, e.what() });
+          SetErrorFile(results[i].errors, config_paths[i]);
+        }
+      }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(n_workers - 1);
+    for (std::size_t i = 1; i < n_workers; ++i)
+    {
+      workers.emplace_back(work);
+    }
+    work();
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+
+    return results;
+  }
+
   class UniversalParser
   {
    public:
@@ -17,7 +79,8 @@ namespace mechanism_configuration
       ParserResult<GlobalMechanism> result;
       if (!std::filesystem::exists(config_path))
       {
-        result.errors.push_back({ ConfigParseStatus::FileNotFound, "File not found" });
+        result.errors.push_back({ ConfigParseStatus::FileNotFound });
+        SetErrorFile(result.errors, config_path);
         return result;
       }
 
@@ -43,5 +106,24 @@ namespace mechanism_configuration
       result.errors.insert(result.errors.end(), v0_result.errors.begin(), v0_result.errors.end());
       return result;
     }
+
+    /// @brief Parses many configurations concurrently
+    /// @param config_paths The configurations to parse
+    /// @param max_concurrency The maximum number of parses in flight at once, which bounds peak memory use.
+    ///        A value of 0 uses the number of hardware threads.
+    /// @return One result per configuration, in the same order as config_paths. An exception thrown while parsing
+  ///         a configuration is reported in its result as a ConfigParseStatus::UnhandledException error.
+    std::vector<ParserResult<GlobalMechanism>> ParseMany(std::span<const std::filesystem::path> config_paths, std::size_t max_concurrency = 0)
+    {
+      return ParseConcurrently<UniversalParser>(config_paths, max_concurrency);
+    }
+
+    /// @brief Parses a configuration on a background thread
+    /// @param config_path The configuration to parse
+    /// @return A future holding the parse result. Exceptions thrown while parsing are rethrown by get().
+    std::future<ParserResult<GlobalMechanism>> ParseAsync(const std::filesystem::path& config_path)
+    {
+      return std::async(std::launch::async, [config_path]() { return UniversalParser{}.Parse(config_path); });
+    }
   };
 }  // namespace mechanism_configuration
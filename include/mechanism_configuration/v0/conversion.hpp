@@ -0,0 +1,53 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/v0/types.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+#include <string>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v0
+  {
+    /// @brief The unknown property that records the v0 type of a reaction with no exact v1 counterpart
+    const std::string V0_TYPE_PROPERTY = "__v0 type";
+
+    /// @brief A reaction whose version 1 rate differs from its version 0 rate
+    struct ConversionWarning
+    {
+      /// @brief The version 0 type of the reaction
+      std::string type;
+      /// @brief The reaction's name, or its equation if it has none
+      std::string reaction;
+      /// @brief How the version 1 rate differs
+      std::string detail;
+
+      /// @brief Formats the warning as "warning: type reaction: detail"
+      std::string to_string() const;
+    };
+
+    /// @brief Converts a version 0 mechanism to version 1
+    ///
+    /// All species are placed in the gas phase, named GAS as in version 0. The MUSICA name prefixes of
+    /// version 0 (PHOTO., EMIS., LOSS., SURF. and USER.) select the version 1 reaction type and are removed from
+    /// the reaction names. Each surface reaction refers to an aerosol phase, without species, named after the
+    /// reaction. Two version 0 types have no exact version 1 counterpart, so their version 0 type is kept
+    /// in the V0_TYPE_PROPERTY unknown property:
+    ///   - TERNARY_CHEMICAL_ACTIVATION becomes TROE, whose rate differs by a factor of [M]
+    ///   - USER_DEFINED becomes PHOTOLYSIS, which also takes its rate from the host model, or ARRHENIUS with the
+    ///     scaling factor as its pre-exponential factor when there is more than one reactant
+    /// The relative tolerance has no version 1 counterpart and is dropped.
+    /// @param warnings Receives one warning for every reaction whose version 1 rate differs from its version 0
+    ///        rate: each ternary chemical activation reaction, and each user-defined reaction that becomes
+    ///        ARRHENIUS, whose rate the host model no longer supplies
+    v1::types::Mechanism ConvertToV1(const types::Mechanism& mechanism, std::vector<ConversionWarning>& warnings);
+
+    /// @brief Converts a version 0 mechanism to version 1, discarding the warnings. Prefer the overload with
+    ///        warnings wherever they can be shown to a user.
+    v1::types::Mechanism ConvertToV1(const types::Mechanism& mechanism);
+  }  // namespace v0
+}  // namespace mechanism_configuration
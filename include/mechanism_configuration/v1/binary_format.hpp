@@ -0,0 +1,28 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <mechanism_configuration/v1/types.hpp>
+#include <span>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief Writes a mechanism to a compact binary form
+    ///
+    /// The form holds every field of the mechanism, including unknown properties, so that ReadBinary returns an
+    /// identical mechanism. It starts with a magic number and a format version. Numbers are stored in the byte order
+    /// of the writing machine, and reading on a machine with another byte order is rejected. The form is meant for
+    /// moving parsed mechanisms between processes, not for long-term storage.
+    std::vector<std::byte> WriteBinary(const types::Mechanism& mechanism);
+
+    /// @brief Reads a mechanism written by WriteBinary
+    /// @throws std::invalid_argument if the data is truncated, corrupt, or from an incompatible writer
+    types::Mechanism ReadBinary(std::span<const std::byte> data);
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,209 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <yaml-cpp/yaml.h>
+
+#include <mechanism_configuration/errors.hpp>
+#include <mechanism_configuration/v1/key_binding.hpp>
+#include <mechanism_configuration/v1/phase_index.hpp>
+#include <mechanism_configuration/v1/reaction_descriptors.hpp>
+#include <mechanism_configuration/v1/utils.hpp>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    namespace descriptors
+    {
+      /// @brief The key table of a reaction type: its type key, name and the keys of its fields
+      template<DescribedReaction T>
+      KeyTable MakeKeyTable()
+      {
+        std::vector<std::string> required_keys = { validation::keys.type };
+        std::vector<std::string> optional_keys = { validation::keys.name };
+        ForEachField(
+            ReactionDescriptor<T>::fields,
+            [&](const auto& field)
+            {
+              using Field = std::decay_t<decltype(field)>;
+              bool optional = Field::kind == FieldKind::Option;
+              if constexpr (Field::kind == FieldKind::Number)
+              {
+                optional = field.presence == Presence::Optional;
+              }
+              (optional ? optional_keys : required_keys).push_back(KeyName(field.key));
+            });
+        return KeyTable(required_keys, optional_keys);
+      }
+
+      /// @brief Reads one field of a bound reaction, collecting the species it refers to. The collected names
+      ///        are views of the reaction's own strings.
+      template<typename T, typename Field>
+      void ReadField(const BoundObject& bound, const Field& field, T& reaction, std::vector<std::string_view>& requested_species, Errors& errors)
+      {
+        const std::string& key = KeyName(field.key);
+        if constexpr (Field::kind == FieldKind::Number)
+        {
+          if (bound.Has(key))
+          {
+            using Member = std::remove_reference_t<decltype(reaction.*field.member)>;
+            reaction.*field.member = static_cast<Member>(bound[key].template as<double>());
+          }
+        }
+        else if constexpr (Field::kind == FieldKind::NumberList)
+        {
+          auto& values = reaction.*field.member;
+          const auto& node = bound[key];
+          if (node.IsSequence() && node.size() == values.size())
+          {
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+              values[i] = node[i].template as<double>();
+            }
+          }
+        }
+        else if constexpr (Field::kind == FieldKind::Components)
+        {
+          auto components = ParseReactionComponents(bound[key]);
+          errors.insert(errors.end(), components.first.begin(), components.first.end());
+          reaction.*field.member = std::move(components.second);
+          for (const auto& component : reaction.*field.member)
+          {
+            requested_species.push_back(component.species_name);
+          }
+        }
+        else if constexpr (Field::kind == FieldKind::Species)
+        {
+          std::string& species = SpeciesName(reaction.*field.member);
+          species = bound[key].template as<std::string>();
+          requested_species.push_back(species);
+        }
+        else if constexpr (Field::kind == FieldKind::Phase)
+        {
+          reaction.*field.member = bound[key].template as<std::string>();
+        }
+      }
+
+      /// @brief Checks that a phase field names a known phase that lists the species it must contain
+      template<typename T, typename Field>
+      void CheckPhase(
+          const BoundObject& bound,
+          const PhaseIndex& index,
+          const Field& field,
+          const T& reaction,
+          const std::vector<std::string_view>& requested_species,
+          const YAML::Mark& mark,
+          Errors& errors)
+      {
+        if (field.check == PhaseCheck::Unchecked)
+        {
+          return;
+        }
+        const std::string& key = KeyName(field.key);
+        const std::string& phase = reaction.*field.member;
+        if (!index.HasPhase(phase))
+        {
+          errors.push_back({ ConfigParseStatus::UnknownPhase, bound[key].Mark(), key, phase });
+          return;
+        }
+
+        bool missing = false;
+        if (field.check == PhaseCheck::AllSpecies)
+        {
+          missing = index.PhaseRequiresUnknownSpecies(phase, requested_species);
+        }
+        else if (field.check == PhaseCheck::ListedSpecies)
+        {
+          ForEachField(
+              ReactionDescriptor<T>::fields,
+              [&](const auto& other)
+              {
+                if constexpr (std::decay_t<decltype(other)>::kind == FieldKind::Species)
+                {
+                  if (other.phase == field.key)
+                  {
+                    missing = missing || !index.PhaseHasSpecies(phase, SpeciesName(reaction.*other.member));
+                  }
+                }
+              });
+        }
+        if (missing)
+        {
+          errors.push_back({ ConfigParseStatus::RequestedAerosolSpeciesNotIncludedInAerosolPhase, mark });
+        }
+      }
+
+      /// @brief Reports reactions that list more than one reactant, for types that allow only one
+      inline void CheckSingleReactant(const BoundObject& bound, const std::vector<types::ReactionComponent>& reactants, Errors& errors)
+      {
+        if (reactants.size() > 1)
+        {
+          errors.push_back({ ConfigParseStatus::TooManyReactionComponents, bound[validation::keys.reactants].Mark(), validation::keys.reactants });
+        }
+      }
+    }  // namespace descriptors
+
+    /// @brief Parses one reaction object of type T, as described by ReactionDescriptor<T>, and appends it to
+    ///        reactions
+    ///
+    /// The object is checked in a fixed order: its keys, then its reaction components, then the species it
+    /// refers to, then its phases and the species they must contain, then the type's own Check hook.
+    template<DescribedReaction T>
+    Errors ParseDescribedReaction(const YAML::Node& object, const PhaseIndex& index, std::vector<T>& reactions)
+    {
+      using Descriptor = ReactionDescriptor<T>;
+      static const KeyTable keys = descriptors::MakeKeyTable<T>();
+
+      Errors errors;
+      BoundObject bound(object, keys);
+      const auto& validate = bound.SchemaErrors();
+      errors.insert(errors.end(), validate.begin(), validate.end());
+      if (!validate.empty())
+      {
+        return errors;
+      }
+
+      T reaction;
+      std::vector<std::string_view> requested_species;
+      ForEachField(Descriptor::fields, [&](const auto& field) { descriptors::ReadField(bound, field, reaction, requested_species, errors); });
+      if (bound.Has(validation::keys.name))
+      {
+        reaction.name = bound[validation::keys.name].as<std::string>();
+      }
+      if constexpr (requires { Descriptor::Read(bound, reaction, errors); })
+      {
+        Descriptor::Read(bound, reaction, errors);
+      }
+
+      if (index.RequiresUnknownSpecies(requested_species))
+      {
+        errors.push_back({ ConfigParseStatus::ReactionRequiresUnknownSpecies, object.Mark() });
+      }
+
+      ForEachField(
+          Descriptor::fields,
+          [&](const auto& field)
+          {
+            if constexpr (std::decay_t<decltype(field)>::kind == descriptors::FieldKind::Phase)
+            {
+              descriptors::CheckPhase(bound, index, field, reaction, requested_species, object.Mark(), errors);
+            }
+          });
+      if constexpr (requires { Descriptor::Check(bound, index, reaction, errors); })
+      {
+        Descriptor::Check(bound, index, reaction, errors);
+      }
+
+      reaction.unknown_properties = bound.TakeComments();
+      reactions.push_back(std::move(reaction));
+      return errors;
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,99 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <mechanism_configuration/v1/types.hpp>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    enum class ChangeKind
+    {
+      Added,
+      Removed,
+      Modified
+    };
+
+    struct SpeciesChange
+    {
+      std::string name;
+      ChangeKind kind;
+      /// @brief The configuration keys of the properties that changed, for modified species
+      std::vector<std::string> properties;
+    };
+
+    struct PhaseChange
+    {
+      std::string name;
+      ChangeKind kind;
+      std::vector<std::string> added_species;
+      std::vector<std::string> removed_species;
+      /// @brief Whether the unknown properties of a modified phase changed
+      bool unknown_properties_changed{ false };
+    };
+
+    /// @brief A species whose phases differ between the mechanisms
+    struct SpeciesMove
+    {
+      std::string species;
+      std::vector<std::string> removed_from;
+      std::vector<std::string> added_to;
+    };
+
+    struct ParameterChange
+    {
+      std::string name;
+      double before;
+      double after;
+    };
+
+    struct ReactionChange
+    {
+      ChangeKind kind;
+      types::ReactionType type;
+      /// @brief The reaction's name, or its equation if it has none
+      std::string description;
+      /// @brief The position in the matching list of types::Reactions of the first mechanism, if present there
+      std::optional<std::size_t> before_index;
+      /// @brief The position in the matching list of types::Reactions of the second mechanism, if present there
+      std::optional<std::size_t> after_index;
+      std::vector<ParameterChange> parameters;
+      /// @brief The configuration keys of any other fields that changed, such as "gas phase" or "products"
+      std::vector<std::string> fields;
+    };
+
+    /// @brief The semantic differences between two mechanisms
+    struct MechanismDiff
+    {
+      std::vector<SpeciesChange> species;
+      std::vector<PhaseChange> phases;
+      std::vector<SpeciesMove> moves;
+      std::vector<ReactionChange> reactions;
+
+      bool Empty() const
+      {
+        return species.empty() && phases.empty() && moves.empty() && reactions.empty();
+      }
+    };
+
+    /// @brief Compares two mechanisms independently of formatting and ordering
+    ///
+    /// Species and phases are matched by name. Reactions of the same type are paired with an identical reaction
+    /// if there is one, then by name, and then by their phases and the species they consume and produce,
+    /// ignoring coefficients. Equivalent reactions pair up one to one in the order they appear. A
+    /// matched reaction whose parameters, coefficients or other fields differ is reported as modified. Each
+    /// mechanism is hashed once, so the comparison takes time linear in the size of the mechanisms.
+    MechanismDiff Diff(const types::Mechanism& before, const types::Mechanism& after);
+
+    /// @brief Writes a line-per-change report, marking additions with +, removals with - and modifications with ~
+    void WriteReport(const MechanismDiff& diff, std::ostream& stream);
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,153 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <mechanism_configuration/v1/mechanism_graph.hpp>
+#include <mechanism_configuration/v1/rate_constants.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief A rate parameter that ensemble members may change
+    struct EnsembleParameter
+    {
+      ReactionIndex reaction;
+      /// @brief The configuration key of the parameter, as in ForEachParameter
+      std::string key;
+      /// @brief The value in the shared mechanism
+      double value;
+    };
+
+    /// @brief A member's value for one parameter
+    struct ParameterOverride
+    {
+      std::size_t parameter;
+      double value;
+    };
+
+    /// @brief A set of variants of one mechanism that differ only in their rate parameters
+    ///
+    /// The members share the mechanism, its species, phases, stoichiometry and names, and each member holds only
+    /// the parameters it changes, sorted by parameter. Copying an ensemble shares the mechanism as well.
+    ///
+    /// The parameters are the numeric parameters of every reaction with a rate constant in RateConstantLayout,
+    /// numbered reaction by reaction in layout order and, within a reaction, in ForEachParameter order.
+    /// Calculate evaluates the rate constants of the shared mechanism once, copies them to every member and
+    /// re-evaluates only the reactions a member changes.
+    class Ensemble
+    {
+     public:
+      /// @param number_of_members The number of members to start with, each equal to the mechanism
+      explicit Ensemble(std::shared_ptr<const types::Mechanism> mechanism, std::size_t number_of_members = 0);
+
+      const types::Mechanism& Mechanism() const
+      {
+        return *shared_->mechanism;
+      }
+
+      std::size_t NumberOfMembers() const
+      {
+        return members_.size();
+      }
+
+      /// @brief Adds a member equal to the mechanism and returns its index
+      std::size_t AddMember();
+
+      /// @brief Adds a copy of a member and returns the index of the copy
+      std::size_t CopyMember(std::size_t member);
+
+      std::size_t NumberOfParameters() const
+      {
+        return shared_->parameters.size();
+      }
+
+      const std::vector<EnsembleParameter>& Parameters() const
+      {
+        return shared_->parameters;
+      }
+
+      /// @brief The parameter of a reaction with a configuration key, if there is one
+      std::optional<std::size_t> FindParameter(const ReactionIndex& reaction, std::string_view key) const;
+
+      /// @brief Sets a member's value of a parameter. Setting the shared value removes the override.
+      /// @throws std::invalid_argument if the member or parameter is out of range
+      void Set(std::size_t member, std::size_t parameter, double value);
+
+      /// @brief A member's value of a parameter
+      /// @throws std::invalid_argument if the member or parameter is out of range
+      double Get(std::size_t member, std::size_t parameter) const;
+
+      /// @brief The parameters a member changes, sorted by parameter
+      /// @throws std::invalid_argument if the member is out of range
+      std::span<const ParameterOverride> Overrides(std::size_t member) const
+      {
+        CheckMember(member);
+        return members_[member];
+      }
+
+      /// @brief A complete copy of the mechanism with a member's parameters, for output or for tools that take
+      ///        a mechanism
+      types::Mechanism Materialize(std::size_t member) const;
+
+      /// @brief The number of rate constants per member, as in RateConstants::Size
+      std::size_t Size() const
+      {
+        return shared_->rates.Size();
+      }
+
+      std::size_t NumberOfExternalRates() const
+      {
+        return shared_->rates.NumberOfExternalRates();
+      }
+
+      /// @brief Writes the rate constants of every member to k
+      ///
+      /// k holds one row per rate constant with the members contiguous in each row, so the rate constant i of
+      /// member m is at i * NumberOfMembers() + m, as the cells are in Forcing. All members share the conditions
+      /// and the external rates.
+      /// @param external The externally supplied rates, NumberOfExternalRates() of them
+      /// @param k Rate constants, Size() rows of NumberOfMembers()
+      /// @throws std::invalid_argument if external or k has the wrong size
+      void Calculate(const Conditions& conditions, std::span<const double> external, std::span<double> k) const;
+
+     private:
+      /// @brief A reaction with a rate constant, its first rate constant and its parameters
+      struct Reaction
+      {
+        ReactionIndex reaction;
+        std::size_t slot;
+        std::size_t first_parameter;
+        std::size_t number_of_parameters;
+        std::optional<std::size_t> external;
+      };
+
+      /// @brief The part of an ensemble that does not change between members
+      struct Shared
+      {
+        std::shared_ptr<const types::Mechanism> mechanism;
+        RateConstants rates;
+        std::vector<Reaction> reactions;
+        std::vector<EnsembleParameter> parameters;
+        /// @brief The position in reactions of the reaction each parameter belongs to
+        std::vector<std::size_t> parameter_reactions;
+      };
+
+      void CheckMember(std::size_t member) const;
+      void CheckParameter(std::size_t parameter) const;
+
+      std::shared_ptr<const Shared> shared_;
+      std::vector<std::vector<ParameterOverride>> members_;
+    };
+  }  // namespace v1
+}  // namespace mechanism_configuration
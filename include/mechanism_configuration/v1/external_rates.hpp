@@ -0,0 +1,81 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mechanism_configuration/v1/mechanism_graph.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief A rate the host model supplies at run time
+    struct ExternalRate
+    {
+      /// @brief A unique key for the rate, the reaction name with a prefix for its type (PHOTO., CONDENSED_PHOTO.,
+      ///        EMIS., LOSS. or WET_DEP.). Repeated keys get a suffix #2, #3, ... in order of appearance.
+      std::string key;
+      /// @brief The name of the reaction, which need not be unique
+      std::string name;
+      ReactionIndex reaction;
+      /// @brief The position of the rate constant the rate scales, in RateConstantLayout
+      std::size_t rate_constant;
+    };
+
+    /// @brief Numbers the rates a mechanism needs from its host model, so that they can be set by index
+    ///
+    /// Photolysis, condensed-phase photolysis, emission, first-order loss and wet deposition reactions take a
+    /// rate from the host. Parameter i of the registry is the external rate RateConstantSlot::external == i, so
+    /// the numbering is stable for a given mechanism. Keys are resolved to indices once, at setup; after that the
+    /// host writes each rate straight into its row of the parameter array.
+    ///
+    /// The parameter array holds one row per parameter with the cells contiguous in each row, so that the value
+    /// of parameter i in a cell is at i * number_of_cells + cell, as for the arrays of Forcing and Jacobian.
+    /// Setting a rate for every cell is a copy into Row().
+    class ExternalRateRegistry
+    {
+     public:
+      explicit ExternalRateRegistry(const types::Mechanism& mechanism);
+
+      std::size_t Size() const
+      {
+        return parameters_.size();
+      }
+
+      const ExternalRate& operator[](std::size_t parameter) const
+      {
+        return parameters_[parameter];
+      }
+
+      const std::vector<ExternalRate>& Parameters() const
+      {
+        return parameters_;
+      }
+
+      /// @brief The parameter with a key, if there is one
+      std::optional<std::size_t> Find(std::string_view key) const;
+
+      /// @brief Every parameter whose reaction has a name, in parameter order
+      std::vector<std::size_t> FindByName(std::string_view name) const;
+
+      /// @brief The values of one parameter for every cell
+      /// @param parameters A parameter array of Size() rows of number_of_cells
+      /// @throws std::invalid_argument if parameters has the wrong size or the parameter is out of range
+      std::span<double> Row(std::span<double> parameters, std::size_t parameter, std::size_t number_of_cells) const;
+
+     private:
+      std::vector<ExternalRate> parameters_;
+      std::map<std::string, std::size_t, std::less<>> keys_;
+    };
+  }  // namespace v1
+}  // namespace mechanism_configuration
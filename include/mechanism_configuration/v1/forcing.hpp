@@ -0,0 +1,81 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <mechanism_configuration/v1/mass_action.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+#include <span>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief Computes the mass-action species tendencies f(y) = S (k * prod y^nu) of a mechanism over many cells
+    ///
+    /// There is one process per rate constant, numbered as in RateConstantLayout. Each process consumes its
+    /// reactants and yields its products; branched reactions yield their nitrate products on the nitrate branch
+    /// and their alkoxy products on the alkoxy branch. Wet deposition has no reactants or products here.
+    ///
+    /// Arrays are stored one row per species or rate constant with the cells contiguous in each row, so that
+    /// element (i, cell) is at i * number_of_cells + cell and every inner loop runs across cells. Reactant
+    /// products are computed from precomputed species index lists, with integer coefficients expanded into
+    /// repeated factors, and the tendencies are accumulated one block of cells at a time.
+    class Forcing
+    {
+     public:
+      /// @throws std::invalid_argument if a reaction refers to a species the mechanism does not define
+      explicit Forcing(const types::Mechanism& mechanism);
+
+      /// @brief Builds the kernel from processes already put in mass-action form, which Jacobian can share
+      explicit Forcing(const MassActionProcesses& processes);
+
+      std::size_t NumberOfSpecies() const
+      {
+        return number_of_species_;
+      }
+
+      std::size_t NumberOfProcesses() const
+      {
+        return reactant_offsets_.size() - 1;
+      }
+
+      /// @brief Writes the tendencies of every species in every cell to f, overwriting its contents
+      /// @param k Rate constants, NumberOfProcesses() rows of number_of_cells
+      /// @param y Concentrations, NumberOfSpecies() rows of number_of_cells
+      /// @param f Tendencies, NumberOfSpecies() rows of number_of_cells
+      /// @throws std::invalid_argument if an array has the wrong size
+      void Calculate(std::span<const double> k, std::span<const double> y, std::span<double> f, std::size_t number_of_cells) const;
+
+      /// @brief The number of cells processed together. Blocks are independent, so callers may split the cells
+      ///        between threads at multiples of this size.
+      static constexpr std::size_t block_size = 256;
+
+     private:
+      std::size_t number_of_species_{ 0 };
+      /// @brief Reactants with integer coefficients, repeated once per unit of coefficient, by process
+      std::vector<std::size_t> reactant_offsets_{ 0 };
+      std::vector<std::size_t> reactants_;
+      /// @brief Reactants with fractional coefficients, raised to their coefficient, by process
+      std::vector<std::size_t> fractional_offsets_{ 0 };
+      std::vector<std::size_t> fractional_species_;
+      std::vector<double> fractional_exponents_;
+      /// @brief The net change of each species a process affects, per unit of rate, by process
+      std::vector<std::size_t> term_offsets_{ 0 };
+      std::vector<std::size_t> term_species_;
+      std::vector<double> term_coefficients_;
+    };
+
+    /// @brief A scalar reference for Forcing, which walks the reactions of the mechanism for each cell in turn.
+    ///        It takes the same arrays and is meant for testing.
+    void ReferenceForcing(
+        const types::Mechanism& mechanism,
+        std::span<const double> k,
+        std::span<const double> y,
+        std::span<double> f,
+        std::size_t number_of_cells);
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,64 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <yaml-cpp/yaml.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <mechanism_configuration/parser_result.hpp>
+#include <mechanism_configuration/v1/phase_index.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief A parser that reuses work from its previous parse
+    ///
+    /// Each species, phase and reaction object is identified by the canonical text of its content, so a cached
+    /// result is only reused when the object is equal to the one it was parsed from. Reactions whose content is
+    /// unchanged since the previous call are taken from the previous result instead of being parsed and
+    /// validated again. Any change to the species or phases sections invalidates every cached reaction, since
+    /// reaction validation depends on them. Duplicate reactions are looked for across the whole list on every call,
+    /// as in Parser.
+    class IncrementalParser
+    {
+     public:
+      ParserResult<types::Mechanism> Parse(const std::filesystem::path& config_path);
+      ParserResult<types::Mechanism> Parse(const YAML::Node& object);
+
+      /// @brief Discards all state kept from the previous parse
+      void Reset();
+
+      /// @brief The number of reactions reused from the previous parse during the most recent call
+      std::size_t ReusedReactionCount() const
+      {
+        return reused_reactions_;
+      }
+
+     private:
+      bool has_sections_ = false;
+      std::string species_text_;
+      std::string phases_text_;
+      std::vector<types::Species> species_;
+      std::vector<types::Phase> phases_;
+      PhaseIndex index_;
+      /// @brief Successfully parsed reactions, keyed by the canonical text of their YAML object
+      std::unordered_map<std::string, types::Reactions> reaction_cache_;
+      std::size_t reused_reactions_ = 0;
+    };
+
+    /// @brief Writes a YAML node's structure and content as text. Two nodes have the same text only if they have
+    ///        the same structure and scalars.
+    std::string CanonicalText(const YAML::Node& node);
+
+    /// @brief Appends every reaction in from to the matching list in to
+    void AppendReactions(types::Reactions& to, const types::Reactions& from);
+  }  // namespace v1
+}  // namespace mechanism_configuration
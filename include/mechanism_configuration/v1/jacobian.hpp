@@ -0,0 +1,91 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <mechanism_configuration/v1/forcing.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief Computes the Jacobian df/dy of the mass-action tendencies of Forcing over many cells
+    ///
+    /// The Jacobian is stored in compressed sparse row form with one row per species. An element (i, j) is
+    /// present if some process changes species i and has species j as a reactant, and every diagonal element is
+    /// present so the matrix can be shifted, as in (I - gamma h J). Columns are sorted within each row.
+    ///
+    /// Arrays are laid out as in Forcing: the values of non-zero element n for all cells are stored contiguously
+    /// at n * number_of_cells. For every reactant factor of every process, the kernel scatters the partial
+    /// derivative of the rate into a precomputed list of (element, coefficient) pairs, so its inner loops run
+    /// across cells with no searches.
+    class Jacobian
+    {
+     public:
+      /// @throws std::invalid_argument if a reaction refers to a species the mechanism does not define
+      explicit Jacobian(const types::Mechanism& mechanism);
+
+      /// @brief Builds the kernel from processes already put in mass-action form, which Forcing can share
+      explicit Jacobian(const MassActionProcesses& processes);
+
+      std::size_t NumberOfSpecies() const
+      {
+        return row_offsets_.size() - 1;
+      }
+
+      std::size_t NumberOfProcesses() const
+      {
+        return factor_offsets_.size() - 1;
+      }
+
+      std::size_t NumberOfNonZeros() const
+      {
+        return columns_.size();
+      }
+
+      /// @brief The first non-zero element of each row, plus one past the last
+      const std::vector<std::size_t>& RowOffsets() const
+      {
+        return row_offsets_;
+      }
+
+      /// @brief The column of each non-zero element
+      const std::vector<std::size_t>& Columns() const
+      {
+        return columns_;
+      }
+
+      /// @brief The position of element (row, column) among the non-zero elements, if it is present
+      std::optional<std::size_t> NonZeroIndex(std::size_t row, std::size_t column) const;
+
+      /// @brief Writes the Jacobian values of every cell to values, overwriting its contents
+      /// @param k Rate constants, NumberOfProcesses() rows of number_of_cells
+      /// @param y Concentrations, NumberOfSpecies() rows of number_of_cells
+      /// @param values Non-zero values, NumberOfNonZeros() rows of number_of_cells
+      /// @throws std::invalid_argument if an array has the wrong size
+      void Calculate(std::span<const double> k, std::span<const double> y, std::span<double> values, std::size_t number_of_cells) const;
+
+      static constexpr std::size_t block_size = Forcing::block_size;
+
+     private:
+      std::vector<std::size_t> row_offsets_{ 0 };
+      std::vector<std::size_t> columns_;
+      /// @brief The reactant factors y^e of each process, with integer coefficients expanded into factors of
+      ///        exponent one
+      std::vector<std::size_t> factor_offsets_{ 0 };
+      std::vector<std::size_t> factor_species_;
+      std::vector<double> factor_exponents_;
+      /// @brief For each factor, the elements its partial derivative is added to and the coefficient it is
+      ///        added with
+      std::vector<std::size_t> scatter_offsets_{ 0 };
+      std::vector<std::size_t> scatter_elements_;
+      std::vector<double> scatter_coefficients_;
+    };
+  }  // namespace v1
+}  // namespace mechanism_configuration
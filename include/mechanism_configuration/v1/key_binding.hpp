@@ -0,0 +1,84 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <yaml-cpp/yaml.h>
+
+#include <cstddef>
+#include <mechanism_configuration/errors.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief The required and optional keys of one kind of object, numbered once so that each object can be
+    ///        bound with a single pass over its keys
+    class KeyTable
+    {
+     public:
+      KeyTable(const std::vector<std::string>& required_keys, const std::vector<std::string>& optional_keys);
+
+      std::size_t size() const
+      {
+        return keys_.size();
+      }
+
+     private:
+      friend class BoundObject;
+
+      std::size_t Slot(const std::string& key) const;
+
+      /// @brief Required keys in sorted order, followed by the optional keys
+      std::vector<std::string> keys_;
+      std::size_t required_;
+      std::unordered_map<std::string, std::size_t> slots_;
+    };
+
+    /// @brief An object whose keys have been matched against a KeyTable
+    ///
+    /// Binding walks the object's keys once. Each known key is dispatched to its slot, keys starting with "__"
+    /// are collected as comments, and anything else is reported. The schema errors are the same, and in the same
+    /// order, as ValidateSchema would report for the table's keys. Reading a bound value afterwards does not
+    /// search the object again.
+    class BoundObject
+    {
+     public:
+      BoundObject(const YAML::Node& object, const KeyTable& table);
+
+      /// @brief Missing required keys and unexpected keys
+      const Errors& SchemaErrors() const
+      {
+        return errors_;
+      }
+
+      bool Has(const std::string& key) const
+      {
+        return present_[table_.Slot(key)];
+      }
+
+      /// @brief The value bound to a key. The key must be present.
+      const YAML::Node& operator[](const std::string& key) const
+      {
+        return values_[table_.Slot(key)];
+      }
+
+      /// @brief Moves the collected comments out of the binding
+      std::unordered_map<std::string, std::string> TakeComments()
+      {
+        return std::move(comments_);
+      }
+
+     private:
+      const KeyTable& table_;
+      std::vector<YAML::Node> values_;
+      std::vector<bool> present_;
+      std::unordered_map<std::string, std::string> comments_;
+      Errors errors_;
+    };
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,70 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <mechanism_configuration/v1/rate_constants.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief The reactants and products of the process behind one rate constant. Either may be empty.
+    struct ProcessComponents
+    {
+      std::span<const types::ReactionComponent> reactants;
+      std::span<const types::ReactionComponent> products;
+    };
+
+    /// @brief Finds the reactants and products of the process behind a rate constant of RateConstantLayout
+    ProcessComponents ComponentsOf(const types::Mechanism& mechanism, const RateConstantSlot& slot);
+
+    /// @brief The mass-action form of every process of a mechanism, numbered as in RateConstantLayout, from
+    ///        which Forcing and Jacobian build their kernels
+    struct MassActionProcesses
+    {
+      /// @brief A reactant factor y^exponent of a process rate
+      struct Factor
+      {
+        std::size_t species;
+        double exponent;
+      };
+
+      /// @brief The net change of a species per unit of process rate
+      struct Term
+      {
+        std::size_t species;
+        double coefficient;
+      };
+
+      /// @throws std::invalid_argument if a reaction refers to a species the mechanism does not define
+      explicit MassActionProcesses(const types::Mechanism& mechanism);
+
+      std::size_t number_of_species;
+      /// @brief The reactant factors of each process, with integer coefficients expanded into factors of exponent one
+      std::vector<std::vector<Factor>> factors;
+      /// @brief The net changes of each process, with species that appear more than once merged and species whose
+      ///        production and loss cancel dropped
+      std::vector<std::vector<Term>> terms;
+    };
+
+    /// @brief The position of each species of a mechanism in its species list, by name
+    using SpeciesIndices = std::unordered_map<std::string, std::size_t>;
+
+    SpeciesIndices IndexSpecies(const types::Mechanism& mechanism);
+
+    /// @throws std::invalid_argument if the species is not in indices
+    std::size_t RequireSpecies(const SpeciesIndices& indices, const std::string& name);
+
+    /// @brief Checks that an array holds rows rows of number_of_cells values each
+    /// @throws std::invalid_argument naming the array if it does not
+    void CheckCellArraySize(std::span<const double> array, std::size_t rows, std::size_t number_of_cells, const char* name);
+  }  // namespace v1
+}  // namespace mechanism_configuration
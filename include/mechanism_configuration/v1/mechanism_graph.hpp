@@ -0,0 +1,146 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <mechanism_configuration/v1/types.hpp>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief Identifies a reaction by its type and its position in the matching list of types::Reactions
+    struct ReactionIndex
+    {
+      types::ReactionType type;
+      std::size_t index;
+    };
+
+    /// @brief The species and reactions that can become active from a set of initially present species
+    struct Reachability
+    {
+      /// @brief Whether each species, indexed as in the mechanism, can be present
+      std::vector<bool> species;
+      /// @brief Whether each reaction, indexed as in MechanismGraph, can proceed
+      std::vector<bool> reactions;
+    };
+
+    /// @brief A set of species and reactions that are all reachable from each other
+    struct StronglyConnectedComponent
+    {
+      std::vector<std::size_t> species;
+      std::vector<std::size_t> reactions;
+    };
+
+    /// @brief A bipartite species-reaction graph built from a parsed mechanism
+    ///
+    /// Species are numbered in the order of types::Mechanism::species. Reactions are numbered by walking the
+    /// lists in types::Reactions in member order. An edge runs from each reactant to its reaction and from each
+    /// reaction to its products. Phase-transfer and equilibrium reactions (SIMPOL, Henry's law and aqueous
+    /// equilibrium) are reversible and have edges in both directions. Aerosol-phase water is treated as a
+    /// solvent and is not part of the graph. All queries run in time linear in the size of the graph.
+    class MechanismGraph
+    {
+     public:
+      explicit MechanismGraph(const types::Mechanism& mechanism);
+
+      std::size_t NumberOfSpecies() const
+      {
+        return species_names_.size();
+      }
+
+      std::size_t NumberOfReactions() const
+      {
+        return reactions_.size();
+      }
+
+      const std::string& SpeciesName(std::size_t species) const
+      {
+        return species_names_[species];
+      }
+
+      std::optional<std::size_t> SpeciesIndex(const std::string& name) const;
+
+      const ReactionIndex& Reaction(std::size_t reaction) const
+      {
+        return reactions_[reaction];
+      }
+
+      /// @brief The species consumed by a reaction in its forward direction
+      std::span<const std::size_t> Reactants(std::size_t reaction) const;
+
+      /// @brief The species produced by a reaction in its forward direction
+      std::span<const std::size_t> Products(std::size_t reaction) const;
+
+      bool IsReversible(std::size_t reaction) const;
+
+      /// @brief Finds every species that can be produced, and every reaction that can proceed, starting from
+      ///        the given species. Reactions without reactants, such as emissions, always proceed.
+      Reachability Reachable(std::span<const std::size_t> initial_species) const;
+      Reachability Reachable(const std::vector<std::string>& initial_species) const;
+
+      /// @brief Species that cannot be present given the initial species
+      std::vector<std::size_t> DeadSpecies(const std::vector<std::string>& initial_species) const;
+
+      /// @brief Reactions that can never proceed given the initial species
+      std::vector<std::size_t> DeadReactions(const std::vector<std::string>& initial_species) const;
+
+      /// @brief Finds the strongly connected components of the graph that contain a cycle, such as catalytic
+      ///        or chain-propagating cycles
+      ///
+      /// A component is reported only if it has a directed cycle through the forward directions of its reactions.
+      /// Loops that need the reverse direction of a reversible reaction, such as a gas-phase species in Henry's
+      /// law equilibrium with an aqueous species that is in turn in equilibrium with its ions, are equilibria
+      /// rather than cycles.
+      std::vector<StronglyConnectedComponent> Cycles() const;
+
+     private:
+      /// @brief A directed pass through a reaction. Reversible reactions have two channels.
+      struct Channel
+      {
+        std::size_t reaction;
+        std::size_t inputs_begin;
+        std::size_t inputs_end;
+        std::size_t outputs_begin;
+        std::size_t outputs_end;
+      };
+
+      void AddReaction(
+          types::ReactionType type,
+          std::size_t index,
+          const std::vector<std::string>& reactants,
+          const std::vector<std::string>& products,
+          bool reversible);
+
+      void BuildSpeciesAdjacency();
+
+      /// @brief Marks a node as outside the component being checked by HasForwardCycle
+      static constexpr std::size_t not_in_component = static_cast<std::size_t>(-1);
+
+      /// @brief Whether the forward channels of a strongly connected component form a directed cycle
+      /// @param in_degree Scratch space of one entry per node, species then channels, holding not_in_component
+      ///        on entry and on return
+      bool HasForwardCycle(const std::vector<std::size_t>& species, const std::vector<std::size_t>& channels, std::vector<std::size_t>& in_degree)
+          const;
+
+      std::vector<std::string> species_names_;
+      std::unordered_map<std::string, std::size_t> species_indices_;
+      std::vector<ReactionIndex> reactions_;
+      /// @brief The first channel of each reaction, plus one past the last
+      std::vector<std::size_t> reaction_channels_;
+      std::vector<Channel> channels_;
+      /// @brief Channel inputs and outputs, stored contiguously
+      std::vector<std::size_t> channel_species_;
+      /// @brief Channels consuming each species, in compressed sparse row form
+      std::vector<std::size_t> consumer_offsets_;
+      std::vector<std::size_t> consumers_;
+    };
+  }  // namespace v1
+}  // namespace mechanism_configuration
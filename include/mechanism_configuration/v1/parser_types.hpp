@@ -21,141 +21,85 @@ namespace mechanism_configuration
     class CondensedPhaseArrheniusParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
 
     class TroeParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
 
     class BranchedParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
 
     class TunnelingParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
 
     class SurfaceParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
 
     class CondensedPhasePhotolysisParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
 
     class SimpolPhaseTransferParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
 
     class EmissionParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
 
     class PhotolysisParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
 
     class FirstOrderLossParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
 
     class AqueousEquilibriumParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
 
     class WetDepositionParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
 
     class HenrysLawParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
 
     class ArrheniusParser : public IReactionParser
     {
      public:
-      Errors parse(
-          const YAML::Node& object,
-          const std::vector<types::Species>& existing_species,
-          const std::vector<types::Phase>& existing_phases,
-          types::Reactions& reactions) override;
+      Errors parse(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions) override;
     };
   }  // namespace v1
 }  // namespace mechanism_configuration
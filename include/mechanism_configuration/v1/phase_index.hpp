@@ -0,0 +1,77 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <mechanism_configuration/v1/types.hpp>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief Species and phase membership lookups used while validating reactions
+    ///
+    /// Species and phases are numbered in the order given. Each phase keeps a bitset over species ordinals, so
+    /// checking whether a phase contains a species is a hash lookup followed by a bit test. The index owns
+    /// copies of the names and does not refer back to the vectors it was built from. Lookups take string views,
+    /// so callers can check names they do not own without copying them.
+    class PhaseIndex
+    {
+     public:
+      PhaseIndex() = default;
+      PhaseIndex(const std::vector<types::Species>& species, const std::vector<types::Phase>& phases);
+
+      std::optional<std::size_t> SpeciesOrdinal(std::string_view name) const;
+      std::optional<std::size_t> PhaseOrdinal(std::string_view name) const;
+
+      bool HasSpecies(std::string_view name) const
+      {
+        return species_.find(name) != species_.end();
+      }
+
+      bool HasPhase(std::string_view name) const
+      {
+        return phases_.find(name) != phases_.end();
+      }
+
+      /// @brief Whether the phase exists and lists the species
+      bool PhaseHasSpecies(std::string_view phase, std::string_view species) const;
+
+      /// @brief Whether any of the requested species is not a known species
+      bool RequiresUnknownSpecies(const std::vector<std::string_view>& requested_species) const;
+
+      /// @brief Whether any of the requested species is not listed in the phase. Returns true if the phase
+      ///        does not exist.
+      bool PhaseRequiresUnknownSpecies(std::string_view phase, const std::vector<std::string_view>& requested_species) const;
+
+     private:
+      /// @brief Hashes strings and string views alike, for lookups by string view
+      struct NameHash
+      {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view name) const
+        {
+          return std::hash<std::string_view>{}(name);
+        }
+      };
+
+      using NameMap = std::unordered_map<std::string, std::size_t, NameHash, std::equal_to<>>;
+
+      bool Contains(std::size_t phase, std::string_view species) const;
+
+      NameMap species_;
+      NameMap phases_;
+      /// @brief Membership bits, one row of NumberOfSpecies bits per phase
+      std::vector<bool> members_;
+    };
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,170 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <mechanism_configuration/v1/mechanism_graph.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief The environmental conditions rate constants depend on
+    struct Conditions
+    {
+      /// @brief Temperature [K]
+      double temperature{ 298.15 };
+      /// @brief Pressure [Pa]
+      double pressure{ 101325.0 };
+      /// @brief Number density of air [mol m-3]
+      double air_density{ 40.9 };
+    };
+
+    /// @brief The rate a rate constant belongs to. Branched reactions have one rate per branch.
+    enum class RateChannel
+    {
+      Forward,
+      Nitrate,
+      Alkoxy
+    };
+
+    /// @brief One rate constant of a mechanism
+    struct RateConstantSlot
+    {
+      ReactionIndex reaction;
+      RateChannel channel{ RateChannel::Forward };
+      /// @brief For rates supplied by the host model, the position of the rate in the external rate array. The
+      ///        rate constant is the supplied rate times the reaction's scaling factor.
+      std::optional<std::size_t> external;
+    };
+
+    /// @brief Lists the rate constants of a mechanism, walking the lists in types::Reactions in member order
+    ///
+    /// Arrhenius, condensed-phase Arrhenius, Troe and tunneling reactions have one rate constant and branched
+    /// reactions have two, the nitrate branch first. Photolysis, condensed-phase photolysis, emission, first-order
+    /// loss and wet deposition rates are supplied by the host model and numbered in the same order. Surface,
+    /// phase-transfer and equilibrium reactions depend on the aerosol state and have no rate constant here.
+    std::vector<RateConstantSlot> RateConstantLayout(const types::Mechanism& mechanism);
+
+    /// @brief Evaluates the rate constants of a mechanism from its parameters
+    ///
+    /// This is the generic path: every rate expression is evaluated in full, whatever its parameters. The
+    /// kernels written by WriteRateKernel compute the same values, specialized to one mechanism.
+    class RateConstants
+    {
+     public:
+      explicit RateConstants(const types::Mechanism& mechanism);
+
+      std::size_t Size() const
+      {
+        return layout_.size();
+      }
+
+      std::size_t NumberOfExternalRates() const
+      {
+        return external_.size();
+      }
+
+      const std::vector<RateConstantSlot>& Layout() const
+      {
+        return layout_;
+      }
+
+      /// @brief Writes the rate constants, numbered as in Layout(), to k
+      /// @param external The externally supplied rates, NumberOfExternalRates() of them
+      /// @throws std::invalid_argument if external or k has the wrong size
+      void Calculate(const Conditions& conditions, std::span<const double> external, std::span<double> k) const;
+
+      /// @brief Writes the rate constants of many cells to k
+      ///
+      /// Arrays hold one row per rate with the cells contiguous in each row, as in Forcing. The external rates
+      /// are laid out as the parameter array of ExternalRateRegistry, so the host can fill them by row.
+      /// @param conditions The conditions of each cell, number_of_cells of them
+      /// @param external The externally supplied rates, NumberOfExternalRates() rows of number_of_cells
+      /// @param k Rate constants, Size() rows of number_of_cells
+      /// @throws std::invalid_argument if an array has the wrong size
+      void Calculate(
+          std::span<const Conditions> conditions,
+          std::span<const double> external,
+          std::span<double> k,
+          std::size_t number_of_cells) const;
+
+     private:
+      struct ArrheniusTerm
+      {
+        std::size_t slot;
+        double A, B, C, D, E;
+      };
+
+      struct TroeTerm
+      {
+        std::size_t slot;
+        double k0_A, k0_B, k0_C, kinf_A, kinf_B, kinf_C, Fc, N;
+      };
+
+      struct TunnelingTerm
+      {
+        std::size_t slot;
+        double A, B, C;
+      };
+
+      struct BranchedTerm
+      {
+        std::size_t slot;
+        double X, Y, a0;
+        int n;
+      };
+
+      struct ExternalTerm
+      {
+        std::size_t slot;
+        std::size_t external;
+        double scaling_factor;
+      };
+
+      std::vector<RateConstantSlot> layout_;
+      std::vector<ArrheniusTerm> arrhenius_;
+      std::vector<TroeTerm> troe_;
+      std::vector<TunnelingTerm> tunneling_;
+      std::vector<BranchedTerm> branched_;
+      std::vector<ExternalTerm> external_;
+    };
+
+    namespace rates
+    {
+      /// @brief k = A exp(C / T) (T / D)^B (1 + E P)
+      double Arrhenius(double A, double B, double C, double D, double E, const Conditions& conditions);
+
+      /// @brief The Troe falloff expression, with the low- and high-pressure limits taken relative to 300 K
+      double Troe(
+          double k0_A,
+          double k0_B,
+          double k0_C,
+          double kinf_A,
+          double kinf_B,
+          double kinf_C,
+          double Fc,
+          double N,
+          const Conditions& conditions);
+
+      /// @brief k = A exp(-B / T + C / T^3)
+      double Tunneling(double A, double B, double C, const Conditions& conditions);
+
+      /// @brief One branch of the Wennberg et al. (2018) alkoxy/nitrate branching rate
+      double Branched(double X, double Y, double a0, int n, RateChannel channel, const Conditions& conditions);
+
+      /// @brief The temperature- and density-dependent factor of the branching rate, with the air density in
+      ///        molecules cm-3
+      double BranchedFactor(int n, double temperature, double air_density);
+
+      /// @brief The branching ratio term z of the branching rate, which depends only on the reaction parameters
+      double BranchedRatio(double a0, int n);
+    }  // namespace rates
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,88 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <mechanism_configuration/v1/rate_constants.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+#include <ostream>
+#include <span>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief Writes C++ source for a rate kernel specialized to one mechanism
+    ///
+    /// The kernel computes the same rate constants as RateConstants, numbered as in RateConstantLayout, in one
+    /// straight-line function. Parameters are folded into constants and factors that cannot change the result
+    /// are dropped: exp(C / T) when C is zero, (T / D)^B when B is zero and (1 + E P) when E is zero. Each
+    /// distinct exp(C / T) and T^B is computed once and shared by every reaction that uses it. A second
+    /// straight-line function computes the same species tendencies as Forcing for one cell, from the rate of
+    /// each process and one sum per species. The source depends only on the standard library and exports C
+    /// entry points, so it can be built as a plugin library and loaded with RateKernelPlugin:
+    ///
+    ///   std::size_t mechanism_rate_constant_count();
+    ///   std::size_t mechanism_external_rate_count();
+    ///   void mechanism_rate_constants(const double* conditions, const double* external, double* k);
+    ///   std::size_t mechanism_species_count();
+    ///   void mechanism_forcing(const double* k, const double* y, double* f);
+    ///
+    /// where conditions holds the temperature [K], pressure [Pa] and air density [mol m-3], and y and f hold
+    /// the concentration and tendency of each species in mechanism order.
+    /// @throws std::invalid_argument if a reaction refers to a species the mechanism does not define
+    void WriteRateKernel(const types::Mechanism& mechanism, std::ostream& stream);
+
+    /// @brief A rate kernel written by WriteRateKernel and loaded from a shared library
+    class RateKernelPlugin
+    {
+     public:
+      /// @throws std::runtime_error if the library cannot be loaded or does not export a rate kernel
+      explicit RateKernelPlugin(const std::filesystem::path& library);
+      ~RateKernelPlugin();
+
+      RateKernelPlugin(const RateKernelPlugin&) = delete;
+      RateKernelPlugin& operator=(const RateKernelPlugin&) = delete;
+      RateKernelPlugin(RateKernelPlugin&& other) noexcept;
+      RateKernelPlugin& operator=(RateKernelPlugin&& other) noexcept;
+
+      std::size_t Size() const
+      {
+        return size_;
+      }
+
+      std::size_t NumberOfExternalRates() const
+      {
+        return external_size_;
+      }
+
+      std::size_t NumberOfSpecies() const
+      {
+        return species_size_;
+      }
+
+      /// @brief Writes the rate constants, numbered as in RateConstantLayout, to k
+      /// @throws std::invalid_argument if external or k has the wrong size
+      void Calculate(const Conditions& conditions, std::span<const double> external, std::span<double> k) const;
+
+      /// @brief Writes the tendency of each species to f, from rate constants k and concentrations y
+      /// @throws std::invalid_argument if k, y or f has the wrong size
+      void CalculateForcing(std::span<const double> k, std::span<const double> y, std::span<double> f) const;
+
+     private:
+      using KernelFunction = void (*)(const double*, const double*, double*);
+
+      void Close();
+
+      void* handle_{ nullptr };
+      KernelFunction kernel_{ nullptr };
+      KernelFunction forcing_{ nullptr };
+      std::size_t size_{ 0 };
+      std::size_t external_size_{ 0 };
+      std::size_t species_size_{ 0 };
+    };
+  }  // namespace v1
+}  // namespace mechanism_configuration
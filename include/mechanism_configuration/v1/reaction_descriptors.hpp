@@ -0,0 +1,413 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/errors.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+#include <mechanism_configuration/v1/validation.hpp>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    class BoundObject;
+    class PhaseIndex;
+
+    namespace descriptors
+    {
+      /// @brief A configuration key, named by its member of validation::Keys
+      using Key = const std::string validation::Keys::*;
+
+      inline const std::string& KeyName(Key key)
+      {
+        return validation::keys.*key;
+      }
+
+      /// @brief The name of a species field's value
+      inline const std::string& SpeciesName(const std::string& species)
+      {
+        return species;
+      }
+
+      inline const std::string& SpeciesName(const types::ReactionComponent& species)
+      {
+        return species.species_name;
+      }
+
+      inline std::string& SpeciesName(std::string& species)
+      {
+        return species;
+      }
+
+      inline std::string& SpeciesName(types::ReactionComponent& species)
+      {
+        return species.species_name;
+      }
+
+      enum class Presence
+      {
+        Required,
+        Optional
+      };
+
+      /// @brief How a phase field is validated
+      enum class PhaseCheck
+      {
+        /// @brief The phase is recorded but not looked up
+        Unchecked,
+        /// @brief The phase only has to exist
+        Exists,
+        /// @brief Every species the reaction refers to
+        AllSpecies,
+        /// @brief The Species fields that name this phase
+        ListedSpecies
+      };
+
+      enum class FieldKind
+      {
+        Number,
+        NumberList,
+        Components,
+        Species,
+        Phase,
+        Option
+      };
+
+      /// @brief A number read from key into member. Integer members are read as doubles and truncated.
+      template<typename T, typename M>
+      struct Number
+      {
+        static constexpr FieldKind kind = FieldKind::Number;
+
+        Key key;
+        M T::*member;
+        const char* attribute;
+        Presence presence = Presence::Optional;
+      };
+
+      /// @brief A required, fixed-length sequence of numbers
+      template<typename T, typename M>
+      struct NumberList
+      {
+        static constexpr FieldKind kind = FieldKind::NumberList;
+
+        Key key;
+        M T::*member;
+        const char* attribute;
+      };
+
+      /// @brief A required list of reaction components
+      template<typename T>
+      struct Components
+      {
+        static constexpr FieldKind kind = FieldKind::Components;
+
+        Key key;
+        std::vector<types::ReactionComponent> T::*member;
+        const char* attribute;
+      };
+
+      /// @brief A required species name, stored as a string or as a reaction component. If phase is set, the
+      ///        species must be listed in the phase given by that key.
+      template<typename T, typename M>
+      struct Species
+      {
+        static constexpr FieldKind kind = FieldKind::Species;
+
+        Key key;
+        M T::*member;
+        const char* attribute;
+        Key phase = nullptr;
+      };
+
+      /// @brief A required phase name
+      template<typename T>
+      struct Phase
+      {
+        static constexpr FieldKind kind = FieldKind::Phase;
+
+        Key key;
+        std::string T::*member;
+        const char* attribute;
+        PhaseCheck check = PhaseCheck::Exists;
+      };
+
+      /// @brief An optional key with no member of its own, read by the descriptor's Read hook
+      struct Option
+      {
+        static constexpr FieldKind kind = FieldKind::Option;
+
+        Key key;
+      };
+    }  // namespace descriptors
+
+    /// @brief Describes how a reaction type is stored in a configuration
+    ///
+    /// Each specialization lists its fields in the order they are written. The parser, the serializer, the
+    /// parameter visitor and the Python bindings are all generated from these lists. A descriptor may also
+    /// declare two hooks, defined next to the type's parser:
+    ///   static void Read(const BoundObject&, T&, Errors&)                     runs after the fields are read
+    ///   static void Check(const BoundObject&, const PhaseIndex&, const T&, Errors&)   runs after the phase checks
+    template<typename T>
+    struct ReactionDescriptor;
+
+    /// @brief Calls f(field) for each field of a descriptor, in order. Fields are told apart by their kind:
+    ///        if constexpr (std::decay_t<decltype(field)>::kind == descriptors::FieldKind::Number)
+    template<typename Fields, typename Func>
+    constexpr void ForEachField(const Fields& fields, Func&& f)
+    {
+      std::apply([&f](const auto&... field) { (f(field), ...); }, fields);
+    }
+
+    template<typename T>
+    concept DescribedReaction = requires { ReactionDescriptor<T>::fields; };
+
+    template<>
+    struct ReactionDescriptor<types::Arrhenius>
+    {
+      using R = types::Arrhenius;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::Arrhenius;
+      static constexpr descriptors::Key type_key = &K::Arrhenius_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::gas_phase, &R::gas_phase, "gas_phase" },
+        descriptors::Components{ &K::reactants, &R::reactants, "reactants" },
+        descriptors::Components{ &K::products, &R::products, "products" },
+        descriptors::Number{ &K::A, &R::A, "A" },
+        descriptors::Number{ &K::B, &R::B, "B" },
+        descriptors::Number{ &K::C, &R::C, "C" },
+        descriptors::Number{ &K::D, &R::D, "D" },
+        descriptors::Number{ &K::E, &R::E, "E" },
+        descriptors::Option{ &K::Ea },
+      };
+      static void Read(const BoundObject& bound, R& reaction, Errors& errors);
+    };
+
+    template<>
+    struct ReactionDescriptor<types::Branched>
+    {
+      using R = types::Branched;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::Branched;
+      static constexpr descriptors::Key type_key = &K::Branched_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::gas_phase, &R::gas_phase, "gas_phase" },
+        descriptors::Components{ &K::reactants, &R::reactants, "reactants" },
+        descriptors::Components{ &K::nitrate_products, &R::nitrate_products, "nitrate_products" },
+        descriptors::Components{ &K::alkoxy_products, &R::alkoxy_products, "alkoxy_products" },
+        descriptors::Number{ &K::X, &R::X, "X", descriptors::Presence::Required },
+        descriptors::Number{ &K::Y, &R::Y, "Y", descriptors::Presence::Required },
+        descriptors::Number{ &K::a0, &R::a0, "a0", descriptors::Presence::Required },
+        descriptors::Number{ &K::n, &R::n, "n", descriptors::Presence::Required },
+      };
+    };
+
+    template<>
+    struct ReactionDescriptor<types::CondensedPhaseArrhenius>
+    {
+      using R = types::CondensedPhaseArrhenius;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::CondensedPhaseArrhenius;
+      static constexpr descriptors::Key type_key = &K::CondensedPhaseArrhenius_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::aerosol_phase, &R::aerosol_phase, "aerosol_phase", descriptors::PhaseCheck::AllSpecies },
+        descriptors::Species{ &K::aerosol_phase_water, &R::aerosol_phase_water, "aerosol_phase_water" },
+        descriptors::Components{ &K::reactants, &R::reactants, "reactants" },
+        descriptors::Components{ &K::products, &R::products, "products" },
+        descriptors::Number{ &K::A, &R::A, "A" },
+        descriptors::Number{ &K::B, &R::B, "B" },
+        descriptors::Number{ &K::C, &R::C, "C" },
+        descriptors::Number{ &K::D, &R::D, "D" },
+        descriptors::Number{ &K::E, &R::E, "E" },
+        descriptors::Option{ &K::Ea },
+      };
+      static void Read(const BoundObject& bound, R& reaction, Errors& errors);
+    };
+
+    template<>
+    struct ReactionDescriptor<types::CondensedPhasePhotolysis>
+    {
+      using R = types::CondensedPhasePhotolysis;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::CondensedPhasePhotolysis;
+      static constexpr descriptors::Key type_key = &K::CondensedPhasePhotolysis_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::aerosol_phase, &R::aerosol_phase, "aerosol_phase", descriptors::PhaseCheck::AllSpecies },
+        descriptors::Species{ &K::aerosol_phase_water, &R::aerosol_phase_water, "aerosol_phase_water" },
+        descriptors::Components{ &K::reactants, &R::reactants, "reactants" },
+        descriptors::Components{ &K::products, &R::products, "products" },
+        descriptors::Number{ &K::scaling_factor, &R::scaling_factor_, "scaling_factor_" },
+      };
+      static void Check(const BoundObject& bound, const PhaseIndex& index, const R& reaction, Errors& errors);
+    };
+
+    template<>
+    struct ReactionDescriptor<types::Emission>
+    {
+      using R = types::Emission;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::Emission;
+      static constexpr descriptors::Key type_key = &K::Emission_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::gas_phase, &R::gas_phase, "gas_phase" },
+        descriptors::Components{ &K::products, &R::products, "products" },
+        descriptors::Number{ &K::scaling_factor, &R::scaling_factor, "scaling_factor" },
+      };
+    };
+
+    template<>
+    struct ReactionDescriptor<types::FirstOrderLoss>
+    {
+      using R = types::FirstOrderLoss;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::FirstOrderLoss;
+      static constexpr descriptors::Key type_key = &K::FirstOrderLoss_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::gas_phase, &R::gas_phase, "gas_phase" },
+        descriptors::Components{ &K::reactants, &R::reactants, "reactants" },
+        descriptors::Number{ &K::scaling_factor, &R::scaling_factor, "scaling_factor" },
+      };
+      static void Check(const BoundObject& bound, const PhaseIndex& index, const R& reaction, Errors& errors);
+    };
+
+    template<>
+    struct ReactionDescriptor<types::SimpolPhaseTransfer>
+    {
+      using R = types::SimpolPhaseTransfer;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::SimpolPhaseTransfer;
+      static constexpr descriptors::Key type_key = &K::SimpolPhaseTransfer_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::gas_phase, &R::gas_phase, "gas_phase" },
+        descriptors::Species{ &K::gas_phase_species, &R::gas_phase_species, "gas_phase_species" },
+        descriptors::Phase{ &K::aerosol_phase, &R::aerosol_phase, "aerosol_phase" },
+        descriptors::Species{ &K::aerosol_phase_species, &R::aerosol_phase_species, "aerosol_phase_species" },
+        descriptors::NumberList{ &K::B, &R::B, "B" },
+      };
+      static void Check(const BoundObject& bound, const PhaseIndex& index, const R& reaction, Errors& errors);
+    };
+
+    template<>
+    struct ReactionDescriptor<types::AqueousEquilibrium>
+    {
+      using R = types::AqueousEquilibrium;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::AqueousEquilibrium;
+      static constexpr descriptors::Key type_key = &K::AqueousPhaseEquilibrium_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::aerosol_phase, &R::aerosol_phase, "aerosol_phase", descriptors::PhaseCheck::AllSpecies },
+        descriptors::Species{ &K::aerosol_phase_water, &R::aerosol_phase_water, "aerosol_phase_water" },
+        descriptors::Components{ &K::reactants, &R::reactants, "reactants" },
+        descriptors::Components{ &K::products, &R::products, "products" },
+        descriptors::Number{ &K::A, &R::A, "A" },
+        descriptors::Number{ &K::C, &R::C, "C" },
+        descriptors::Number{ &K::k_reverse, &R::k_reverse, "k_reverse", descriptors::Presence::Required },
+      };
+    };
+
+    template<>
+    struct ReactionDescriptor<types::WetDeposition>
+    {
+      using R = types::WetDeposition;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::WetDeposition;
+      static constexpr descriptors::Key type_key = &K::WetDeposition_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::aerosol_phase, &R::aerosol_phase, "aerosol_phase" },
+        descriptors::Number{ &K::scaling_factor, &R::scaling_factor, "scaling_factor" },
+      };
+    };
+
+    template<>
+    struct ReactionDescriptor<types::HenrysLaw>
+    {
+      using R = types::HenrysLaw;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::HenrysLaw;
+      static constexpr descriptors::Key type_key = &K::HenrysLaw_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::gas_phase, &R::gas_phase, "gas_phase" },
+        descriptors::Species{ &K::gas_phase_species, &R::gas_phase_species, "gas_phase_species" },
+        descriptors::Phase{ &K::aerosol_phase, &R::aerosol_phase, "aerosol_phase", descriptors::PhaseCheck::ListedSpecies },
+        descriptors::Species{ &K::aerosol_phase_species, &R::aerosol_phase_species, "aerosol_phase_species", &K::aerosol_phase },
+        descriptors::Species{ &K::aerosol_phase_water, &R::aerosol_phase_water, "aerosol_phase_water", &K::aerosol_phase },
+      };
+    };
+
+    template<>
+    struct ReactionDescriptor<types::Photolysis>
+    {
+      using R = types::Photolysis;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::Photolysis;
+      static constexpr descriptors::Key type_key = &K::Photolysis_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::gas_phase, &R::gas_phase, "gas_phase" },
+        descriptors::Components{ &K::reactants, &R::reactants, "reactants" },
+        descriptors::Components{ &K::products, &R::products, "products" },
+        descriptors::Number{ &K::scaling_factor, &R::scaling_factor, "scaling_factor" },
+      };
+      static void Check(const BoundObject& bound, const PhaseIndex& index, const R& reaction, Errors& errors);
+    };
+
+    template<>
+    struct ReactionDescriptor<types::Surface>
+    {
+      using R = types::Surface;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::Surface;
+      static constexpr descriptors::Key type_key = &K::Surface_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::gas_phase, &R::gas_phase, "gas_phase", descriptors::PhaseCheck::Unchecked },
+        descriptors::Species{ &K::gas_phase_species, &R::gas_phase_species, "gas_phase_species" },
+        descriptors::Phase{ &K::aerosol_phase, &R::aerosol_phase, "aerosol_phase" },
+        descriptors::Components{ &K::gas_phase_products, &R::gas_phase_products, "gas_phase_products" },
+        descriptors::Number{ &K::reaction_probability, &R::reaction_probability, "reaction_probability" },
+      };
+    };
+
+    template<>
+    struct ReactionDescriptor<types::Troe>
+    {
+      using R = types::Troe;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::Troe;
+      static constexpr descriptors::Key type_key = &K::Troe_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::gas_phase, &R::gas_phase, "gas_phase" },
+        descriptors::Components{ &K::reactants, &R::reactants, "reactants" },
+        descriptors::Components{ &K::products, &R::products, "products" },
+        descriptors::Number{ &K::k0_A, &R::k0_A, "k0_A" },
+        descriptors::Number{ &K::k0_B, &R::k0_B, "k0_B" },
+        descriptors::Number{ &K::k0_C, &R::k0_C, "k0_C" },
+        descriptors::Number{ &K::kinf_A, &R::kinf_A, "kinf_A" },
+        descriptors::Number{ &K::kinf_B, &R::kinf_B, "kinf_B" },
+        descriptors::Number{ &K::kinf_C, &R::kinf_C, "kinf_C" },
+        descriptors::Number{ &K::Fc, &R::Fc, "Fc" },
+        descriptors::Number{ &K::N, &R::N, "N" },
+      };
+    };
+
+    template<>
+    struct ReactionDescriptor<types::Tunneling>
+    {
+      using R = types::Tunneling;
+      using K = validation::Keys;
+      static constexpr types::ReactionType type = types::ReactionType::Tunneling;
+      static constexpr descriptors::Key type_key = &K::Tunneling_key;
+      static constexpr auto fields = std::tuple{
+        descriptors::Phase{ &K::gas_phase, &R::gas_phase, "gas_phase" },
+        descriptors::Components{ &K::reactants, &R::reactants, "reactants" },
+        descriptors::Components{ &K::products, &R::products, "products" },
+        descriptors::Number{ &K::A, &R::A, "A" },
+        descriptors::Number{ &K::B, &R::B, "B" },
+        descriptors::Number{ &K::C, &R::C, "C" },
+      };
+    };
+  }  // namespace v1
+}  // namespace mechanism_configuration
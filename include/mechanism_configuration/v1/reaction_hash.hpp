@@ -0,0 +1,99 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <mechanism_configuration/v1/mechanism_graph.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief A species in the canonical form of a reaction. The name refers to the reaction's own string, so
+    ///        the component must not outlive the reaction.
+    struct CanonicalComponent
+    {
+      types::ComponentRole role;
+      std::string_view name;
+      double coefficient;
+
+      bool operator==(const CanonicalComponent&) const = default;
+    };
+
+    /// @brief The species of a reaction, sorted by role and name, with repeated species in the same role merged by
+    ///        summing their coefficients, so "A + A" and "2 A" have the same canonical form
+    template<typename ReactionT>
+    std::vector<CanonicalComponent> CanonicalComponents(const ReactionT& reaction)
+    {
+      std::vector<CanonicalComponent> components;
+      types::ForEachComponent(reaction, [&](types::ComponentRole role, const std::string& name, double coefficient)
+                              { components.push_back({ role, name, coefficient }); });
+      std::sort(
+          components.begin(),
+          components.end(),
+          [](const CanonicalComponent& a, const CanonicalComponent& b) { return std::tie(a.role, a.name) < std::tie(b.role, b.name); });
+      std::size_t merged = 0;
+      for (std::size_t i = 0; i < components.size(); ++i)
+      {
+        if (merged > 0 && components[merged - 1].role == components[i].role && components[merged - 1].name == components[i].name)
+        {
+          components[merged - 1].coefficient += components[i].coefficient;
+        }
+        else
+        {
+          if (merged != i)
+          {
+            components[merged] = std::move(components[i]);
+          }
+          ++merged;
+        }
+      }
+      components.resize(merged);
+      return components;
+    }
+
+    /// @brief Hashes a reaction's type, phases and canonical components. Names, rate parameters and unknown
+    ///        properties are not part of the hash.
+    std::uint64_t CanonicalHash(const types::Arrhenius& reaction);
+    std::uint64_t CanonicalHash(const types::Branched& reaction);
+    std::uint64_t CanonicalHash(const types::CondensedPhaseArrhenius& reaction);
+    std::uint64_t CanonicalHash(const types::CondensedPhasePhotolysis& reaction);
+    std::uint64_t CanonicalHash(const types::Emission& reaction);
+    std::uint64_t CanonicalHash(const types::FirstOrderLoss& reaction);
+    std::uint64_t CanonicalHash(const types::SimpolPhaseTransfer& reaction);
+    std::uint64_t CanonicalHash(const types::AqueousEquilibrium& reaction);
+    std::uint64_t CanonicalHash(const types::WetDeposition& reaction);
+    std::uint64_t CanonicalHash(const types::HenrysLaw& reaction);
+    std::uint64_t CanonicalHash(const types::Photolysis& reaction);
+    std::uint64_t CanonicalHash(const types::Surface& reaction);
+    std::uint64_t CanonicalHash(const types::Troe& reaction);
+    std::uint64_t CanonicalHash(const types::Tunneling& reaction);
+
+    /// @brief Two reactions of the same type with the same phases and canonical components
+    struct DuplicateReaction
+    {
+      /// @brief The earlier of the two reactions
+      ReactionIndex original;
+      ReactionIndex duplicate;
+      /// @brief Whether the rate parameters are also the same, so the duplicate doubles the original's rate
+      bool identical_parameters;
+      bool identical_names;
+    };
+
+    /// @brief Finds reactions that duplicate an earlier reaction, in expected linear time
+    ///
+    /// Each duplicate is paired with the earliest exact repeat, or failing that the earliest matching reaction with
+    /// identical parameters, or the earliest matching reaction. Reactions with the same species but different
+    /// rate parameters, such as a rate written as a sum of Arrhenius terms, are reported with
+    /// identical_parameters set to false.
+    std::vector<DuplicateReaction> FindDuplicateReactions(const types::Reactions& reactions);
+  }  // namespace v1
+}  // namespace mechanism_configuration
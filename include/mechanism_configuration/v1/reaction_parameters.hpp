@@ -0,0 +1,61 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mechanism_configuration/v1/reaction_descriptors.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+#include <string>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    namespace descriptors
+    {
+      /// @brief The names of the elements of a number list, such as "B[0]", built once per list type
+      template<typename T, typename M>
+      const std::vector<std::string>& ElementNames(const NumberList<T, M>& field)
+      {
+        static const std::vector<std::string> names = [&field]()
+        {
+          std::vector<std::string> result;
+          for (std::size_t i = 0; i < std::tuple_size_v<M>; ++i)
+          {
+            result.push_back(KeyName(field.key) + "[" + std::to_string(i) + "]");
+          }
+          return result;
+        }();
+        return names;
+      }
+    }  // namespace descriptors
+
+    /// @brief Calls f(key, value) for every numeric rate parameter of a reaction, in descriptor order, naming
+    ///        each by its configuration key. Elements of a number list are named "key[i]".
+    template<DescribedReaction T, typename Func>
+    void ForEachParameter(const T& reaction, Func&& f)
+    {
+      ForEachField(
+          ReactionDescriptor<T>::fields,
+          [&](const auto& field)
+          {
+            using Field = std::decay_t<decltype(field)>;
+            if constexpr (Field::kind == descriptors::FieldKind::Number)
+            {
+              f(descriptors::KeyName(field.key), static_cast<double>(reaction.*field.member));
+            }
+            else if constexpr (Field::kind == descriptors::FieldKind::NumberList)
+            {
+              const auto& names = descriptors::ElementNames(field);
+              const auto& values = reaction.*field.member;
+              for (std::size_t i = 0; i < values.size(); ++i)
+              {
+                f(names[i], values[i]);
+              }
+            }
+          });
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,42 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <mechanism_configuration/v1/mechanism_graph.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+#include <string>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    /// @brief A sub-mechanism together with maps from its elements back to the original mechanism
+    struct ReducedMechanism
+    {
+      types::Mechanism mechanism;
+      /// @brief For each species of the reduced mechanism, its index in the original species list
+      std::vector<std::size_t> species;
+      /// @brief For each phase of the reduced mechanism, its index in the original phase list
+      std::vector<std::size_t> phases;
+      /// @brief For each reaction of the reduced mechanism, numbered as in MechanismGraph, the original reaction
+      std::vector<ReactionIndex> reactions;
+    };
+
+    /// @brief Extracts the part of a mechanism needed to compute the target species
+    ///
+    /// Starting from the targets, every reaction that produces or consumes a needed species is kept, and the
+    /// reactants of kept reactions become needed in turn (the closure of a directed relation graph). Products and
+    /// aerosol-phase water of kept reactions are retained so the result is a valid mechanism. When emitted species
+    /// are given, reactions that cannot proceed from them are removed first.
+    ///
+    /// @throws std::invalid_argument if a target or emitted species is not in the mechanism
+    ReducedMechanism Reduce(
+        const types::Mechanism& mechanism,
+        const std::vector<std::string>& target_species,
+        const std::vector<std::string>& emitted_species = {});
+  }  // namespace v1
+}  // namespace mechanism_configuration
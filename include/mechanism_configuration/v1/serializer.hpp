@@ -0,0 +1,43 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <mechanism_configuration/v1/types.hpp>
+#include <ostream>
+#include <string>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    enum class OutputFormat
+    {
+      Json,
+      Yaml
+    };
+
+    /// @brief Writes a mechanism as a v1 configuration
+    ///
+    /// The output is canonical: keys appear in a fixed order, reactions are grouped by type, optional values are
+    /// only written when set, and unknown properties are written as strings in sorted order. Numbers are written
+    /// with the fewest digits that read back exactly, so parsing the output gives back an identical mechanism.
+    /// The output is streamed as it is produced, without building a document in memory.
+    void WriteMechanism(const types::Mechanism& mechanism, std::ostream& stream, OutputFormat format);
+
+    /// @brief Writes a mechanism to a file, as JSON if the extension is .json and YAML otherwise
+    /// @throws std::runtime_error if the file cannot be written
+    void WriteMechanism(const types::Mechanism& mechanism, const std::filesystem::path& path);
+
+    /// @brief Returns a mechanism as a v1 configuration string
+    std::string ToString(const types::Mechanism& mechanism, OutputFormat format);
+
+    /// @brief Formats a number as a C++ expression of type double, for generated source
+    ///
+    /// Finite values are written with the fewest digits that read back exactly, as in WriteMechanism, and always
+    /// with a decimal point or exponent. NaN and infinities are written with std::numeric_limits.
+    std::string FormatCppNumber(double value);
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <map>
 #include <mechanism_configuration/mechanism.hpp>
 #include <optional>
@@ -327,6 +328,25 @@ namespace mechanism_configuration
         std::unordered_map<std::string, std::string> unknown_properties;
       };
 
+      /// @brief The kinds of reaction, in the same order as the members of Reactions
+      enum class ReactionType
+      {
+        Arrhenius,
+        Branched,
+        CondensedPhaseArrhenius,
+        CondensedPhasePhotolysis,
+        Emission,
+        FirstOrderLoss,
+        SimpolPhaseTransfer,
+        AqueousEquilibrium,
+        WetDeposition,
+        HenrysLaw,
+        Photolysis,
+        Surface,
+        Troe,
+        Tunneling
+      };
+
       struct Reactions
       {
         std::vector<v1::types::Arrhenius> arrhenius;
@@ -345,6 +365,138 @@ namespace mechanism_configuration
         std::vector<v1::types::Tunneling> tunneling;
       };
 
+      /// @brief Calls f(type, list) for every reaction list in reactions, in member order
+      template<typename ReactionsType, typename Func>
+      constexpr void ForEachReactionList(ReactionsType& reactions, Func&& f)
+      {
+        f(ReactionType::Arrhenius, reactions.arrhenius);
+        f(ReactionType::Branched, reactions.branched);
+        f(ReactionType::CondensedPhaseArrhenius, reactions.condensed_phase_arrhenius);
+        f(ReactionType::CondensedPhasePhotolysis, reactions.condensed_phase_photolysis);
+        f(ReactionType::Emission, reactions.emission);
+        f(ReactionType::FirstOrderLoss, reactions.first_order_loss);
+        f(ReactionType::SimpolPhaseTransfer, reactions.simpol_phase_transfer);
+        f(ReactionType::AqueousEquilibrium, reactions.aqueous_equilibrium);
+        f(ReactionType::WetDeposition, reactions.wet_deposition);
+        f(ReactionType::HenrysLaw, reactions.henrys_law);
+        f(ReactionType::Photolysis, reactions.photolysis);
+        f(ReactionType::Surface, reactions.surface);
+        f(ReactionType::Troe, reactions.troe);
+        f(ReactionType::Tunneling, reactions.tunneling);
+      }
+
+      /// @brief The number of reaction lists visited by ForEachReactionList
+      constexpr std::size_t NumberOfReactionLists()
+      {
+        Reactions reactions;
+        std::size_t count = 0;
+        ForEachReactionList(reactions, [&count](ReactionType, const auto&) { ++count; });
+        return count;
+      }
+
+      /// @brief Calls f(name) for every species a reaction refers to, including aerosol-phase water
+      template<typename ReactionT, typename Func>
+      void ForEachSpeciesName(const ReactionT& reaction, Func&& f)
+      {
+        auto each = [&f](const std::vector<ReactionComponent>& components)
+        {
+          for (const auto& component : components)
+          {
+            f(component.species_name);
+          }
+        };
+        if constexpr (requires { reaction.reactants; })
+          each(reaction.reactants);
+        if constexpr (requires { reaction.products; })
+          each(reaction.products);
+        if constexpr (requires { reaction.nitrate_products; })
+          each(reaction.nitrate_products);
+        if constexpr (requires { reaction.alkoxy_products; })
+          each(reaction.alkoxy_products);
+        if constexpr (requires { reaction.gas_phase_products; })
+          each(reaction.gas_phase_products);
+        if constexpr (requires { reaction.gas_phase_species.species_name; })
+          f(reaction.gas_phase_species.species_name);
+        else if constexpr (requires { reaction.gas_phase_species; })
+          f(reaction.gas_phase_species);
+        if constexpr (requires { reaction.aerosol_phase_species.species_name; })
+          f(reaction.aerosol_phase_species.species_name);
+        else if constexpr (requires { reaction.aerosol_phase_species; })
+          f(reaction.aerosol_phase_species);
+        if constexpr (requires { reaction.aerosol_phase_water; })
+          f(reaction.aerosol_phase_water);
+      }
+
+      /// @brief The part a species plays in a reaction
+      enum class ComponentRole
+      {
+        Reactant,
+        Product,
+        NitrateProduct,
+        AlkoxyProduct,
+        GasPhaseSpecies,
+        GasPhaseProduct,
+        AerosolPhaseSpecies,
+        AerosolPhaseWater
+      };
+
+      /// @brief Whether a species in this role is consumed in the reaction's forward direction
+      constexpr bool IsReactant(ComponentRole role)
+      {
+        return role == ComponentRole::Reactant || role == ComponentRole::GasPhaseSpecies;
+      }
+
+      /// @brief Whether a species in this role is produced in the reaction's forward direction. Aerosol-phase water
+      ///        is neither consumed nor produced.
+      constexpr bool IsProduct(ComponentRole role)
+      {
+        return !IsReactant(role) && role != ComponentRole::AerosolPhaseWater;
+      }
+
+      /// @brief Calls f(role, name, coefficient) for every species a reaction refers to. Species given by name
+      ///        alone have a coefficient of 1.
+      template<typename ReactionT, typename Func>
+      void ForEachComponent(const ReactionT& reaction, Func&& f)
+      {
+        auto each = [&f](ComponentRole role, const std::vector<ReactionComponent>& components)
+        {
+          for (const auto& component : components)
+          {
+            f(role, component.species_name, component.coefficient);
+          }
+        };
+        if constexpr (requires { reaction.reactants; })
+          each(ComponentRole::Reactant, reaction.reactants);
+        if constexpr (requires { reaction.products; })
+          each(ComponentRole::Product, reaction.products);
+        if constexpr (requires { reaction.nitrate_products; })
+          each(ComponentRole::NitrateProduct, reaction.nitrate_products);
+        if constexpr (requires { reaction.alkoxy_products; })
+          each(ComponentRole::AlkoxyProduct, reaction.alkoxy_products);
+        if constexpr (requires { reaction.gas_phase_products; })
+          each(ComponentRole::GasPhaseProduct, reaction.gas_phase_products);
+        if constexpr (requires { reaction.gas_phase_species.species_name; })
+          f(ComponentRole::GasPhaseSpecies, reaction.gas_phase_species.species_name, reaction.gas_phase_species.coefficient);
+        else if constexpr (requires { reaction.gas_phase_species; })
+          f(ComponentRole::GasPhaseSpecies, reaction.gas_phase_species, 1.0);
+        if constexpr (requires { reaction.aerosol_phase_species.species_name; })
+          f(ComponentRole::AerosolPhaseSpecies, reaction.aerosol_phase_species.species_name, reaction.aerosol_phase_species.coefficient);
+        else if constexpr (requires { reaction.aerosol_phase_species; })
+          f(ComponentRole::AerosolPhaseSpecies, reaction.aerosol_phase_species, 1.0);
+        if constexpr (requires { reaction.aerosol_phase_water; })
+          f(ComponentRole::AerosolPhaseWater, reaction.aerosol_phase_water, 1.0);
+      }
+
+      /// @brief Calls f(name) for every phase a reaction takes place in
+      template<typename ReactionT, typename Func>
+      void ForEachPhaseName(const ReactionT& reaction, Func&& f)
+      {
+        if constexpr (requires { reaction.gas_phase; })
+          f(reaction.gas_phase);
+        if constexpr (requires { reaction.aerosol_phase; })
+          f(reaction.aerosol_phase);
+      }
+
       struct Mechanism : public ::mechanism_configuration::Mechanism
       {
         /// @brief An identifier, optional
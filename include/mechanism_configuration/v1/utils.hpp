@@ -6,13 +6,17 @@
 
 #include <yaml-cpp/yaml.h>
 
+#include <array>
 #include <iostream>
 #include <mechanism_configuration/errors.hpp>
 #include <mechanism_configuration/parse_status.hpp>
+#include <mechanism_configuration/v1/phase_index.hpp>
 #include <mechanism_configuration/v1/types.hpp>
 #include <mechanism_configuration/v1/validation.hpp>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace mechanism_configuration
@@ -22,36 +26,64 @@ namespace mechanism_configuration
     class IReactionParser
     {
      public:
-      virtual Errors parse(
-          const YAML::Node& object,
-          const std::vector<v1::types::Species>& existing_species,
-          const std::vector<v1::types::Phase>& existing_phases,
-          v1::types::Reactions& reactions) = 0;
+      virtual Errors parse(const YAML::Node& object, const PhaseIndex& index, v1::types::Reactions& reactions) = 0;
       virtual ~IReactionParser() = default;
     };
 
+    /// @brief The text stored for a comment: the scalar itself, or the emitted YAML of a sequence or map
+    std::string CommentText(const YAML::Node& value);
+
     std::unordered_map<std::string, std::string> GetComments(const YAML::Node& object);
 
-    std::pair<Errors, std::vector<v1::types::Phase>> ParsePhases(const YAML::Node& objects, const std::vector<v1::types::Species> existing_species);
+    /// @brief Validates the top-level keys of a mechanism and reads its version and name
+    Errors ParseMechanismHeader(const YAML::Node& object, v1::types::Mechanism& mechanism);
+
+    std::pair<Errors, std::vector<v1::types::Phase>> ParsePhases(const YAML::Node& objects, const std::vector<v1::types::Species>& existing_species);
 
     std::pair<Errors, v1::types::ReactionComponent> ParseReactionComponent(const YAML::Node& object);
 
+    /// @brief Parses a sequence of reaction components, keeping those without errors
+    std::pair<Errors, std::vector<v1::types::ReactionComponent>> ParseReactionComponents(const YAML::Node& components);
+
     std::pair<Errors, std::vector<v1::types::ReactionComponent>> ParseReactantsOrProducts(const std::string& key, const YAML::Node& object);
 
+    /// @brief Parses a single reaction object, dispatching on its type, and appends it to reactions
+    Errors ParseReaction(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions);
+
+    /// @brief Parses a single reaction object against the given species and phases. Builds a PhaseIndex on
+    ///        every call; prefer the PhaseIndex overload when parsing more than one reaction.
+    Errors ParseReaction(
+        const YAML::Node& object,
+        const std::vector<types::Species>& existing_species,
+        const std::vector<types::Phase>& existing_phases,
+        types::Reactions& reactions);
+
+    /// @brief The position of each parsed reaction in the configuration, by reaction type and list index
+    using ReactionMarks = std::array<std::vector<YAML::Mark>, types::NumberOfReactionLists()>;
+
+    /// @brief Records mark as the position of every reaction added to reactions since marks was last updated
+    void RecordReactionMarks(const types::Reactions& reactions, const YAML::Mark& mark, ReactionMarks& marks);
+
+    /// @brief Reports each reaction that repeats an earlier one, with the same name, phases, species and rate
+    ///        parameters, as DuplicateReactionDetected at its recorded position
+    Errors FindDuplicateReactionErrors(const types::Reactions& reactions, const ReactionMarks& marks);
+
+    /// @brief Parses a list of reaction objects. Reactions that repeat an earlier reaction, with the same name,
+    ///        phases, species and rate parameters, are reported as DuplicateReactionDetected. Reactions given
+    ///        different names are taken to be distinct on purpose.
     std::pair<Errors, types::Reactions>
     ParseReactions(const YAML::Node& objects, const std::vector<types::Species>& existing_species, const std::vector<types::Phase>& existing_phases);
 
     template<typename T>
     bool ContainsUniqueObjectsByName(const std::vector<T>& collection)
     {
-      for (size_t i = 0; i < collection.size(); ++i)
+      std::unordered_set<std::string_view> names;
+      names.reserve(collection.size());
+      for (const auto& object : collection)
       {
-        for (size_t j = i + 1; j < collection.size(); ++j)
+        if (!names.insert(object.name).second)
         {
-          if (collection[i].name == collection[j].name)
-          {
-            return false;
-          }
+          return false;
         }
       }
       return true;
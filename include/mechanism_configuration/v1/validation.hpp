@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <mechanism_configuration/v1/types.hpp>
 #include <string>
 #include <vector>
 
@@ -153,6 +154,29 @@ namespace mechanism_configuration
         // aerosol-phase water
         // aerosol-phase species
       } keys;
+
+      /// @brief The configuration type key of a reaction type
+      inline const std::string& TypeKey(types::ReactionType type)
+      {
+        switch (type)
+        {
+          case types::ReactionType::Arrhenius: return keys.Arrhenius_key;
+          case types::ReactionType::Branched: return keys.Branched_key;
+          case types::ReactionType::CondensedPhaseArrhenius: return keys.CondensedPhaseArrhenius_key;
+          case types::ReactionType::CondensedPhasePhotolysis: return keys.CondensedPhasePhotolysis_key;
+          case types::ReactionType::Emission: return keys.Emission_key;
+          case types::ReactionType::FirstOrderLoss: return keys.FirstOrderLoss_key;
+          case types::ReactionType::SimpolPhaseTransfer: return keys.SimpolPhaseTransfer_key;
+          case types::ReactionType::AqueousEquilibrium: return keys.AqueousPhaseEquilibrium_key;
+          case types::ReactionType::WetDeposition: return keys.WetDeposition_key;
+          case types::ReactionType::HenrysLaw: return keys.HenrysLaw_key;
+          case types::ReactionType::Photolysis: return keys.Photolysis_key;
+          case types::ReactionType::Surface: return keys.Surface_key;
+          case types::ReactionType::Troe: return keys.Troe_key;
+          case types::ReactionType::Tunneling: return keys.Tunneling_key;
+        }
+        return keys.type;
+      }
     }  // namespace validation
   }  // namespace v1
 }  // namespace mechanism_configuration
\ No newline at end of file
@@ -1,5 +1,6 @@
 import pytest
-from mechanism_configuration import Parser, ReactionType
+import numpy as np
+from mechanism_configuration import ChangeKind, IncrementalParser, Mechanism, MechanismGraph, Parser, ReactionType, Reactions, diff, find_duplicate_reactions, reduce
 
 
 def test_parse_full_v1_configuration():
@@ -42,3 +43,183 @@ def test_parser_reports_bad_files():
         with pytest.raises(Exception):
             parser.parse(path)
 
+
+
+def test_incremental_parser_reuses_unchanged_reactions():
+    parser = IncrementalParser()
+    path = "examples/v1/full_configuration.yaml"
+    mechanism = parser.parse(path)
+    assert mechanism.name == "Full Configuration"
+    assert parser.reused_reaction_count == 0
+    mechanism = parser.parse(path)
+    assert len(mechanism.reactions) == 16
+    assert parser.reused_reaction_count == 16
+
+
+def test_mechanism_graph_reachability():
+    parser = Parser()
+    mechanism = parser.parse("examples/v1/full_configuration.yaml")
+    graph = MechanismGraph(mechanism)
+    assert graph.number_of_species == len(mechanism.species)
+    assert graph.number_of_reactions == len(mechanism.reactions)
+    everything = [species.name for species in mechanism.species]
+    assert sorted(graph.reachable_species(everything)) == sorted(everything)
+    assert graph.dead_species(everything) == []
+    assert graph.dead_reactions(everything) == []
+    for cycle in graph.cycles():
+        assert len(cycle.species) > 0
+
+
+def test_reduce_mechanism():
+    parser = Parser()
+    mechanism = parser.parse("examples/v1/full_configuration.yaml")
+    target = mechanism.species[0].name
+    reduced = reduce(mechanism, [target])
+    names = [species.name for species in reduced.mechanism.species]
+    assert target in names
+    assert len(reduced.species) == len(names)
+    for reduced_index, original_index in enumerate(reduced.species):
+        assert mechanism.species[original_index].name == names[reduced_index]
+    assert len(reduced.reactions) == len(reduced.mechanism.reactions)
+
+
+def test_diff_mechanisms():
+    parser = Parser()
+    before = parser.parse("examples/v1/full_configuration.yaml")
+    after = parser.parse("examples/v1/full_configuration.yaml")
+    assert diff(before, after).empty()
+    after.reactions.arrhenius[0].A = 1.0
+    changes = diff(before, after)
+    assert changes
+    assert len(changes.reactions) == 1
+    assert changes.reactions[0].kind == ChangeKind.Modified
+    assert changes.reactions[0].parameters[0].name == "A"
+    assert changes.reactions[0].parameters[0].after == 1.0
+    assert changes.report().startswith("~ ARRHENIUS")
+
+
+def test_find_duplicate_reactions():
+    parser = Parser()
+    mechanism = parser.parse("examples/v1/full_configuration.yaml")
+    duplicates = find_duplicate_reactions(mechanism.reactions)
+    # the two Arrhenius reactions share their species but not their parameters
+    arrhenius = [d for d in duplicates if d.duplicate.type == ReactionType.Arrhenius]
+    assert len(arrhenius) == 1
+    assert not arrhenius[0].identical_parameters
+
+
+def test_reaction_parameter_views():
+    parser = Parser()
+    mechanism = parser.parse("examples/v1/full_configuration.yaml")
+    reactions = mechanism.reactions
+    params = reactions.arrhenius_params
+    assert params.shape == (len(reactions.arrhenius), 5)
+    for row, reaction in zip(params, reactions.arrhenius):
+        assert list(row) == [reaction.A, reaction.B, reaction.C, reaction.D, reaction.E]
+    params[0, 0] = 42.0
+    assert reactions.arrhenius[0].A == 42.0
+    assert reactions.troe_params.shape == (len(reactions.troe), 8)
+    assert reactions.simpol_phase_transfer_params.shape == (len(reactions.simpol_phase_transfer), 4)
+    assert reactions.photolysis_params.shape == (len(reactions.photolysis),)
+    assert np.array_equal(reactions.emission_params, [r.scaling_factor for r in reactions.emission])
+    assert Reactions().tunneling_params.shape == (0, 3)
+
+
+def test_reaction_lists_cannot_be_replaced_under_views():
+    parser = Parser()
+    mechanism = parser.parse("examples/v1/full_configuration.yaml")
+    reactions = mechanism.reactions
+    params = reactions.arrhenius_params
+    column = params[:, 0]
+    with pytest.raises(ValueError):
+        reactions.arrhenius = []
+    with pytest.raises(ValueError):
+        mechanism.reactions = Reactions()
+    assert len(reactions.arrhenius) == params.shape[0]
+    del params
+    with pytest.raises(ValueError):
+        reactions.troe = []
+    del column
+    reactions.arrhenius = []
+    assert reactions.arrhenius_params.shape == (0, 5)
+    mechanism.reactions = Reactions()
+    assert len(mechanism.reactions) == 0
+
+
+def test_reactions_random_access():
+    parser = Parser()
+    mechanism = parser.parse("examples/v1/full_configuration.yaml")
+    reactions = mechanism.reactions
+    iterated = list(reactions)
+    assert len(iterated) == len(reactions)
+    for i, reaction in enumerate(iterated):
+        assert type(reactions[i]) is type(reaction)
+        assert reactions[i].name == reaction.name
+    assert reactions[-1].name == iterated[-1].name
+    with pytest.raises(IndexError):
+        reactions[len(reactions)]
+    first = reactions[0]
+    original_name = first.name
+    first.name = "renamed"
+    assert reactions[0].name == original_name
+    reactions.arrhenius = []
+    assert first.name == "renamed"
+
+
+def test_parse_many():
+    parser = Parser()
+    paths = [f"examples/v1/full_configuration{extension}" for extension in [".yaml", ".json"]] * 4
+    mechanisms = parser.parse_many(paths, max_workers=3)
+    assert len(mechanisms) == len(paths)
+    for mechanism in mechanisms:
+        assert mechanism.name == "Full Configuration"
+        assert len(mechanism.reactions) == 16
+    with pytest.raises(RuntimeError):
+        parser.parse_many(["examples/v1/full_configuration.yaml", "missing.yaml"])
+
+
+def test_parse_from_threads():
+    from concurrent.futures import ThreadPoolExecutor
+    parser = Parser()
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        mechanisms = list(executor.map(lambda _: parser.parse("examples/v1/full_configuration.json"), range(8)))
+    assert all(len(mechanism.species) == 11 for mechanism in mechanisms)
+
+
+def test_pickle_mechanism():
+    import pickle
+    parser = Parser()
+    mechanism = parser.parse("examples/v1/full_configuration.yaml")
+    restored = pickle.loads(pickle.dumps(mechanism))
+    assert restored.name == mechanism.name
+    assert len(restored.species) == len(mechanism.species)
+    assert len(restored.reactions) == len(mechanism.reactions)
+    assert restored.reactions.arrhenius[0].A == mechanism.reactions.arrhenius[0].A
+    assert restored.to_bytes() == mechanism.to_bytes()
+
+
+def test_mechanism_in_shared_memory():
+    parser = Parser()
+    mechanism = parser.parse("examples/v1/full_configuration.yaml")
+    shared_memory, size = mechanism.to_shared_memory()
+    try:
+        attached = Mechanism.from_shared_memory(shared_memory.name, size)
+        assert attached.to_bytes() == mechanism.to_bytes()
+        assert Mechanism.from_buffer(shared_memory.buf[:size]).name == mechanism.name
+    finally:
+        shared_memory.close()
+        shared_memory.unlink()
+    with pytest.raises(ValueError):
+        Mechanism.from_buffer(b"not a mechanism")
+
+
+def test_write_mechanism(tmp_path):
+    parser = Parser()
+    mechanism = parser.parse("examples/v1/full_configuration.yaml")
+    for extension in [".yaml", ".json"]:
+        path = str(tmp_path / f"written{extension}")
+        mechanism.write(path)
+        written = parser.parse(path)
+        assert written.to_yaml() == mechanism.to_yaml()
+        assert written.to_json() == mechanism.to_json()
+
@@ -1,87 +1,255 @@
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <mechanism_configuration/parser.hpp>
+#include <mechanism_configuration/v1/binary_format.hpp>
+#include <mechanism_configuration/v1/diff.hpp>
+#include <mechanism_configuration/v1/incremental_parser.hpp>
+#include <mechanism_configuration/v1/mechanism_graph.hpp>
 #include <mechanism_configuration/v1/parser.hpp>
+#include <mechanism_configuration/v1/reaction_descriptors.hpp>
+#include <mechanism_configuration/v1/reaction_hash.hpp>
+#include <mechanism_configuration/v1/reduction.hpp>
+#include <mechanism_configuration/v1/serializer.hpp>
 #include <mechanism_configuration/v1/types.hpp>
-#include <variant>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <type_traits>
+#include <unordered_map>
 
 namespace py = pybind11;
 using namespace mechanism_configuration::v1::types;
 
-enum class ReactionType
+/// @brief The number of live parameter views into each Reactions object
+///
+/// A view points into the storage of a reaction list, so replacing the list while a view is alive would leave
+/// the view reading and writing freed memory. The list setters refuse to run while this count is non-zero.
+std::unordered_map<const Reactions *, std::size_t> &LiveParameterViews()
 {
-  Arrhenius,
-  Branched,
-  CondensedPhaseArrhenius,
-  CondensedPhasePhotolysis,
-  Emission,
-  FirstOrderLoss,
-  SimpolPhaseTransfer,
-  AqueousEquilibrium,
-  WetDeposition,
-  HenrysLaw,
-  Photolysis,
-  Surface,
-  Troe,
-  Tunneling
-};
+  static std::unordered_map<const Reactions *, std::size_t> live;
+  return live;
+}
+
+/// @throws py::value_error if a parameter view into reactions is alive
+void CheckNoLiveParameterViews(const Reactions &reactions, const std::string &attribute)
+{
+  if (LiveParameterViews().count(&reactions) > 0)
+  {
+    throw py::value_error(
+        "Cannot replace " + attribute + " while NumPy views of its reaction parameters are alive. Delete the views first; " +
+        "numpy.array(view) makes a copy that does not refer to the reactions.");
+  }
+}
+
+/// @brief The base object of a parameter view, which keeps owner alive and counts the view as live until the
+///        view is destroyed
+py::capsule ParameterViewBase(const Reactions &reactions, py::handle owner)
+{
+  struct Base
+  {
+    const Reactions *reactions;
+    py::object owner;
+  };
+  ++LiveParameterViews()[&reactions];
+  return py::capsule(
+      new Base{ &reactions, py::reinterpret_borrow<py::object>(owner) },
+      [](void *pointer)
+      {
+        auto *base = static_cast<Base *>(pointer);
+        auto it = LiveParameterViews().find(base->reactions);
+        if (--it->second == 0)
+        {
+          LiveParameterViews().erase(it);
+        }
+        delete base;
+      });
+}
+
+/// @brief Returns a writable (rows, Columns) array of doubles, laid out with a fixed stride between rows, that
+///        is kept valid by base
+template<std::size_t Columns>
+py::array StridedView(std::size_t rows, std::size_t row_stride, double *first, py::handle base)
+{
+  std::vector<py::ssize_t> shape{ static_cast<py::ssize_t>(rows) };
+  std::vector<py::ssize_t> strides{ static_cast<py::ssize_t>(row_stride) };
+  if constexpr (Columns > 1)
+  {
+    shape.push_back(Columns);
+    strides.push_back(sizeof(double));
+  }
+  return py::array(py::dtype::of<double>(), shape, strides, first, base);
+}
+
+/// @brief Views the parameters of each reaction of a list in self, a Reactions object, without copying
+///
+/// The parameters must be consecutive double members starting at first, so that they are not separated by
+/// padding. The view keeps self alive, and the list cannot be replaced while the view exists.
+template<std::size_t Columns, typename T>
+py::array ParameterView(py::object self, std::vector<T> Reactions::*list, double T::*first)
+{
+  auto &reactions = self.cast<Reactions &>();
+  auto &reaction_list = reactions.*list;
+  if (reaction_list.empty())
+  {
+    std::vector<py::ssize_t> shape{ 0 };
+    if constexpr (Columns > 1)
+      shape.push_back(Columns);
+    return py::array(py::dtype::of<double>(), shape, std::vector<py::ssize_t>{});
+  }
+  return StridedView<Columns>(reaction_list.size(), sizeof(T), &(reaction_list.front().*first), ParameterViewBase(reactions, self));
+}
+
+template<std::size_t Columns, typename T>
+py::array ParameterView(py::object self, std::vector<T> Reactions::*list, std::array<double, Columns> T::*parameters)
+{
+  auto &reactions = self.cast<Reactions &>();
+  auto &reaction_list = reactions.*list;
+  if (reaction_list.empty())
+  {
+    return py::array(py::dtype::of<double>(), std::vector<py::ssize_t>{ 0, Columns }, std::vector<py::ssize_t>{});
+  }
+  return StridedView<Columns>(reaction_list.size(), sizeof(T), (reaction_list.front().*parameters).data(), ParameterViewBase(reactions, self));
+}
+
+/// @brief Binds a reaction list of Reactions as an attribute whose setter refuses to run while a parameter
+///        view of the reactions is alive
+template<typename T>
+void BindReactionList(py::class_<Reactions> &cls, const char *name, std::vector<T> Reactions::*list)
+{
+  cls.def_property(
+      name,
+      [list](const Reactions &self) { return self.*list; },
+      [list, name](Reactions &self, std::vector<T> value)
+      {
+        CheckNoLiveParameterViews(self, std::string("Reactions.") + name);
+        self.*list = std::move(value);
+      });
+}
+
+/// @brief Calls f(list) for the list of reactions at position type in types::Reactions
+template<typename Func>
+void VisitReactionList(Reactions &reactions, std::size_t type, Func &&f)
+{
+  ForEachReactionList(
+      reactions,
+      [&](ReactionType list_type, auto &list)
+      {
+        if (static_cast<std::size_t>(list_type) == type)
+        {
+          f(list);
+        }
+      });
+}
 
+std::size_t NumberOfReactions(const Reactions &reactions)
+{
+  std::size_t size = 0;
+  ForEachReactionList(reactions, [&](ReactionType, const auto &list) { size += list.size(); });
+  return size;
+}
+
+/// @brief Returns a Python copy of one reaction
+///
+/// A reference into the list would dangle once the list or the reactions were replaced, so each reaction is
+/// copied, as the reaction lists are.
+py::object CastReaction(Reactions &reactions, std::size_t type, std::size_t index)
+{
+  py::object reaction;
+  VisitReactionList(reactions, type, [&](const auto &list) { reaction = py::cast(list[index]); });
+  return reaction;
+}
+
+/// @brief Iterates over the reactions of every type in place, holding only the position of the next reaction
 struct ReactionsIterator
 {
-  using VariantType = std::variant<
-      Arrhenius,
-      Branched,
-      CondensedPhaseArrhenius,
-      CondensedPhasePhotolysis,
-      Emission,
-      FirstOrderLoss,
-      SimpolPhaseTransfer,
-      AqueousEquilibrium,
-      WetDeposition,
-      HenrysLaw,
-      Photolysis,
-      Surface,
-      Troe,
-      Tunneling>;
-
-  std::vector<std::vector<VariantType>> reaction_lists;
-  size_t outer_index = 0;
-  size_t inner_index = 0;
-
-  ReactionsIterator(Reactions &reactions)
-      : reaction_lists{ std::vector<VariantType>(reactions.arrhenius.begin(), reactions.arrhenius.end()),
-                        std::vector<VariantType>(reactions.branched.begin(), reactions.branched.end()),
-                        std::vector<VariantType>(reactions.condensed_phase_arrhenius.begin(), reactions.condensed_phase_arrhenius.end()),
-                        std::vector<VariantType>(reactions.condensed_phase_photolysis.begin(), reactions.condensed_phase_photolysis.end()),
-                        std::vector<VariantType>(reactions.emission.begin(), reactions.emission.end()),
-                        std::vector<VariantType>(reactions.first_order_loss.begin(), reactions.first_order_loss.end()),
-                        std::vector<VariantType>(reactions.simpol_phase_transfer.begin(), reactions.simpol_phase_transfer.end()),
-                        std::vector<VariantType>(reactions.aqueous_equilibrium.begin(), reactions.aqueous_equilibrium.end()),
-                        std::vector<VariantType>(reactions.wet_deposition.begin(), reactions.wet_deposition.end()),
-                        std::vector<VariantType>(reactions.henrys_law.begin(), reactions.henrys_law.end()),
-                        std::vector<VariantType>(reactions.photolysis.begin(), reactions.photolysis.end()),
-                        std::vector<VariantType>(reactions.surface.begin(), reactions.surface.end()),
-                        std::vector<VariantType>(reactions.troe.begin(), reactions.troe.end()),
-                        std::vector<VariantType>(reactions.tunneling.begin(), reactions.tunneling.end()) }
+  Reactions &reactions;
+  /// @brief The Python object owning reactions, kept alive by the binding of __iter__
+  py::handle owner;
+  std::size_t type_index = 0;
+  std::size_t element_index = 0;
+
+  ReactionsIterator(Reactions &reactions, py::handle owner)
+      : reactions(reactions),
+        owner(owner)
   {
   }
 
   py::object next()
   {
-    while (outer_index < reaction_lists.size())
+    while (type_index < NumberOfReactionLists())
     {
-      const auto &vec = reaction_lists[outer_index];
-      if (inner_index < vec.size())
+      std::size_t size = 0;
+      VisitReactionList(reactions, type_index, [&](const auto &list) { size = list.size(); });
+      if (element_index < size)
       {
-        return std::visit([](auto &&arg) { return py::cast(arg); }, vec[inner_index++]);
+        return CastReaction(reactions, type_index, element_index++);
       }
-      ++outer_index;
-      inner_index = 0;
+      ++type_index;
+      element_index = 0;
     }
     throw py::stop_iteration();
   }
 };
 
+/// @brief Reads a binary mechanism directly from a Python buffer, without copying it into a bytes object first
+Mechanism ReadBinaryBuffer(py::buffer buffer)
+{
+  py::buffer_info info = buffer.request();
+  if (info.ndim != 1 || info.itemsize != 1)
+  {
+    throw py::value_error("A binary mechanism must be a one-dimensional buffer of bytes");
+  }
+  try
+  {
+    return mechanism_configuration::v1::ReadBinary({ static_cast<const std::byte *>(info.ptr), static_cast<std::size_t>(info.size) });
+  }
+  catch (const std::invalid_argument &e)
+  {
+    throw py::value_error(e.what());
+  }
+}
+
+[[noreturn]] void ThrowParseErrors(const std::string &path, const mechanism_configuration::Errors &errors)
+{
+  std::string error = "Error parsing file: " + path + "\n";
+  for (auto &e : errors)
+  {
+    error += e.to_string() + "\n";
+  }
+  throw std::runtime_error(error);
+}
+
+/// @brief Binds a reaction type, with an attribute for each field of its descriptor plus its name, unknown
+///        properties and type
+template<typename T>
+py::class_<T> BindReaction(py::module_ &m, const char *name)
+{
+  using mechanism_configuration::v1::ReactionDescriptor;
+  namespace descriptors = mechanism_configuration::v1::descriptors;
+
+  py::class_<T> cls(m, name);
+  cls.def(py::init<>());
+  mechanism_configuration::v1::ForEachField(
+      ReactionDescriptor<T>::fields,
+      [&cls](const auto &field)
+      {
+        if constexpr (std::decay_t<decltype(field)>::kind != descriptors::FieldKind::Option)
+        {
+          cls.def_readwrite(field.attribute, field.member);
+        }
+      });
+  std::string repr_prefix = std::string("<") + name + ": ";
+  cls.def_readwrite("name", &T::name)
+      .def_readwrite("unknown_properties", &T::unknown_properties)
+      .def("__str__", [](const T &r) { return r.name; })
+      .def("__repr__", [repr_prefix](const T &r) { return repr_prefix + r.name + ">"; })
+      .def_property_readonly("type", [](const T &) { return ReactionDescriptor<T>::type; });
+  return cls;
+}
+
 PYBIND11_MODULE(mechanism_configuration, m)
 {
   py::enum_<ReactionType>(m, "ReactionType")
@@ -131,227 +299,123 @@ PYBIND11_MODULE(mechanism_configuration, m)
       .def("__str__", [](const ReactionComponent &rc) { return rc.species_name; })
       .def("__repr__", [](const ReactionComponent &rc) { return "<ReactionComponent: " + rc.species_name + ">"; });
 
-  py::class_<Arrhenius>(m, "Arrhenius")
-      .def(py::init<>())
-      .def_readwrite("A", &Arrhenius::A)
-      .def_readwrite("B", &Arrhenius::B)
-      .def_readwrite("C", &Arrhenius::C)
-      .def_readwrite("D", &Arrhenius::D)
-      .def_readwrite("E", &Arrhenius::E)
-      .def_readwrite("reactants", &Arrhenius::reactants)
-      .def_readwrite("products", &Arrhenius::products)
-      .def_readwrite("name", &Arrhenius::name)
-      .def_readwrite("gas_phase", &Arrhenius::gas_phase)
-      .def_readwrite("unknown_properties", &Arrhenius::unknown_properties)
-      .def("__str__", [](const Arrhenius &a) { return a.name; })
-      .def("__repr__", [](const Arrhenius &a) { return "<Arrhenius: " + a.name + ">"; })
-      .def_property_readonly("type", [](const Arrhenius &) { return ReactionType::Arrhenius; });
-
-  py::class_<CondensedPhaseArrhenius>(m, "CondensedPhaseArrhenius")
-      .def(py::init<>())
-      .def_readwrite("A", &CondensedPhaseArrhenius::A)
-      .def_readwrite("B", &CondensedPhaseArrhenius::B)
-      .def_readwrite("C", &CondensedPhaseArrhenius::C)
-      .def_readwrite("D", &CondensedPhaseArrhenius::D)
-      .def_readwrite("E", &CondensedPhaseArrhenius::E)
-      .def_readwrite("reactants", &CondensedPhaseArrhenius::reactants)
-      .def_readwrite("products", &CondensedPhaseArrhenius::products)
-      .def_readwrite("name", &CondensedPhaseArrhenius::name)
-      .def_readwrite("aerosol_phase", &CondensedPhaseArrhenius::aerosol_phase)
-      .def_readwrite("aerosol_phase_water", &CondensedPhaseArrhenius::aerosol_phase_water)
-      .def_readwrite("unknown_properties", &CondensedPhaseArrhenius::unknown_properties)
-      .def("__str__", [](const CondensedPhaseArrhenius &cpa) { return cpa.name; })
-      .def("__repr__", [](const CondensedPhaseArrhenius &cpa) { return "<CondensedPhaseArrhenius: " + cpa.name + ">"; })
-      .def_property_readonly("type", [](const CondensedPhaseArrhenius &) { return ReactionType::CondensedPhaseArrhenius; });
-
-  py::class_<Troe>(m, "Troe")
-      .def(py::init<>())
-      .def_readwrite("k0_A", &Troe::k0_A)
-      .def_readwrite("k0_B", &Troe::k0_B)
-      .def_readwrite("k0_C", &Troe::k0_C)
-      .def_readwrite("kinf_A", &Troe::kinf_A)
-      .def_readwrite("kinf_B", &Troe::kinf_B)
-      .def_readwrite("kinf_C", &Troe::kinf_C)
-      .def_readwrite("Fc", &Troe::Fc)
-      .def_readwrite("N", &Troe::N)
-      .def_readwrite("reactants", &Troe::reactants)
-      .def_readwrite("products", &Troe::products)
-      .def_readwrite("name", &Troe::name)
-      .def_readwrite("gas_phase", &Troe::gas_phase)
-      .def_readwrite("unknown_properties", &Troe::unknown_properties)
-      .def("__str__", [](const Troe &t) { return t.name; })
-      .def("__repr__", [](const Troe &t) { return "<Troe: " + t.name + ">"; })
-      .def_property_readonly("type", [](const Troe &) { return ReactionType::Troe; });
-
-  py::class_<Branched>(m, "Branched")
-      .def(py::init<>())
-      .def_readwrite("X", &Branched::X)
-      .def_readwrite("Y", &Branched::Y)
-      .def_readwrite("a0", &Branched::a0)
-      .def_readwrite("n", &Branched::n)
-      .def_readwrite("reactants", &Branched::reactants)
-      .def_readwrite("nitrate_products", &Branched::nitrate_products)
-      .def_readwrite("alkoxy_products", &Branched::alkoxy_products)
-      .def_readwrite("name", &Branched::name)
-      .def_readwrite("gas_phase", &Branched::gas_phase)
-      .def_readwrite("unknown_properties", &Branched::unknown_properties)
-      .def("__str__", [](const Branched &b) { return b.name; })
-      .def("__repr__", [](const Branched &b) { return "<Branched: " + b.name + ">"; })
-      .def_property_readonly("type", [](const Branched &) { return ReactionType::Branched; });
-
-  py::class_<Tunneling>(m, "Tunneling")
-      .def(py::init<>())
-      .def_readwrite("A", &Tunneling::A)
-      .def_readwrite("B", &Tunneling::B)
-      .def_readwrite("C", &Tunneling::C)
-      .def_readwrite("reactants", &Tunneling::reactants)
-      .def_readwrite("products", &Tunneling::products)
-      .def_readwrite("name", &Tunneling::name)
-      .def_readwrite("gas_phase", &Tunneling::gas_phase)
-      .def_readwrite("unknown_properties", &Tunneling::unknown_properties)
-      .def("__str__", [](const Tunneling &t) { return t.name; })
-      .def("__repr__", [](const Tunneling &t) { return "<Tunneling: " + t.name + ">"; })
-      .def_property_readonly("type", [](const Tunneling &) { return ReactionType::Tunneling; });
-
-  py::class_<Surface>(m, "Surface")
-      .def(py::init<>())
-      .def_readwrite("reaction_probability", &Surface::reaction_probability)
-      .def_readwrite("gas_phase_species", &Surface::gas_phase_species)
-      .def_readwrite("gas_phase_products", &Surface::gas_phase_products)
-      .def_readwrite("name", &Surface::name)
-      .def_readwrite("gas_phase", &Surface::gas_phase)
-      .def_readwrite("aerosol_phase", &Surface::aerosol_phase)
-      .def_readwrite("unknown_properties", &Surface::unknown_properties)
-      .def("__str__", [](const Surface &s) { return s.name; })
-      .def("__repr__", [](const Surface &s) { return "<Surface: " + s.name + ">"; })
-      .def_property_readonly("type", [](const Surface &) { return ReactionType::Surface; });
-
-  py::class_<Photolysis>(m, "Photolysis")
-      .def(py::init<>())
-      .def_readwrite("scaling_factor", &Photolysis::scaling_factor)
-      .def_readwrite("reactants", &Photolysis::reactants)
-      .def_readwrite("products", &Photolysis::products)
-      .def_readwrite("name", &Photolysis::name)
-      .def_readwrite("gas_phase", &Photolysis::gas_phase)
-      .def_readwrite("unknown_properties", &Photolysis::unknown_properties)
-      .def("__str__", [](const Photolysis &p) { return p.name; })
-      .def("__repr__", [](const Photolysis &p) { return "<Photolysis: " + p.name + ">"; })
-      .def_property_readonly("type", [](const Photolysis &) { return ReactionType::Photolysis; });
-
-  py::class_<CondensedPhasePhotolysis>(m, "CondensedPhasePhotolysis")
-      .def(py::init<>())
-      .def_readwrite("scaling_factor_", &CondensedPhasePhotolysis::scaling_factor_)
-      .def_readwrite("reactants", &CondensedPhasePhotolysis::reactants)
-      .def_readwrite("products", &CondensedPhasePhotolysis::products)
-      .def_readwrite("name", &CondensedPhasePhotolysis::name)
-      .def_readwrite("aerosol_phase", &CondensedPhasePhotolysis::aerosol_phase)
-      .def_readwrite("aerosol_phase_water", &CondensedPhasePhotolysis::aerosol_phase_water)
-      .def_readwrite("unknown_properties", &CondensedPhasePhotolysis::unknown_properties)
-      .def("__str__", [](const CondensedPhasePhotolysis &cpp) { return cpp.name; })
-      .def("__repr__", [](const CondensedPhasePhotolysis &cpp) { return "<CondensedPhasePhotolysis: " + cpp.name + ">"; })
-      .def_property_readonly("type", [](const CondensedPhasePhotolysis &) { return ReactionType::CondensedPhasePhotolysis; });
-
-  py::class_<Emission>(m, "Emission")
-      .def(py::init<>())
-      .def_readwrite("scaling_factor", &Emission::scaling_factor)
-      .def_readwrite("products", &Emission::products)
-      .def_readwrite("name", &Emission::name)
-      .def_readwrite("gas_phase", &Emission::gas_phase)
-      .def_readwrite("unknown_properties", &Emission::unknown_properties)
-      .def("__str__", [](const Emission &e) { return e.name; })
-      .def("__repr__", [](const Emission &e) { return "<Emission: " + e.name + ">"; })
-      .def_property_readonly("type", [](const Emission &) { return ReactionType::Emission; });
-
-  py::class_<FirstOrderLoss>(m, "FirstOrderLoss")
-      .def(py::init<>())
-      .def_readwrite("scaling_factor", &FirstOrderLoss::scaling_factor)
-      .def_readwrite("reactants", &FirstOrderLoss::reactants)
-      .def_readwrite("name", &FirstOrderLoss::name)
-      .def_readwrite("gas_phase", &FirstOrderLoss::gas_phase)
-      .def_readwrite("unknown_properties", &FirstOrderLoss::unknown_properties)
-      .def("__str__", [](const FirstOrderLoss &fol) { return fol.name; })
-      .def("__repr__", [](const FirstOrderLoss &fol) { return "<FirstOrderLoss: " + fol.name + ">"; })
-      .def_property_readonly("type", [](const FirstOrderLoss &) { return ReactionType::FirstOrderLoss; });
-
-  py::class_<AqueousEquilibrium>(m, "AqueousEquilibrium")
-      .def(py::init<>())
-      .def_readwrite("name", &AqueousEquilibrium::name)
-      .def_readwrite("gas_phase", &AqueousEquilibrium::gas_phase)
-      .def_readwrite("aerosol_phase", &AqueousEquilibrium::aerosol_phase)
-      .def_readwrite("aerosol_phase_water", &AqueousEquilibrium::aerosol_phase_water)
-      .def_readwrite("reactants", &AqueousEquilibrium::reactants)
-      .def_readwrite("products", &AqueousEquilibrium::products)
-      .def_readwrite("A", &AqueousEquilibrium::A)
-      .def_readwrite("C", &AqueousEquilibrium::C)
-      .def_readwrite("k_reverse", &AqueousEquilibrium::k_reverse)
-      .def_readwrite("unknown_properties", &AqueousEquilibrium::unknown_properties)
-      .def("__str__", [](const AqueousEquilibrium &ae) { return ae.name; })
-      .def("__repr__", [](const AqueousEquilibrium &ae) { return "<AqueousEquilibrium: " + ae.name + ">"; })
-      .def_property_readonly("type", [](const AqueousEquilibrium &) { return ReactionType::AqueousEquilibrium; });
-
-  py::class_<WetDeposition>(m, "WetDeposition")
-      .def(py::init<>())
-      .def_readwrite("scaling_factor", &WetDeposition::scaling_factor)
-      .def_readwrite("name", &WetDeposition::name)
-      .def_readwrite("aerosol_phase", &WetDeposition::aerosol_phase)
-      .def_readwrite("unknown_properties", &WetDeposition::unknown_properties)
-      .def("__str__", [](const WetDeposition &wd) { return wd.name; })
-      .def("__repr__", [](const WetDeposition &wd) { return "<WetDeposition: " + wd.name + ">"; })
-      .def_property_readonly("type", [](const WetDeposition &) { return ReactionType::WetDeposition; });
-
-  py::class_<HenrysLaw>(m, "HenrysLaw")
-      .def(py::init<>())
-      .def_readwrite("name", &HenrysLaw::name)
-      .def_readwrite("gas_phase", &HenrysLaw::gas_phase)
-      .def_readwrite("gas_phase_species", &HenrysLaw::gas_phase_species)
-      .def_readwrite("aerosol_phase", &HenrysLaw::aerosol_phase)
-      .def_readwrite("aerosol_phase_water", &HenrysLaw::aerosol_phase_water)
-      .def_readwrite("aerosol_phase_species", &HenrysLaw::aerosol_phase_species)
-      .def_readwrite("unknown_properties", &HenrysLaw::unknown_properties)
-      .def("__str__", [](const HenrysLaw &hl) { return hl.name; })
-      .def("__repr__", [](const HenrysLaw &hl) { return "<HenrysLaw: " + hl.name + ">"; })
-      .def_property_readonly("type", [](const HenrysLaw &) { return ReactionType::HenrysLaw; });
-
-  py::class_<SimpolPhaseTransfer>(m, "SimpolPhaseTransfer")
-      .def(py::init<>())
-      .def_readwrite("gas_phase", &SimpolPhaseTransfer::gas_phase)
-      .def_readwrite("gas_phase_species", &SimpolPhaseTransfer::gas_phase_species)
-      .def_readwrite("aerosol_phase", &SimpolPhaseTransfer::aerosol_phase)
-      .def_readwrite("aerosol_phase_species", &SimpolPhaseTransfer::aerosol_phase_species)
-      .def_readwrite("name", &SimpolPhaseTransfer::name)
-      .def_readwrite("B", &SimpolPhaseTransfer::B)
-      .def_readwrite("unknown_properties", &SimpolPhaseTransfer::unknown_properties)
-      .def("__str__", [](const SimpolPhaseTransfer &spt) { return spt.name; })
-      .def("__repr__", [](const SimpolPhaseTransfer &spt) { return "<SimpolPhaseTransfer: " + spt.name + ">"; })
-      .def_property_readonly("type", [](const SimpolPhaseTransfer &) { return ReactionType::SimpolPhaseTransfer; });
-
-  py::class_<Reactions>(m, "Reactions")
-      .def(py::init<>())
-      .def_readwrite("arrhenius", &Reactions::arrhenius)
-      .def_readwrite("branched", &Reactions::branched)
-      .def_readwrite("condensed_phase_arrhenius", &Reactions::condensed_phase_arrhenius)
-      .def_readwrite("condensed_phase_photolysis", &Reactions::condensed_phase_photolysis)
-      .def_readwrite("emission", &Reactions::emission)
-      .def_readwrite("first_order_loss", &Reactions::first_order_loss)
-      .def_readwrite("simpol_phase_transfer", &Reactions::simpol_phase_transfer)
-      .def_readwrite("aqueous_equilibrium", &Reactions::aqueous_equilibrium)
-      .def_readwrite("wet_deposition", &Reactions::wet_deposition)
-      .def_readwrite("henrys_law", &Reactions::henrys_law)
-      .def_readwrite("photolysis", &Reactions::photolysis)
-      .def_readwrite("surface", &Reactions::surface)
-      .def_readwrite("troe", &Reactions::troe)
-      .def_readwrite("tunneling", &Reactions::tunneling)
+  BindReaction<Arrhenius>(m, "Arrhenius");
+  BindReaction<CondensedPhaseArrhenius>(m, "CondensedPhaseArrhenius");
+  BindReaction<Troe>(m, "Troe");
+  BindReaction<Branched>(m, "Branched");
+  BindReaction<Tunneling>(m, "Tunneling");
+  BindReaction<Surface>(m, "Surface");
+  BindReaction<Photolysis>(m, "Photolysis");
+  BindReaction<CondensedPhasePhotolysis>(m, "CondensedPhasePhotolysis");
+  BindReaction<Emission>(m, "Emission");
+  BindReaction<FirstOrderLoss>(m, "FirstOrderLoss");
+  BindReaction<AqueousEquilibrium>(m, "AqueousEquilibrium").def_readwrite("gas_phase", &AqueousEquilibrium::gas_phase);
+  BindReaction<WetDeposition>(m, "WetDeposition");
+  BindReaction<HenrysLaw>(m, "HenrysLaw");
+  BindReaction<SimpolPhaseTransfer>(m, "SimpolPhaseTransfer");
+
+  py::class_<Reactions> reactions(m, "Reactions");
+  reactions.def(py::init<>());
+  BindReactionList(reactions, "arrhenius", &Reactions::arrhenius);
+  BindReactionList(reactions, "branched", &Reactions::branched);
+  BindReactionList(reactions, "condensed_phase_arrhenius", &Reactions::condensed_phase_arrhenius);
+  BindReactionList(reactions, "condensed_phase_photolysis", &Reactions::condensed_phase_photolysis);
+  BindReactionList(reactions, "emission", &Reactions::emission);
+  BindReactionList(reactions, "first_order_loss", &Reactions::first_order_loss);
+  BindReactionList(reactions, "simpol_phase_transfer", &Reactions::simpol_phase_transfer);
+  BindReactionList(reactions, "aqueous_equilibrium", &Reactions::aqueous_equilibrium);
+  BindReactionList(reactions, "wet_deposition", &Reactions::wet_deposition);
+  BindReactionList(reactions, "henrys_law", &Reactions::henrys_law);
+  BindReactionList(reactions, "photolysis", &Reactions::photolysis);
+  BindReactionList(reactions, "surface", &Reactions::surface);
+  BindReactionList(reactions, "troe", &Reactions::troe);
+  BindReactionList(reactions, "tunneling", &Reactions::tunneling);
+  reactions
+      .def_property_readonly(
+          "arrhenius_params",
+          [](py::object self) { return ParameterView<5>(self, &Reactions::arrhenius, &Arrhenius::A); },
+          "Columns A, B, C, D, E")
+      .def_property_readonly(
+          "branched_params",
+          [](py::object self) { return ParameterView<3>(self, &Reactions::branched, &Branched::X); },
+          "Columns X, Y, a0")
+      .def_property_readonly(
+          "condensed_phase_arrhenius_params",
+          [](py::object self)
+          { return ParameterView<5>(self, &Reactions::condensed_phase_arrhenius, &CondensedPhaseArrhenius::A); },
+          "Columns A, B, C, D, E")
+      .def_property_readonly(
+          "condensed_phase_photolysis_params",
+          [](py::object self)
+          { return ParameterView<1>(self, &Reactions::condensed_phase_photolysis, &CondensedPhasePhotolysis::scaling_factor_); },
+          "Scaling factors")
+      .def_property_readonly(
+          "emission_params",
+          [](py::object self) { return ParameterView<1>(self, &Reactions::emission, &Emission::scaling_factor); },
+          "Scaling factors")
+      .def_property_readonly(
+          "first_order_loss_params",
+          [](py::object self) { return ParameterView<1>(self, &Reactions::first_order_loss, &FirstOrderLoss::scaling_factor); },
+          "Scaling factors")
+      .def_property_readonly(
+          "simpol_phase_transfer_params",
+          [](py::object self) { return ParameterView<4>(self, &Reactions::simpol_phase_transfer, &SimpolPhaseTransfer::B); },
+          "Columns B[0], B[1], B[2], B[3]")
+      .def_property_readonly(
+          "aqueous_equilibrium_params",
+          [](py::object self) { return ParameterView<3>(self, &Reactions::aqueous_equilibrium, &AqueousEquilibrium::A); },
+          "Columns A, C, k_reverse")
+      .def_property_readonly(
+          "wet_deposition_params",
+          [](py::object self) { return ParameterView<1>(self, &Reactions::wet_deposition, &WetDeposition::scaling_factor); },
+          "Scaling factors")
+      .def_property_readonly(
+          "photolysis_params",
+          [](py::object self) { return ParameterView<1>(self, &Reactions::photolysis, &Photolysis::scaling_factor); },
+          "Scaling factors")
+      .def_property_readonly(
+          "surface_params",
+          [](py::object self) { return ParameterView<1>(self, &Reactions::surface, &Surface::reaction_probability); },
+          "Reaction probabilities")
+      .def_property_readonly(
+          "troe_params",
+          [](py::object self) { return ParameterView<8>(self, &Reactions::troe, &Troe::k0_A); },
+          "Columns k0_A, k0_B, k0_C, kinf_A, kinf_B, kinf_C, Fc, N")
+      .def_property_readonly(
+          "tunneling_params",
+          [](py::object self) { return ParameterView<3>(self, &Reactions::tunneling, &Tunneling::A); },
+          "Columns A, B, C")
+      .def("__len__", &NumberOfReactions)
       .def(
-          "__len__",
-          [](const Reactions &r)
+          "__getitem__",
+          [](py::object self, py::ssize_t index)
           {
-            return r.arrhenius.size() + r.branched.size() + r.condensed_phase_arrhenius.size() + r.condensed_phase_photolysis.size() +
-                   r.emission.size() + r.first_order_loss.size() + r.simpol_phase_transfer.size() + r.aqueous_equilibrium.size() +
-                   r.wet_deposition.size() + r.henrys_law.size() + r.photolysis.size() + r.surface.size() + r.troe.size() + r.tunneling.size();
+            auto &reactions = self.cast<Reactions &>();
+            const auto size = static_cast<py::ssize_t>(NumberOfReactions(reactions));
+            if (index < 0)
+            {
+              index += size;
+            }
+            if (index < 0 || index >= size)
+            {
+              throw py::index_error("reaction index out of range");
+            }
+            auto remaining = static_cast<std::size_t>(index);
+            for (std::size_t type = 0;; ++type)
+            {
+              std::size_t list_size = 0;
+              VisitReactionList(reactions, type, [&](const auto &list) { list_size = list.size(); });
+              if (remaining < list_size)
+              {
+                return CastReaction(reactions, type, remaining);
+              }
+              remaining -= list_size;
+            }
           })
       .def("__str__", [](const Reactions &r) { return "Reactions"; })
       .def("__repr__", [](const Reactions &r) { return "<Reactions>"; })
-      .def("__iter__", [](Reactions &r) { return ReactionsIterator(r); });
+      .def(
+          "__iter__", [](py::object self) { return ReactionsIterator(self.cast<Reactions &>(), self); }, py::keep_alive<0, 1>());
 
   py::class_<ReactionsIterator>(m, "ReactionsIterator")
       .def("__iter__", [](ReactionsIterator &it) -> ReactionsIterator & { return it; })
@@ -362,10 +426,229 @@ PYBIND11_MODULE(mechanism_configuration, m)
       .def_readwrite("name", &Mechanism::name)
       .def_readwrite("species", &Mechanism::species)
       .def_readwrite("phases", &Mechanism::phases)
-      .def_readwrite("reactions", &Mechanism::reactions)
+      .def_property(
+          "reactions",
+          [](Mechanism &self) -> Reactions & { return self.reactions; },
+          [](Mechanism &self, const Reactions &reactions)
+          {
+            CheckNoLiveParameterViews(self.reactions, "Mechanism.reactions");
+            self.reactions = reactions;
+          })
       .def_readwrite("version", &Mechanism::version)
       .def("__str__", [](const Mechanism &m) { return m.name; })
-      .def("__repr__", [](const Mechanism &m) { return "<Mechanism: " + m.name + ">"; });
+      .def("__repr__", [](const Mechanism &m) { return "<Mechanism: " + m.name + ">"; })
+      .def(
+          "write",
+          [](const Mechanism &self, const std::string &path) { mechanism_configuration::v1::WriteMechanism(self, std::filesystem::path(path)); },
+          "Writes the mechanism as a v1 configuration, in JSON if the path ends in .json and YAML otherwise")
+      .def("to_json", [](const Mechanism &self) { return mechanism_configuration::v1::ToString(self, mechanism_configuration::v1::OutputFormat::Json); })
+      .def("to_yaml", [](const Mechanism &self) { return mechanism_configuration::v1::ToString(self, mechanism_configuration::v1::OutputFormat::Yaml); })
+      .def(
+          "to_bytes",
+          [](const Mechanism &self)
+          {
+            auto bytes = mechanism_configuration::v1::WriteBinary(self);
+            return py::bytes(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+          },
+          "Serializes the mechanism to a compact binary form")
+      .def_static(
+          "from_buffer",
+          [](py::buffer buffer) { return std::make_unique<Mechanism>(ReadBinaryBuffer(buffer)); },
+          "Reads a mechanism from any object supporting the buffer protocol, such as bytes or a shared memory block")
+      .def(
+          "to_shared_memory",
+          [](const Mechanism &self)
+          {
+            auto bytes = mechanism_configuration::v1::WriteBinary(self);
+            auto shared_memory = py::module_::import("multiprocessing.shared_memory")
+                                     .attr("SharedMemory")(py::arg("create") = true, py::arg("size") = std::max<std::size_t>(bytes.size(), 1));
+            py::buffer_info info = py::buffer(shared_memory.attr("buf")).request(true);
+            std::memcpy(info.ptr, bytes.data(), bytes.size());
+            return py::make_tuple(shared_memory, bytes.size());
+          },
+          "Writes the binary form into a new multiprocessing.shared_memory.SharedMemory block. Returns the block and the number "
+          "of bytes used. Workers attach with Mechanism.from_shared_memory(name, size); the creator owns the block and must "
+          "unlink it.")
+      .def_static(
+          "from_shared_memory",
+          [](const std::string &name, std::size_t size)
+          {
+            auto shared_memory = py::module_::import("multiprocessing.shared_memory").attr("SharedMemory")(py::arg("name") = name);
+            // the view must be released before the block can be closed, even if reading fails
+            py::object view = shared_memory.attr("buf")[py::slice(0, static_cast<py::ssize_t>(size), 1)];
+            try
+            {
+              auto mechanism = std::make_unique<Mechanism>(ReadBinaryBuffer(py::buffer(view)));
+              view.attr("release")();
+              shared_memory.attr("close")();
+              return mechanism;
+            }
+            catch (...)
+            {
+              view.attr("release")();
+              shared_memory.attr("close")();
+              throw;
+            }
+          },
+          py::arg("name"),
+          py::arg("size"))
+      .def(py::pickle(
+          [](const Mechanism &self)
+          {
+            auto bytes = mechanism_configuration::v1::WriteBinary(self);
+            return py::bytes(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+          },
+          [](py::bytes state) { return ReadBinaryBuffer(state); }));
+
+  using mechanism_configuration::v1::MechanismGraph;
+  using mechanism_configuration::v1::ReactionIndex;
+  using mechanism_configuration::v1::StronglyConnectedComponent;
+
+  py::class_<ReactionIndex>(m, "ReactionIndex")
+      .def_readonly("type", &ReactionIndex::type)
+      .def_readonly("index", &ReactionIndex::index)
+      .def("__repr__", [](const ReactionIndex &r) { return "<ReactionIndex: " + std::to_string(r.index) + ">"; });
+
+  py::class_<StronglyConnectedComponent>(m, "StronglyConnectedComponent")
+      .def_readonly("species", &StronglyConnectedComponent::species)
+      .def_readonly("reactions", &StronglyConnectedComponent::reactions)
+      .def("__repr__", [](const StronglyConnectedComponent &) { return "<StronglyConnectedComponent>"; });
+
+  py::class_<MechanismGraph>(m, "MechanismGraph")
+      .def(py::init<const Mechanism &>())
+      .def_property_readonly("number_of_species", &MechanismGraph::NumberOfSpecies)
+      .def_property_readonly("number_of_reactions", &MechanismGraph::NumberOfReactions)
+      .def("species_name", &MechanismGraph::SpeciesName)
+      .def("species_index", &MechanismGraph::SpeciesIndex)
+      .def("reaction", &MechanismGraph::Reaction)
+      .def("is_reversible", &MechanismGraph::IsReversible)
+      .def(
+          "reachable_species",
+          [](const MechanismGraph &self, const std::vector<std::string> &initial_species)
+          {
+            auto reachable = self.Reachable(initial_species);
+            std::vector<std::string> names;
+            for (std::size_t s = 0; s < reachable.species.size(); ++s)
+            {
+              if (reachable.species[s])
+              {
+                names.push_back(self.SpeciesName(s));
+              }
+            }
+            return names;
+          })
+      .def(
+          "dead_species",
+          [](const MechanismGraph &self, const std::vector<std::string> &initial_species)
+          {
+            std::vector<std::string> names;
+            for (std::size_t s : self.DeadSpecies(initial_species))
+            {
+              names.push_back(self.SpeciesName(s));
+            }
+            return names;
+          })
+      .def(
+          "dead_reactions",
+          [](const MechanismGraph &self, const std::vector<std::string> &initial_species)
+          {
+            std::vector<ReactionIndex> reactions;
+            for (std::size_t r : self.DeadReactions(initial_species))
+            {
+              reactions.push_back(self.Reaction(r));
+            }
+            return reactions;
+          })
+      .def("cycles", &MechanismGraph::Cycles)
+      .def("__repr__", [](const MechanismGraph &) { return "<MechanismGraph>"; });
+
+  using mechanism_configuration::v1::ReducedMechanism;
+
+  py::class_<ReducedMechanism>(m, "ReducedMechanism")
+      .def_readonly("mechanism", &ReducedMechanism::mechanism)
+      .def_readonly("species", &ReducedMechanism::species)
+      .def_readonly("phases", &ReducedMechanism::phases)
+      .def_readonly("reactions", &ReducedMechanism::reactions)
+      .def("__repr__", [](const ReducedMechanism &r) { return "<ReducedMechanism: " + r.mechanism.name + ">"; });
+
+  m.def(
+      "reduce",
+      &mechanism_configuration::v1::Reduce,
+      py::arg("mechanism"),
+      py::arg("target_species"),
+      py::arg("emitted_species") = std::vector<std::string>{});
+
+  using mechanism_configuration::v1::ChangeKind;
+  using mechanism_configuration::v1::MechanismDiff;
+  using mechanism_configuration::v1::ParameterChange;
+  using mechanism_configuration::v1::PhaseChange;
+  using mechanism_configuration::v1::ReactionChange;
+  using mechanism_configuration::v1::SpeciesChange;
+  using mechanism_configuration::v1::SpeciesMove;
+
+  py::enum_<ChangeKind>(m, "ChangeKind")
+      .value("Added", ChangeKind::Added)
+      .value("Removed", ChangeKind::Removed)
+      .value("Modified", ChangeKind::Modified);
+
+  py::class_<SpeciesChange>(m, "SpeciesChange")
+      .def_readonly("name", &SpeciesChange::name)
+      .def_readonly("kind", &SpeciesChange::kind)
+      .def_readonly("properties", &SpeciesChange::properties);
+
+  py::class_<PhaseChange>(m, "PhaseChange")
+      .def_readonly("name", &PhaseChange::name)
+      .def_readonly("kind", &PhaseChange::kind)
+      .def_readonly("added_species", &PhaseChange::added_species)
+      .def_readonly("removed_species", &PhaseChange::removed_species)
+      .def_readonly("unknown_properties_changed", &PhaseChange::unknown_properties_changed);
+
+  py::class_<SpeciesMove>(m, "SpeciesMove")
+      .def_readonly("species", &SpeciesMove::species)
+      .def_readonly("removed_from", &SpeciesMove::removed_from)
+      .def_readonly("added_to", &SpeciesMove::added_to);
+
+  py::class_<ParameterChange>(m, "ParameterChange")
+      .def_readonly("name", &ParameterChange::name)
+      .def_readonly("before", &ParameterChange::before)
+      .def_readonly("after", &ParameterChange::after);
+
+  py::class_<ReactionChange>(m, "ReactionChange")
+      .def_readonly("kind", &ReactionChange::kind)
+      .def_readonly("type", &ReactionChange::type)
+      .def_readonly("description", &ReactionChange::description)
+      .def_readonly("before_index", &ReactionChange::before_index)
+      .def_readonly("after_index", &ReactionChange::after_index)
+      .def_readonly("parameters", &ReactionChange::parameters)
+      .def_readonly("fields", &ReactionChange::fields);
+
+  py::class_<MechanismDiff>(m, "MechanismDiff")
+      .def_readonly("species", &MechanismDiff::species)
+      .def_readonly("phases", &MechanismDiff::phases)
+      .def_readonly("moves", &MechanismDiff::moves)
+      .def_readonly("reactions", &MechanismDiff::reactions)
+      .def("empty", &MechanismDiff::Empty)
+      .def(
+          "report",
+          [](const MechanismDiff &diff)
+          {
+            std::ostringstream stream;
+            mechanism_configuration::v1::WriteReport(diff, stream);
+            return stream.str();
+          })
+      .def("__bool__", [](const MechanismDiff &diff) { return !diff.Empty(); });
+
+  m.def("diff", &mechanism_configuration::v1::Diff, py::arg("before"), py::arg("after"));
+
+  using mechanism_configuration::v1::DuplicateReaction;
+
+  py::class_<DuplicateReaction>(m, "DuplicateReaction")
+      .def_readonly("original", &DuplicateReaction::original)
+      .def_readonly("duplicate", &DuplicateReaction::duplicate)
+      .def_readonly("identical_parameters", &DuplicateReaction::identical_parameters)
+      .def_readonly("identical_names", &DuplicateReaction::identical_names);
+
+  m.def("find_duplicate_reactions", &mechanism_configuration::v1::FindDuplicateReactions, py::arg("reactions"));
 
   py::class_<mechanism_configuration::Version>(m, "Version")
       .def(py::init<>())
@@ -386,19 +669,58 @@ PYBIND11_MODULE(mechanism_configuration, m)
           "parse",
           [](V1Parser &self, const std::string &path)
           {
-            auto parsed = self.Parse(std::filesystem::path(path));
-            if (parsed)
+            mechanism_configuration::ParserResult<Mechanism> parsed;
+            {
+              py::gil_scoped_release release;
+              parsed = self.Parse(std::filesystem::path(path));
+            }
+            if (!parsed)
+            {
+              ThrowParseErrors(path, parsed.errors);
+            }
+            return std::move(parsed.mechanism);
+          })
+      .def(
+          "parse_many",
+          [](V1Parser &, const std::vector<std::string> &paths, std::size_t max_workers)
+          {
+            std::vector<std::filesystem::path> config_paths(paths.begin(), paths.end());
+            std::vector<mechanism_configuration::ParserResult<Mechanism>> results;
             {
-              return *parsed;
+              py::gil_scoped_release release;
+              results = mechanism_configuration::ParseConcurrently<V1Parser>(config_paths, max_workers);
             }
-            else
+            std::vector<std::unique_ptr<Mechanism>> mechanisms;
+            mechanisms.reserve(results.size());
+            for (std::size_t i = 0; i < results.size(); ++i)
             {
-              std::string error = "Error parsing file: " + path + "\n";
-              for (auto &e : parsed.errors)
+              if (!results[i])
               {
-                error += e.second + "\n";
+                ThrowParseErrors(paths[i], results[i].errors);
               }
-              throw std::runtime_error(error);
+              mechanisms.push_back(std::move(results[i].mechanism));
             }
-          });
+            return mechanisms;
+          },
+          py::arg("paths"),
+          py::arg("max_workers") = 0,
+          "Parses many files on worker threads. A max_workers of 0 uses one worker per hardware thread.");
+
+  using V1IncrementalParser = mechanism_configuration::v1::IncrementalParser;
+
+  py::class_<V1IncrementalParser>(m, "IncrementalParser")
+      .def(py::init<>())
+      .def(
+          "parse",
+          [](V1IncrementalParser &self, const std::string &path)
+          {
+            auto parsed = self.Parse(std::filesystem::path(path));
+            if (!parsed)
+            {
+              ThrowParseErrors(path, parsed.errors);
+            }
+            return std::move(parsed.mechanism);
+          })
+      .def("reset", &V1IncrementalParser::Reset)
+      .def_property_readonly("reused_reaction_count", &V1IncrementalParser::ReusedReactionCount);
 }
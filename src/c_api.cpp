@@ -0,0 +1,334 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <mechanism_configuration/c_api.h>
+#include <mechanism_configuration/v1/external_rates.hpp>
+#include <mechanism_configuration/v1/parser.hpp>
+#include <mechanism_configuration/v1/reaction_parameters.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <unordered_map>
+#include <vector>
+
+using namespace mechanism_configuration;
+using namespace mechanism_configuration::v1;
+
+struct mc_mechanism
+{
+  types::Mechanism mechanism;
+  Errors errors;
+  std::vector<std::string> error_messages;
+  std::unordered_map<std::string, std::size_t> species_indices;
+  ExternalRateRegistry external_rates{ types::Mechanism{} };
+};
+
+static_assert(static_cast<int>(types::ReactionType::Arrhenius) == MC_ARRHENIUS);
+static_assert(static_cast<int>(types::ReactionType::Tunneling) == MC_TUNNELING);
+static_assert(types::NumberOfReactionLists() == MC_NUM_REACTION_TYPES);
+
+namespace
+{
+  template<typename Func>
+  void VisitReactionList(const types::Reactions& reactions, mc_reaction_type type, Func&& f)
+  {
+    types::ForEachReactionList(
+        reactions,
+        [&](types::ReactionType list_type, const auto& list)
+        {
+          if (static_cast<int>(list_type) == static_cast<int>(type))
+          {
+            f(list);
+          }
+        });
+  }
+
+  template<typename ForEachSide>
+  std::size_t CountEntries(const mc_mechanism& mechanism, mc_reaction_type type, ForEachSide&& for_each_side)
+  {
+    std::size_t count = 0;
+    VisitReactionList(
+        mechanism.mechanism.reactions,
+        type,
+        [&](const auto& list)
+        {
+          for (const auto& reaction : list)
+            for_each_side(reaction, [&](const std::string&, double) { ++count; });
+        });
+    return count;
+  }
+
+  template<typename ForEachSide>
+  void GetEntries(
+      const mc_mechanism& mechanism,
+      mc_reaction_type type,
+      size_t* offsets,
+      size_t* species,
+      double* coefficients,
+      ForEachSide&& for_each_side)
+  {
+    std::size_t entry = 0;
+    VisitReactionList(
+        mechanism.mechanism.reactions,
+        type,
+        [&](const auto& list)
+        {
+          for (std::size_t r = 0; r < list.size(); ++r)
+          {
+            offsets[r] = entry;
+            for_each_side(
+                list[r],
+                [&](const std::string& name, double coefficient)
+                {
+                  auto index = mechanism.species_indices.find(name);
+                  species[entry] = index == mechanism.species_indices.end() ? SIZE_MAX : index->second;
+                  coefficients[entry] = coefficient;
+                  ++entry;
+                });
+          }
+          offsets[list.size()] = entry;
+        });
+  }
+
+  /// @brief The mechanism behind a handle, or an empty one for NULL, which mc_parse returns if it cannot allocate
+  ///        a handle
+  const mc_mechanism& Get(const mc_mechanism* mechanism)
+  {
+    static const mc_mechanism empty;
+    return mechanism ? *mechanism : empty;
+  }
+
+  /// @brief Calls f(name, coefficient) for each component of a reaction whose role passes select
+  template<bool (*select)(types::ComponentRole)>
+  struct Components
+  {
+    template<typename ReactionT, typename Func>
+    void operator()(const ReactionT& reaction, Func&& f) const
+    {
+      types::ForEachComponent(
+          reaction,
+          [&f](types::ComponentRole role, const std::string& name, double coefficient)
+          {
+            if (select(role))
+              f(name, coefficient);
+          });
+    }
+  };
+
+  using Reactants = Components<types::IsReactant>;
+  using Products = Components<types::IsProduct>;
+}  // namespace
+
+extern "C"
+{
+  mc_mechanism* mc_parse(const char* path)
+  {
+    // No exception may leave a C function, so anything that fails after the handle exists is reported as an
+    // error in the handle, and a handle that cannot be created at all is reported as NULL
+    try
+    {
+      auto handle = std::make_unique<mc_mechanism>();
+      try
+      {
+        if (!path)
+        {
+          throw std::invalid_argument("No configuration path given");
+        }
+        Parser parser;
+        auto parsed = parser.Parse(path);
+        if (parsed)
+        {
+          handle->mechanism = std::move(*parsed.mechanism);
+          for (std::size_t i = 0; i < handle->mechanism.species.size(); ++i)
+          {
+            handle->species_indices.emplace(handle->mechanism.species[i].name, i);
+          }
+          handle->external_rates = ExternalRateRegistry(handle->mechanism);
+        }
+        else
+        {
+          handle->errors = std::move(parsed.errors);
+        }
+      }
+      catch (const std::exception& e)
+      {
+        handle->mechanism = types::Mechanism{};
+        handle->species_indices.clear();
+        handle->external_rates = ExternalRateRegistry(handle->mechanism);
+        handle->errors.assign(1, { ConfigParseStatus::UnhandledException, e.what() });
+        if (path)
+        {
+          SetErrorFile(handle->errors, path);
+        }
+      }
+      handle->error_messages.reserve(handle->errors.size());
+      for (const auto& error : handle->errors)
+      {
+        handle->error_messages.push_back(error.to_string());
+      }
+      return handle.release();
+    }
+    catch (...)
+    {
+      return nullptr;
+    }
+  }
+
+  void mc_free(mc_mechanism* mechanism)
+  {
+    delete mechanism;
+  }
+
+  int mc_is_valid(const mc_mechanism* mechanism)
+  {
+    return mechanism && mechanism->errors.empty() ? 1 : 0;
+  }
+
+  size_t mc_num_errors(const mc_mechanism* mechanism)
+  {
+    return Get(mechanism).errors.size();
+  }
+
+  int mc_error_status(const mc_mechanism* mechanism, size_t error)
+  {
+    const auto& errors = Get(mechanism).errors;
+    return error < errors.size() ? static_cast<int>(errors[error].status) : -1;
+  }
+
+  const char* mc_error_message(const mc_mechanism* mechanism, size_t error)
+  {
+    const auto& messages = Get(mechanism).error_messages;
+    return error < messages.size() ? messages[error].c_str() : nullptr;
+  }
+
+  size_t mc_num_species(const mc_mechanism* mechanism)
+  {
+    return Get(mechanism).mechanism.species.size();
+  }
+
+  size_t mc_num_phases(const mc_mechanism* mechanism)
+  {
+    return Get(mechanism).mechanism.phases.size();
+  }
+
+  const char* mc_species_name(const mc_mechanism* mechanism, size_t species)
+  {
+    const auto& all_species = Get(mechanism).mechanism.species;
+    return species < all_species.size() ? all_species[species].name.c_str() : nullptr;
+  }
+
+  size_t mc_max_species_name_length(const mc_mechanism* mechanism)
+  {
+    std::size_t length = 0;
+    for (const auto& species : Get(mechanism).mechanism.species)
+    {
+      length = std::max(length, species.name.size());
+    }
+    return length;
+  }
+
+  void mc_get_species_names(const mc_mechanism* mechanism, char* names, size_t name_length)
+  {
+    for (const auto& species : Get(mechanism).mechanism.species)
+    {
+      std::size_t copied = std::min(name_length, species.name.size());
+      std::memcpy(names, species.name.data(), copied);
+      std::memset(names + copied, ' ', name_length - copied);
+      names += name_length;
+    }
+  }
+
+  size_t mc_num_reactions(const mc_mechanism* mechanism, mc_reaction_type type)
+  {
+    std::size_t size = 0;
+    VisitReactionList(Get(mechanism).mechanism.reactions, type, [&](const auto& list) { size = list.size(); });
+    return size;
+  }
+
+  size_t mc_num_reaction_params(mc_reaction_type type)
+  {
+    const types::Reactions no_reactions;
+    std::size_t size = 0;
+    VisitReactionList(
+        no_reactions,
+        type,
+        [&](const auto& list)
+        {
+          using ReactionT = typename std::decay_t<decltype(list)>::value_type;
+          ForEachParameter(ReactionT{}, [&size](const std::string&, double) { ++size; });
+        });
+    return size;
+  }
+
+  void mc_get_reaction_params(const mc_mechanism* mechanism, mc_reaction_type type, double* params)
+  {
+    VisitReactionList(
+        Get(mechanism).mechanism.reactions,
+        type,
+        [&](const auto& list)
+        {
+          for (const auto& reaction : list)
+          {
+            ForEachParameter(reaction, [&params](const std::string&, double value) { *params++ = value; });
+          }
+        });
+  }
+
+  void mc_get_arrhenius_params(const mc_mechanism* mechanism, double* params)
+  {
+    mc_get_reaction_params(mechanism, MC_ARRHENIUS, params);
+  }
+
+  size_t mc_num_reactant_entries(const mc_mechanism* mechanism, mc_reaction_type type)
+  {
+    return CountEntries(Get(mechanism), type, Reactants{});
+  }
+
+  size_t mc_num_product_entries(const mc_mechanism* mechanism, mc_reaction_type type)
+  {
+    return CountEntries(Get(mechanism), type, Products{});
+  }
+
+  void mc_get_reactants(const mc_mechanism* mechanism, mc_reaction_type type, size_t* offsets, size_t* species, double* coefficients)
+  {
+    GetEntries(Get(mechanism), type, offsets, species, coefficients, Reactants{});
+  }
+
+  void mc_get_products(const mc_mechanism* mechanism, mc_reaction_type type, size_t* offsets, size_t* species, double* coefficients)
+  {
+    GetEntries(Get(mechanism), type, offsets, species, coefficients, Products{});
+  }
+
+  size_t mc_num_external_rates(const mc_mechanism* mechanism)
+  {
+    return Get(mechanism).external_rates.Size();
+  }
+
+  const char* mc_external_rate_key(const mc_mechanism* mechanism, size_t parameter)
+  {
+    const auto& external_rates = Get(mechanism).external_rates;
+    return parameter < external_rates.Size() ? external_rates[parameter].key.c_str() : nullptr;
+  }
+
+  int mc_find_external_rate(const mc_mechanism* mechanism, const char* key, size_t* parameter)
+  {
+    if (!key)
+    {
+      return 0;
+    }
+    auto found = Get(mechanism).external_rates.Find(key);
+    if (!found)
+    {
+      return 0;
+    }
+    *parameter = *found;
+    return 1;
+  }
+}
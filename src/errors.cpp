@@ -0,0 +1,49 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/errors.hpp>
+
+namespace mechanism_configuration
+{
+  std::string ParseError::to_string() const
+  {
+    std::string message;
+    if (file)
+    {
+      message += file->string() + ":";
+    }
+    if (line > 0)
+    {
+      message += std::to_string(line) + ":" + std::to_string(column) + ":";
+    }
+    if (!message.empty())
+    {
+      message += " ";
+    }
+    message += "error: ";
+    message += configParseStatusDescription(status);
+    if (!detail.empty())
+    {
+      message += ": " + detail;
+    }
+    if (!key.empty())
+    {
+      message += " [" + key + "]";
+    }
+    return message;
+  }
+
+  void SetErrorFile(Errors& errors, const std::filesystem::path& file)
+  {
+    if (errors.empty())
+    {
+      return;
+    }
+    auto shared_file = std::make_shared<const std::filesystem::path>(file);
+    for (auto& error : errors)
+    {
+      error.file = shared_file;
+    }
+  }
+}  // namespace mechanism_configuration
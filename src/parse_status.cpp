@@ -1,31 +1,74 @@
 #include <mechanism_configuration/parse_status.hpp>
 
+#include <array>
+#include <cstddef>
+
 namespace mechanism_configuration
 {
-  std::string configParseStatusToString(const ConfigParseStatus& status)
+  namespace
   {
-    switch (status)
+    struct StatusText
+    {
+      ConfigParseStatus status;
+      const char* name;
+      const char* description;
+    };
+
+    // One entry per status, in enumerator order
+    constexpr std::array status_text{
+      StatusText{ ConfigParseStatus::Success, "Success", "Success" },
+      StatusText{ ConfigParseStatus::None, "None", "Error" },
+      StatusText{ ConfigParseStatus::InvalidKey, "InvalidKey", "Non-standard key" },
+      StatusText{ ConfigParseStatus::UnknownKey, "UnknownKey", "Unknown key" },
+      StatusText{ ConfigParseStatus::InvalidFilePath, "InvalidFilePath", "Invalid file path" },
+      StatusText{ ConfigParseStatus::FileNotFound, "FileNotFound", "File not found" },
+      StatusText{ ConfigParseStatus::ObjectTypeNotFound, "ObjectTypeNotFound", "Object type not found" },
+      StatusText{ ConfigParseStatus::RequiredKeyNotFound, "RequiredKeyNotFound", "Missing required key" },
+      StatusText{ ConfigParseStatus::MutuallyExclusiveOption, "MutuallyExclusiveOption", "Mutually exclusive option" },
+      StatusText{ ConfigParseStatus::InvalidVersion, "InvalidVersion", "Invalid version" },
+      StatusText{ ConfigParseStatus::DuplicateSpeciesDetected, "DuplicateSpeciesDetected", "Duplicate species detected" },
+      StatusText{ ConfigParseStatus::DuplicatePhasesDetected, "DuplicatePhasesDetected", "Duplicate phases detected" },
+      StatusText{ ConfigParseStatus::PhaseRequiresUnknownSpecies, "PhaseRequiresUnknownSpecies", "Phase requires unknown species" },
+      StatusText{ ConfigParseStatus::ReactionRequiresUnknownSpecies, "ReactionRequiresUnknownSpecies", "Reaction requires unknown species" },
+      StatusText{ ConfigParseStatus::UnknownPhase, "UnknownPhase", "Unknown phase" },
+      StatusText{ ConfigParseStatus::RequestedAerosolSpeciesNotIncludedInAerosolPhase,
+                  "RequestedAerosolSpeciesNotIncludedInAerosolPhase",
+                  "Requested aerosol species not included in aerosol phase" },
+      StatusText{ ConfigParseStatus::TooManyReactionComponents, "TooManyReactionComponents", "Too many reaction components" },
+      StatusText{ ConfigParseStatus::InvalidIonPair, "InvalidIonPair", "Invalid ion pair" },
+      StatusText{ ConfigParseStatus::UnknownType, "UnknownType", "Unknown type" },
+      StatusText{ ConfigParseStatus::DuplicateReactionDetected, "DuplicateReactionDetected", "Duplicate reaction detected" },
+      StatusText{ ConfigParseStatus::UnhandledException, "UnhandledException", "Unhandled exception" },
+    };
+
+    constexpr bool InEnumeratorOrder()
+    {
+      for (std::size_t i = 0; i < status_text.size(); ++i)
+      {
+        if (static_cast<std::size_t>(status_text[i].status) != i)
+          return false;
+      }
+      return true;
+    }
+    static_assert(InEnumeratorOrder(), "status_text must list every ConfigParseStatus in enumerator order");
+    static_assert(static_cast<std::size_t>(ConfigParseStatus::UnhandledException) + 1 == status_text.size(), "a ConfigParseStatus has no text");
+
+    const StatusText* Find(ConfigParseStatus status)
     {
-      case ConfigParseStatus::Success: return "Success";
-      case ConfigParseStatus::None: return "None";
-      case ConfigParseStatus::InvalidKey: return "InvalidKey";
-      case ConfigParseStatus::UnknownKey: return "UnknownKey";
-      case ConfigParseStatus::InvalidFilePath: return "InvalidFilePath";
-      case ConfigParseStatus::ObjectTypeNotFound: return "ObjectTypeNotFound";
-      case ConfigParseStatus::RequiredKeyNotFound: return "RequiredKeyNotFound";
-      case ConfigParseStatus::MutuallyExclusiveOption: return "MutuallyExclusiveOption";
-      case ConfigParseStatus::DuplicateSpeciesDetected: return "DuplicateSpeciesDetected";
-      case ConfigParseStatus::DuplicatePhasesDetected: return "DuplicatePhasesDetected";
-      case ConfigParseStatus::PhaseRequiresUnknownSpecies: return "PhaseRequiresUnknownSpecies";
-      case ConfigParseStatus::ReactionRequiresUnknownSpecies: return "ReactionRequiresUnknownSpecies";
-      case ConfigParseStatus::UnknownPhase: return "UnknownPhase";
-      case ConfigParseStatus::RequestedAerosolSpeciesNotIncludedInAerosolPhase: return "RequestedAerosolSpeciesNotIncludedInAerosolPhase";
-      case ConfigParseStatus::TooManyReactionComponents: return "TooManyReactionComponents";
-      case ConfigParseStatus::InvalidIonPair: return "InvalidIonPair";
-      case ConfigParseStatus::InvalidVersion: return "InvalidVersion";
-      case ConfigParseStatus::UnknownType: return "UnknownType";
-      case ConfigParseStatus::FileNotFound: return "FileNotFound";
-      default: return "Unknown";
+      const auto i = static_cast<std::size_t>(status);
+      return i < status_text.size() ? &status_text[i] : nullptr;
     }
+  }  // namespace
+
+  std::string configParseStatusToString(const ConfigParseStatus& status)
+  {
+    const StatusText* text = Find(status);
+    return text ? text->name : "Unknown";
+  }
+
+  std::string configParseStatusDescription(const ConfigParseStatus& status)
+  {
+    const StatusText* text = Find(status);
+    return text ? text->description : "Unknown error";
   }
-}  // namespace mechanism_configuration
\ No newline at end of file
+}  // namespace mechanism_configuration
@@ -59,9 +59,7 @@ namespace mechanism_configuration
         {
           if (parameters.C != 0)
           {
-            std::string line = std::to_string(object[validation::Ea].Mark().line + 1);
-            std::string column = std::to_string(object[validation::Ea].Mark().column + 1);
-            errors.push_back({ ConfigParseStatus::MutuallyExclusiveOption, line + ":" + column + ": Cannot specify both 'C' and 'Ea'" });
+            errors.push_back({ ConfigParseStatus::MutuallyExclusiveOption, object[validation::Ea].Mark(), validation::Ea, validation::C });
           }
           else
           {
@@ -70,10 +68,10 @@ namespace mechanism_configuration
           }
         }
 
-        parameters.reactants = reactants;
-        parameters.products = products;
+        parameters.reactants = std::move(reactants);
+        parameters.products = std::move(products);
 
-        mechanism->reactions.arrhenius.push_back(parameters);
+        mechanism->reactions.arrhenius.push_back(std::move(parameters));
       }
 
       return errors;
@@ -48,11 +48,11 @@ namespace mechanism_configuration
         parameters.a0 = object[validation::A0].as<double>();
         parameters.n = object[validation::n].as<int>();
 
-        parameters.reactants = reactants;
-        parameters.alkoxy_products = alkoxy_products;
-        parameters.nitrate_products = nitrate_products;
+        parameters.reactants = std::move(reactants);
+        parameters.alkoxy_products = std::move(alkoxy_products);
+        parameters.nitrate_products = std::move(nitrate_products);
 
-        mechanism->reactions.branched.push_back(parameters);
+        mechanism->reactions.branched.push_back(std::move(parameters));
       }
 
       return errors;
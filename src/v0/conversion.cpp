@@ -0,0 +1,286 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/v0/conversion.hpp>
+#include <sstream>
+#include <utility>
+
+namespace mechanism_configuration
+{
+  namespace v0
+  {
+    namespace
+    {
+      v1::types::ReactionComponent Convert(const types::ReactionComponent& component)
+      {
+        return { component.species_name, component.coefficient, component.unknown_properties };
+      }
+
+      std::vector<v1::types::ReactionComponent> Convert(const std::vector<types::ReactionComponent>& components)
+      {
+        std::vector<v1::types::ReactionComponent> converted;
+        converted.reserve(components.size());
+        for (const auto& component : components)
+        {
+          converted.push_back(Convert(component));
+        }
+        return converted;
+      }
+
+      std::string Side(const std::vector<types::ReactionComponent>& components)
+      {
+        std::string side;
+        for (const auto& component : components)
+        {
+          if (!side.empty())
+          {
+            side += " + ";
+          }
+          if (component.coefficient != 1.0)
+          {
+            std::ostringstream coefficient;
+            coefficient << component.coefficient;
+            side += coefficient.str() + " ";
+          }
+          side += component.species_name;
+        }
+        return side;
+      }
+
+      /// @brief A reaction's equation, such as "A + B -> 2 C", to identify reactions without names
+      std::string Equation(const std::vector<types::ReactionComponent>& reactants, const std::vector<types::ReactionComponent>& products)
+      {
+        return Side(reactants) + " -> " + Side(products);
+      }
+
+      /// @brief Splits a MUSICA name like PHOTO.foo into its prefix and the rest
+      std::pair<std::string, std::string> SplitMusicaName(const std::string& name)
+      {
+        auto dot = name.find('.');
+        if (dot == std::string::npos)
+        {
+          return { "", name };
+        }
+        return { name.substr(0, dot), name.substr(dot + 1) };
+      }
+
+      /// @brief Converts a fall-off reaction. Version 0 Troe and ternary chemical activation reactions have the
+      ///        same parameters.
+      template<typename FallOff>
+      v1::types::Troe ConvertFallOff(const FallOff& reaction, const std::string& gas_phase)
+      {
+        v1::types::Troe troe;
+        troe.k0_A = reaction.k0_A;
+        troe.k0_B = reaction.k0_B;
+        troe.k0_C = reaction.k0_C;
+        troe.kinf_A = reaction.kinf_A;
+        troe.kinf_B = reaction.kinf_B;
+        troe.kinf_C = reaction.kinf_C;
+        troe.Fc = reaction.Fc;
+        troe.N = reaction.N;
+        troe.reactants = Convert(reaction.reactants);
+        troe.products = Convert(reaction.products);
+        troe.gas_phase = gas_phase;
+        troe.unknown_properties = reaction.unknown_properties;
+        return troe;
+      }
+
+      void AddAerosolPhase(std::vector<v1::types::Phase>& phases, const std::string& name)
+      {
+        for (const auto& phase : phases)
+        {
+          if (phase.name == name)
+          {
+            return;
+          }
+        }
+        v1::types::Phase aerosol;
+        aerosol.name = name;
+        phases.push_back(std::move(aerosol));
+      }
+
+      void ConvertUserDefined(
+          const types::UserDefined& reaction,
+          const std::string& gas_phase,
+          v1::types::Reactions& reactions,
+          std::vector<ConversionWarning>& warnings)
+      {
+        auto [prefix, name] = SplitMusicaName(reaction.name);
+        if (prefix == "EMIS")
+        {
+          v1::types::Emission emission;
+          emission.name = name;
+          emission.scaling_factor = reaction.scaling_factor;
+          emission.products = Convert(reaction.products);
+          emission.gas_phase = gas_phase;
+          emission.unknown_properties = reaction.unknown_properties;
+          reactions.emission.push_back(std::move(emission));
+        }
+        else if (prefix == "LOSS")
+        {
+          v1::types::FirstOrderLoss loss;
+          loss.name = name;
+          loss.scaling_factor = reaction.scaling_factor;
+          loss.reactants = Convert(reaction.reactants);
+          loss.gas_phase = gas_phase;
+          loss.unknown_properties = reaction.unknown_properties;
+          reactions.first_order_loss.push_back(std::move(loss));
+        }
+        else if (reaction.reactants.size() <= 1)
+        {
+          v1::types::Photolysis photolysis;
+          photolysis.name = name;
+          photolysis.scaling_factor = reaction.scaling_factor;
+          photolysis.reactants = Convert(reaction.reactants);
+          photolysis.products = Convert(reaction.products);
+          photolysis.gas_phase = gas_phase;
+          photolysis.unknown_properties = reaction.unknown_properties;
+          if (prefix != "PHOTO")
+          {
+            photolysis.unknown_properties[V0_TYPE_PROPERTY] = "USER_DEFINED";
+          }
+          reactions.photolysis.push_back(std::move(photolysis));
+        }
+        else
+        {
+          // version 1 photolysis reactions have a single reactant, so this holds even for PHOTO. reactions
+          v1::types::Arrhenius arrhenius;
+          arrhenius.name = name;
+          arrhenius.A = reaction.scaling_factor;
+          arrhenius.reactants = Convert(reaction.reactants);
+          arrhenius.products = Convert(reaction.products);
+          arrhenius.gas_phase = gas_phase;
+          arrhenius.unknown_properties = reaction.unknown_properties;
+          arrhenius.unknown_properties[V0_TYPE_PROPERTY] = "USER_DEFINED";
+          reactions.arrhenius.push_back(std::move(arrhenius));
+          warnings.push_back({ "USER_DEFINED",
+                               reaction.name.empty() ? Equation(reaction.reactants, reaction.products) : reaction.name,
+                               "the rate supplied by the host model becomes a constant ARRHENIUS rate equal to the scaling factor" });
+        }
+      }
+    }  // namespace
+
+    std::string ConversionWarning::to_string() const
+    {
+      return "warning: " + type + " " + reaction + ": " + detail;
+    }
+
+    v1::types::Mechanism ConvertToV1(const types::Mechanism& mechanism)
+    {
+      std::vector<ConversionWarning> warnings;
+      return ConvertToV1(mechanism, warnings);
+    }
+
+    v1::types::Mechanism ConvertToV1(const types::Mechanism& mechanism, std::vector<ConversionWarning>& warnings)
+    {
+      v1::types::Mechanism converted;
+      converted.version = Version(1, 0, 0);
+      converted.name = mechanism.name;
+
+      converted.species.reserve(mechanism.species.size());
+      for (const auto& species : mechanism.species)
+      {
+        v1::types::Species v1_species;
+        v1_species.name = species.name;
+        v1_species.molecular_weight = species.molecular_weight;
+        v1_species.diffusion_coefficient = species.diffusion_coefficient;
+        v1_species.absolute_tolerance = species.absolute_tolerance;
+        v1_species.tracer_type = species.tracer_type;
+        v1_species.unknown_properties = species.unknown_properties;
+        converted.species.push_back(std::move(v1_species));
+      }
+
+      for (const auto& phase : mechanism.phases)
+      {
+        converted.phases.push_back({ phase.name, phase.species, phase.unknown_properties });
+      }
+      if (converted.phases.empty())
+      {
+        v1::types::Phase gas;
+        gas.name = "GAS";
+        for (const auto& species : mechanism.species)
+        {
+          gas.species.push_back(species.name);
+        }
+        converted.phases.push_back(std::move(gas));
+      }
+      const std::string gas_phase = converted.phases.front().name;
+
+      auto& reactions = converted.reactions;
+      for (const auto& r : mechanism.reactions.arrhenius)
+      {
+        v1::types::Arrhenius arrhenius;
+        arrhenius.A = r.A;
+        arrhenius.B = r.B;
+        arrhenius.C = r.C;
+        arrhenius.D = r.D;
+        arrhenius.E = r.E;
+        arrhenius.reactants = Convert(r.reactants);
+        arrhenius.products = Convert(r.products);
+        arrhenius.gas_phase = gas_phase;
+        arrhenius.unknown_properties = r.unknown_properties;
+        reactions.arrhenius.push_back(std::move(arrhenius));
+      }
+      for (const auto& r : mechanism.reactions.branched)
+      {
+        v1::types::Branched branched;
+        branched.X = r.X;
+        branched.Y = r.Y;
+        branched.a0 = r.a0;
+        branched.n = r.n;
+        branched.reactants = Convert(r.reactants);
+        branched.nitrate_products = Convert(r.nitrate_products);
+        branched.alkoxy_products = Convert(r.alkoxy_products);
+        branched.gas_phase = gas_phase;
+        branched.unknown_properties = r.unknown_properties;
+        reactions.branched.push_back(std::move(branched));
+      }
+      for (const auto& r : mechanism.reactions.tunneling)
+      {
+        v1::types::Tunneling tunneling;
+        tunneling.A = r.A;
+        tunneling.B = r.B;
+        tunneling.C = r.C;
+        tunneling.reactants = Convert(r.reactants);
+        tunneling.products = Convert(r.products);
+        tunneling.gas_phase = gas_phase;
+        tunneling.unknown_properties = r.unknown_properties;
+        reactions.tunneling.push_back(std::move(tunneling));
+      }
+      for (const auto& r : mechanism.reactions.troe)
+      {
+        reactions.troe.push_back(ConvertFallOff(r, gas_phase));
+      }
+      for (const auto& r : mechanism.reactions.ternary_chemical_activation)
+      {
+        auto troe = ConvertFallOff(r, gas_phase);
+        troe.unknown_properties[V0_TYPE_PROPERTY] = "TERNARY_CHEMICAL_ACTIVATION";
+        reactions.troe.push_back(std::move(troe));
+        warnings.push_back({ "TERNARY_CHEMICAL_ACTIVATION",
+                             Equation(r.reactants, r.products),
+                             "converted to TROE, whose rate differs by a factor of the air density [M]" });
+      }
+      for (const auto& r : mechanism.reactions.surface)
+      {
+        auto [prefix, name] = SplitMusicaName(r.name);
+        v1::types::Surface surface;
+        surface.name = name;
+        surface.reaction_probability = r.reaction_probability;
+        surface.gas_phase_species = Convert(r.gas_phase_species);
+        surface.gas_phase_products = Convert(r.gas_phase_products);
+        surface.gas_phase = gas_phase;
+        surface.aerosol_phase = name;
+        surface.unknown_properties = r.unknown_properties;
+        reactions.surface.push_back(std::move(surface));
+        AddAerosolPhase(converted.phases, name);
+      }
+      for (const auto& r : mechanism.reactions.user_defined)
+      {
+        ConvertUserDefined(r, gas_phase, reactions, warnings);
+      }
+
+      return converted;
+    }
+  }  // namespace v0
+}  // namespace mechanism_configuration
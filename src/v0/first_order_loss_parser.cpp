@@ -23,12 +23,14 @@ namespace mechanism_configuration
         YAML::Node products_object{};
         std::vector<types::ReactionComponent> reactants;
         std::vector<types::ReactionComponent> products;
-        products.push_back({ .species_name = species, .coefficient = 1.0 });
+        products.push_back({ .species_name = std::move(species), .coefficient = 1.0 });
         double scaling_factor = object[validation::SCALING_FACTOR] ? object[validation::SCALING_FACTOR].as<double>() : 1.0;
 
         std::string name = "LOSS." + object[validation::MUSICA_NAME].as<std::string>();
-        types::UserDefined user_defined = { .scaling_factor = scaling_factor, .reactants = reactants, .products = products, .name = name };
-        mechanism->reactions.user_defined.push_back(user_defined);
+        types::UserDefined user_defined = {
+          .scaling_factor = scaling_factor, .reactants = std::move(reactants), .products = std::move(products), .name = std::move(name)
+        };
+        mechanism->reactions.user_defined.push_back(std::move(user_defined));
       }
 
       return errors;
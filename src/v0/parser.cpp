@@ -64,7 +64,8 @@ namespace mechanism_configuration
       // Look for CAMP config path
       if (!std::filesystem::exists(config_path))
       {
-        errors.push_back({ ConfigParseStatus::FileNotFound, "File not found" });
+        errors.push_back({ ConfigParseStatus::FileNotFound });
+        SetErrorFile(errors, config_path);
         return errors;
       }
 
@@ -95,8 +96,8 @@ namespace mechanism_configuration
       YAML::Node camp_data = YAML::LoadFile(config_file.string());
       if (!camp_data[CAMP_FILES])
       {
-        std::string msg = "Required key not found: " + CAMP_FILES;
-        errors.push_back({ ConfigParseStatus::RequiredKeyNotFound, msg });
+        errors.push_back({ ConfigParseStatus::RequiredKeyNotFound, camp_data.Mark(), CAMP_FILES });
+        SetErrorFile(errors, config_file);
         return errors;
       }
 
@@ -106,11 +107,11 @@ namespace mechanism_configuration
         std::filesystem::path camp_file = config_dir / element.as<std::string>();
         if (!std::filesystem::exists(camp_file))
         {
-          errors.push_back({ ConfigParseStatus::FileNotFound, "File not found: " + camp_file.string() });
+          errors.push_back({ ConfigParseStatus::FileNotFound, camp_file.string() });
         }
         else
         {
-          camp_files.push_back(camp_file);
+          camp_files.push_back(std::move(camp_file));
         }
       }
 
@@ -138,6 +139,9 @@ namespace mechanism_configuration
       std::function<Errors(std::unique_ptr<types::Mechanism>&, const YAML::Node&)> ParseMechanismArray =
           [&](std::unique_ptr<types::Mechanism>& mechanism, const YAML::Node& object) { return ParseMechanism(parsers, mechanism, object); };
 
+      // These are not driven by v1 reaction descriptors: a descriptor maps one key to one member, while v0 rate
+      // constants are rescaled by the reactant count, Ea is converted to C, and photolysis, emission and loss
+      // reactions become user-defined reactions with a prefixed name
       parsers["CHEM_SPEC"] = ParseChemicalSpecies;
       parsers["RELATIVE_TOLERANCE"] = ParseRelativeTolerance;
       parsers["PHOTOLYSIS"] = PhotolysisParser;
@@ -159,21 +163,19 @@ namespace mechanism_configuration
         YAML::Node config_subset = YAML::LoadFile(camp_file.string());
 
         auto parse_errors = run_parsers(parsers, result.mechanism, config_subset[CAMP_DATA]);
-        // prepend the file name to the error messages
-        for (auto& error : parse_errors)
-        {
-          error.second = camp_file.string() + ":" + error.second;
-        }
+        SetErrorFile(parse_errors, camp_file);
         result.errors.insert(result.errors.end(), parse_errors.begin(), parse_errors.end());
       }
 
       // all species in version 0 are in the gas phase
       types::Phase gas_phase;
       gas_phase.name = "GAS";
+      gas_phase.species.reserve(result.mechanism->species.size());
       for (auto& species : result.mechanism->species)
       {
         gas_phase.species.push_back(species.name);
       }
+      result.mechanism->phases.push_back(std::move(gas_phase));
 
       result.mechanism->version = Version(0, 0, 0);
 
@@ -31,8 +31,10 @@ namespace mechanism_configuration
         double scaling_factor = object[validation::SCALING_FACTOR] ? object[validation::SCALING_FACTOR].as<double>() : 1.0;
 
         std::string name = "PHOTO." + object[validation::MUSICA_NAME].as<std::string>();
-        types::UserDefined user_defined = { .scaling_factor = scaling_factor, .reactants = reactants, .products = products, .name = name };
-        mechanism->reactions.user_defined.push_back(user_defined);
+        types::UserDefined user_defined = {
+          .scaling_factor = scaling_factor, .reactants = std::move(reactants), .products = std::move(products), .name = std::move(name)
+        };
+        mechanism->reactions.user_defined.push_back(std::move(user_defined));
       }
 
       return errors;
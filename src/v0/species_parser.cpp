@@ -17,9 +17,8 @@ namespace mechanism_configuration
       errors.insert(errors.end(), validate.begin(), validate.end());
       if (validate.empty())
       {
-        std::string name = object[validation::NAME].as<std::string>();
         types::Species species;
-        species.name = name;
+        species.name = object[validation::NAME].as<std::string>();
 
         if (object[validation::MOL_WEIGHT])
           species.molecular_weight = object[validation::MOL_WEIGHT].as<double>();
@@ -39,11 +38,10 @@ namespace mechanism_configuration
           if (std::find(required.begin(), required.end(), key) == required.end() &&
               std::find(optional.begin(), optional.end(), key) == optional.end())
           {
-            std::string stringValue = value.as<std::string>();
-            species.unknown_properties[key] = stringValue;
+            species.unknown_properties[key] = value.as<std::string>();
           }
         }
-        mechanism->species.push_back(species);
+        mechanism->species.push_back(std::move(species));
       }
 
       return errors;
@@ -67,6 +65,7 @@ namespace mechanism_configuration
     Errors ParseReactants(const YAML::Node& object, std::vector<types::ReactionComponent>& reactants)
     {
       Errors errors;
+      reactants.reserve(reactants.size() + object.size());
       for (auto it = object.begin(); it != object.end(); ++it)
       {
         auto key = it->first.as<std::string>();
@@ -79,8 +78,7 @@ namespace mechanism_configuration
           double qty = 1;
           if (value[validation::QTY])
             qty = value[validation::QTY].as<std::size_t>();
-          types::ReactionComponent reactant = { .species_name = key, .coefficient = qty };
-          reactants.push_back(reactant);
+          reactants.push_back({ .species_name = std::move(key), .coefficient = qty });
         }
       }
 
@@ -90,6 +88,7 @@ namespace mechanism_configuration
     Errors ParseProducts(const YAML::Node& object, std::vector<types::ReactionComponent>& products)
     {
       Errors errors;
+      products.reserve(products.size() + object.size());
       for (auto it = object.begin(); it != object.end(); ++it)
       {
         auto key = it->first.as<std::string>();
@@ -99,13 +98,13 @@ namespace mechanism_configuration
         errors.insert(errors.end(), validate.begin(), validate.end());
         if (validate.empty())
         {
-          types::ReactionComponent product = { .species_name = key, .coefficient = 1 };
+          types::ReactionComponent product = { .species_name = std::move(key), .coefficient = 1 };
           if (value[validation::YIELD])
           {
             double yield = value[validation::YIELD].as<double>();
             product.coefficient = yield;
           }
-          products.push_back(product);
+          products.push_back(std::move(product));
         }
       }
       return errors;
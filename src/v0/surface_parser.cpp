@@ -18,29 +18,20 @@ namespace mechanism_configuration
       errors.insert(errors.end(), validate.begin(), validate.end());
       if (validate.empty())
       {
-        std::vector<types::ReactionComponent> reactants;
-        std::vector<types::ReactionComponent> products;
-
-        std::string species_name = object[validation::GAS_PHASE_REACTANT].as<std::string>();
-        reactants.push_back({ .species_name = species_name, .coefficient = 1.0 });
-
-        auto parse_error = ParseProducts(object[validation::GAS_PHASE_PRODUCTS], products);
-        errors.insert(errors.end(), parse_error.begin(), parse_error.end());
-
         types::Surface parameters;
+        parameters.gas_phase_species = { .species_name = object[validation::GAS_PHASE_REACTANT].as<std::string>(), .coefficient = 1.0 };
 
-        parameters.gas_phase_species = reactants[0];
-        parameters.gas_phase_products = products;
+        auto parse_error = ParseProducts(object[validation::GAS_PHASE_PRODUCTS], parameters.gas_phase_products);
+        errors.insert(errors.end(), parse_error.begin(), parse_error.end());
 
         if (object[validation::PROBABILITY])
         {
           parameters.reaction_probability = object[validation::PROBABILITY].as<double>();
         }
 
-        std::string name = "SURF." + object[validation::MUSICA_NAME].as<std::string>();
-        parameters.name = name;
+        parameters.name = "SURF." + object[validation::MUSICA_NAME].as<std::string>();
 
-        mechanism->reactions.surface.push_back(parameters);
+        mechanism->reactions.surface.push_back(std::move(parameters));
       }
 
       return errors;
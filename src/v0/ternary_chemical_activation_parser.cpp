@@ -73,9 +73,9 @@ namespace mechanism_configuration
           parameters.N = object[validation::N].as<double>();
         }
 
-        parameters.reactants = reactants;
-        parameters.products = products;
-        mechanism->reactions.ternary_chemical_activation.push_back(parameters);
+        parameters.reactants = std::move(reactants);
+        parameters.products = std::move(products);
+        mechanism->reactions.ternary_chemical_activation.push_back(std::move(parameters));
       }
 
       return errors;
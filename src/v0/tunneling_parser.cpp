@@ -49,9 +49,9 @@ namespace mechanism_configuration
           parameters.C = object[validation::C].as<double>();
         }
 
-        parameters.reactants = reactants;
-        parameters.products = products;
-        mechanism->reactions.tunneling.push_back(parameters);
+        parameters.reactants = std::move(reactants);
+        parameters.products = std::move(products);
+        mechanism->reactions.tunneling.push_back(std::move(parameters));
       }
 
       return errors;
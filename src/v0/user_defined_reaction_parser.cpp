@@ -32,8 +32,10 @@ namespace mechanism_configuration
 
         std::string name = "USER." + object[validation::MUSICA_NAME].as<std::string>();
 
-        types::UserDefined user_defined = { .scaling_factor = scaling_factor, .reactants = reactants, .products = products, .name = name };
-        mechanism->reactions.user_defined.push_back(user_defined);
+        types::UserDefined user_defined = {
+          .scaling_factor = scaling_factor, .reactants = std::move(reactants), .products = std::move(products), .name = std::move(name)
+        };
+        mechanism->reactions.user_defined.push_back(std::move(user_defined));
       }
 
       return errors;
@@ -0,0 +1,375 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <mechanism_configuration/v1/binary_format.hpp>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    namespace
+    {
+      constexpr std::uint32_t kMagic = 0x3142434d;  // "MCB1" when written little-endian
+      constexpr std::uint32_t kFormatVersion = 1;
+      constexpr std::uint32_t kByteOrderMark = 0x01020304;
+
+      constexpr std::uint32_t ByteSwap(std::uint32_t value)
+      {
+        return (value >> 24) | ((value >> 8) & 0x0000ff00) | ((value << 8) & 0x00ff0000) | (value << 24);
+      }
+
+      template<typename T, typename Expected>
+      concept Is = std::is_same_v<std::remove_const_t<T>, Expected>;
+
+      template<typename T>
+      struct IsArray : std::false_type
+      {
+      };
+
+      template<typename T, std::size_t N>
+      struct IsArray<std::array<T, N>> : std::true_type
+      {
+      };
+
+      class Writer
+      {
+       public:
+        std::vector<std::byte> bytes;
+
+        template<typename... Ts>
+        void operator()(const Ts&... values)
+        {
+          (Write(values), ...);
+        }
+
+       private:
+        template<typename T>
+        void Write(const T& value)
+        {
+          if constexpr (std::is_arithmetic_v<T>)
+          {
+            auto begin = reinterpret_cast<const std::byte*>(&value);
+            bytes.insert(bytes.end(), begin, begin + sizeof(T));
+          }
+          else if constexpr (std::is_same_v<T, std::string>)
+          {
+            Write(static_cast<std::uint64_t>(value.size()));
+            auto begin = reinterpret_cast<const std::byte*>(value.data());
+            bytes.insert(bytes.end(), begin, begin + value.size());
+          }
+          else if constexpr (requires { value.has_value(); })
+          {
+            Write(static_cast<std::uint8_t>(value.has_value()));
+            if (value)
+            {
+              Write(*value);
+            }
+          }
+          else if constexpr (requires { value.begin(); value.size(); })
+          {
+            Write(static_cast<std::uint64_t>(value.size()));
+            for (const auto& element : value)
+            {
+              Write(element);
+            }
+          }
+          else if constexpr (requires { value.first; value.second; })
+          {
+            Write(value.first);
+            Write(value.second);
+          }
+          else
+          {
+            Fields(*this, value);
+          }
+        }
+      };
+
+      class Reader
+      {
+       public:
+        explicit Reader(std::span<const std::byte> data)
+            : data_(data)
+        {
+        }
+
+        template<typename... Ts>
+        void operator()(Ts&... values)
+        {
+          (Read(values), ...);
+        }
+
+        bool AtEnd() const
+        {
+          return position_ == data_.size();
+        }
+
+       private:
+        std::span<const std::byte> Take(std::size_t size)
+        {
+          if (size > data_.size() - position_)
+          {
+            throw std::invalid_argument("Binary mechanism is truncated");
+          }
+          auto taken = data_.subspan(position_, size);
+          position_ += size;
+          return taken;
+        }
+
+        std::size_t ReadSize()
+        {
+          std::uint64_t size;
+          Read(size);
+          // every element takes at least one byte, so a larger count can only come from corrupt data
+          if (size > data_.size() - position_)
+          {
+            throw std::invalid_argument("Binary mechanism is truncated");
+          }
+          return static_cast<std::size_t>(size);
+        }
+
+        template<typename T>
+        void Read(T& value)
+        {
+          if constexpr (std::is_arithmetic_v<T>)
+          {
+            std::memcpy(&value, Take(sizeof(T)).data(), sizeof(T));
+          }
+          else if constexpr (std::is_same_v<T, std::string>)
+          {
+            auto size = ReadSize();
+            auto chars = Take(size);
+            value.assign(reinterpret_cast<const char*>(chars.data()), size);
+          }
+          else if constexpr (requires { value.has_value(); })
+          {
+            std::uint8_t has_value;
+            Read(has_value);
+            if (has_value)
+            {
+              Read(value.emplace());
+            }
+            else
+            {
+              value.reset();
+            }
+          }
+          else if constexpr (requires { typename T::mapped_type; })
+          {
+            auto size = ReadSize();
+            value.clear();
+            value.reserve(size);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+              std::string key, mapped;
+              Read(key);
+              Read(mapped);
+              value.emplace(std::move(key), std::move(mapped));
+            }
+          }
+          else if constexpr (requires { value.resize(0); })
+          {
+            value.resize(ReadSize());
+            for (auto& element : value)
+            {
+              Read(element);
+            }
+          }
+          else if constexpr (IsArray<T>::value)
+          {
+            if (ReadSize() != value.size())
+            {
+              throw std::invalid_argument("Binary mechanism has a parameter array of the wrong size");
+            }
+            for (auto& element : value)
+            {
+              Read(element);
+            }
+          }
+          else
+          {
+            Fields(*this, value);
+          }
+        }
+
+        std::span<const std::byte> data_;
+        std::size_t position_ = 0;
+      };
+
+      // Each Fields overload lists the members of one type, and is shared by the writer and the reader so the
+      // two can never disagree on the layout. Any change to these lists must bump kFormatVersion.
+
+      template<typename Archive, Is<Version> T>
+      void Fields(Archive& archive, T& version)
+      {
+        archive(version.major, version.minor, version.patch);
+      }
+
+      template<typename Archive, Is<types::Species> T>
+      void Fields(Archive& archive, T& species)
+      {
+        archive(
+            species.name,
+            species.absolute_tolerance,
+            species.diffusion_coefficient,
+            species.molecular_weight,
+            species.henrys_law_constant_298,
+            species.henrys_law_constant_exponential_factor,
+            species.n_star,
+            species.density,
+            species.tracer_type,
+            species.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::Phase> T>
+      void Fields(Archive& archive, T& phase)
+      {
+        archive(phase.name, phase.species, phase.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::ReactionComponent> T>
+      void Fields(Archive& archive, T& component)
+      {
+        archive(component.species_name, component.coefficient, component.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::Arrhenius> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(r.A, r.B, r.C, r.D, r.E, r.reactants, r.products, r.name, r.gas_phase, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::CondensedPhaseArrhenius> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(r.A, r.B, r.C, r.D, r.E, r.reactants, r.products, r.name, r.aerosol_phase, r.aerosol_phase_water, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::Troe> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(
+            r.k0_A, r.k0_B, r.k0_C, r.kinf_A, r.kinf_B, r.kinf_C, r.Fc, r.N, r.reactants, r.products, r.name, r.gas_phase, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::Branched> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(r.X, r.Y, r.a0, r.n, r.reactants, r.nitrate_products, r.alkoxy_products, r.name, r.gas_phase, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::Tunneling> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(r.A, r.B, r.C, r.reactants, r.products, r.name, r.gas_phase, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::Surface> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(r.reaction_probability, r.gas_phase_species, r.gas_phase_products, r.name, r.gas_phase, r.aerosol_phase, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::Photolysis> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(r.scaling_factor, r.reactants, r.products, r.name, r.gas_phase, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::CondensedPhasePhotolysis> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(r.scaling_factor_, r.reactants, r.products, r.name, r.aerosol_phase, r.aerosol_phase_water, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::Emission> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(r.scaling_factor, r.products, r.name, r.gas_phase, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::FirstOrderLoss> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(r.scaling_factor, r.reactants, r.name, r.gas_phase, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::AqueousEquilibrium> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(
+            r.name, r.gas_phase, r.aerosol_phase, r.aerosol_phase_water, r.reactants, r.products, r.A, r.C, r.k_reverse, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::WetDeposition> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(r.scaling_factor, r.name, r.aerosol_phase, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::HenrysLaw> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(r.name, r.gas_phase, r.gas_phase_species, r.aerosol_phase, r.aerosol_phase_water, r.aerosol_phase_species, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::SimpolPhaseTransfer> T>
+      void Fields(Archive& archive, T& r)
+      {
+        archive(r.gas_phase, r.gas_phase_species, r.aerosol_phase, r.aerosol_phase_species, r.name, r.B, r.unknown_properties);
+      }
+
+      template<typename Archive, Is<types::Reactions> T>
+      void Fields(Archive& archive, T& reactions)
+      {
+        types::ForEachReactionList(reactions, [&](types::ReactionType, auto& list) { archive(list); });
+      }
+
+      template<typename Archive, Is<types::Mechanism> T>
+      void Fields(Archive& archive, T& mechanism)
+      {
+        archive(mechanism.version, mechanism.name, mechanism.species, mechanism.phases, mechanism.reactions);
+      }
+    }  // namespace
+
+    std::vector<std::byte> WriteBinary(const types::Mechanism& mechanism)
+    {
+      Writer writer;
+      writer(kMagic, kByteOrderMark, kFormatVersion, mechanism);
+      return std::move(writer.bytes);
+    }
+
+    types::Mechanism ReadBinary(std::span<const std::byte> data)
+    {
+      Reader reader(data);
+      std::uint32_t magic, byte_order_mark, format_version;
+      reader(magic, byte_order_mark, format_version);
+      if (magic != kMagic && magic != ByteSwap(kMagic))
+      {
+        throw std::invalid_argument("Data is not a binary mechanism");
+      }
+      if (byte_order_mark != kByteOrderMark)
+      {
+        throw std::invalid_argument("Binary mechanism was written on a machine with a different byte order");
+      }
+      if (format_version != kFormatVersion)
+      {
+        throw std::invalid_argument("Unsupported binary mechanism format version " + std::to_string(format_version));
+      }
+      types::Mechanism mechanism;
+      reader(mechanism);
+      if (!reader.AtEnd())
+      {
+        throw std::invalid_argument("Binary mechanism has trailing data");
+      }
+      return mechanism;
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
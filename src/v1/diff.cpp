@@ -0,0 +1,546 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/v1/diff.hpp>
+#include <mechanism_configuration/v1/reaction_parameters.hpp>
+#include <mechanism_configuration/v1/validation.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    namespace
+    {
+      using validation::keys;
+
+      const std::string& RoleKey(types::ComponentRole role)
+      {
+        switch (role)
+        {
+          case types::ComponentRole::Reactant: return keys.reactants;
+          case types::ComponentRole::Product: return keys.products;
+          case types::ComponentRole::NitrateProduct: return keys.nitrate_products;
+          case types::ComponentRole::AlkoxyProduct: return keys.alkoxy_products;
+          case types::ComponentRole::GasPhaseSpecies: return keys.gas_phase_species;
+          case types::ComponentRole::GasPhaseProduct: return keys.gas_phase_products;
+          case types::ComponentRole::AerosolPhaseSpecies: return keys.aerosol_phase_species;
+          case types::ComponentRole::AerosolPhaseWater: return keys.aerosol_phase_water;
+        }
+        return keys.species;
+      }
+
+      using Component = std::tuple<types::ComponentRole, std::string_view, double>;
+
+      template<typename ReactionT>
+      std::vector<Component> SortedComponents(const ReactionT& reaction)
+      {
+        std::vector<Component> components;
+        types::ForEachComponent(reaction, [&](types::ComponentRole role, const std::string& name, double coefficient)
+                                { components.emplace_back(role, name, coefficient); });
+        std::sort(components.begin(), components.end());
+        return components;
+      }
+
+      /// @brief A key that is equal for reactions with the same phases and the same species in the same roles
+      template<typename ReactionT>
+      std::string StructuralKey(const ReactionT& reaction)
+      {
+        std::string key;
+        types::ForEachPhaseName(reaction, [&](const std::string& phase) { key.append(phase).push_back('\0'); });
+        for (const auto& [role, name, coefficient] : SortedComponents(reaction))
+        {
+          key.push_back(static_cast<char>('a' + static_cast<int>(role)));
+          key.append(name).push_back('\0');
+        }
+        return key;
+      }
+
+      void AppendValue(std::string& key, double value)
+      {
+        // +0 and -0 are the same value, as in the reaction hash
+        value = value == 0.0 ? 0.0 : value;
+        key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+      }
+
+      /// @brief A key that is equal for reactions that differ at most in their unknown properties
+      template<typename ReactionT>
+      std::string ExactKey(const ReactionT& reaction)
+      {
+        std::string key = StructuralKey(reaction);
+        key.append(reaction.name).push_back('\0');
+        for (const auto& [role, name, coefficient] : SortedComponents(reaction))
+        {
+          AppendValue(key, coefficient);
+        }
+        ForEachParameter(reaction, [&](const std::string&, double value) { AppendValue(key, value); });
+        return key;
+      }
+
+      /// @brief Writes a reaction as "2 A + B -> C", or returns its name if it has one
+      template<typename ReactionT>
+      std::string Describe(const ReactionT& reaction)
+      {
+        if (!reaction.name.empty())
+        {
+          return reaction.name;
+        }
+        std::string left, right;
+        types::ForEachComponent(
+            reaction,
+            [&](types::ComponentRole role, const std::string& name, double coefficient)
+            {
+              if (!types::IsReactant(role) && !types::IsProduct(role))
+              {
+                return;
+              }
+              auto& side = types::IsReactant(role) ? left : right;
+              if (!side.empty())
+              {
+                side += " + ";
+              }
+              if (coefficient != 1.0)
+              {
+                auto number = std::to_string(coefficient);
+                number.erase(number.find_last_not_of('0') + 1);
+                if (number.back() == '.')
+                {
+                  number.pop_back();
+                }
+                side += number + " ";
+              }
+              side += name;
+            });
+        return left + " -> " + right;
+      }
+
+      bool SameValue(double a, double b)
+      {
+        return a == b || (std::isnan(a) && std::isnan(b));
+      }
+
+      bool SameValue(const std::optional<double>& a, const std::optional<double>& b)
+      {
+        return a.has_value() == b.has_value() && (!a || SameValue(*a, *b));
+      }
+
+      template<typename ReactionT>
+      ReactionChange Compare(types::ReactionType type, const ReactionT& before, const ReactionT& after)
+      {
+        ReactionChange change{ ChangeKind::Modified, type, Describe(after), std::nullopt, std::nullopt, {}, {} };
+
+        std::vector<ParameterChange> before_parameters;
+        ForEachParameter(before, [&](const std::string& name, double value) { before_parameters.push_back({ name, value, value }); });
+        std::size_t i = 0;
+        ForEachParameter(
+            after,
+            [&](const std::string&, double value)
+            {
+              auto& parameter = before_parameters[i++];
+              if (!SameValue(parameter.before, value))
+              {
+                parameter.after = value;
+                change.parameters.push_back(parameter);
+              }
+            });
+
+        if (before.name != after.name)
+        {
+          change.fields.push_back(keys.name);
+        }
+        if constexpr (requires { before.gas_phase; })
+        {
+          if (before.gas_phase != after.gas_phase)
+            change.fields.push_back(keys.gas_phase);
+        }
+        if constexpr (requires { before.aerosol_phase; })
+        {
+          if (before.aerosol_phase != after.aerosol_phase)
+            change.fields.push_back(keys.aerosol_phase);
+        }
+
+        auto before_components = SortedComponents(before);
+        auto after_components = SortedComponents(after);
+        if (before_components != after_components)
+        {
+          // report each role whose species or coefficients differ
+          std::vector<types::ComponentRole> roles;
+          for (const auto& components : { &before_components, &after_components })
+          {
+            for (const auto& component : *components)
+            {
+              roles.push_back(std::get<0>(component));
+            }
+          }
+          std::sort(roles.begin(), roles.end());
+          roles.erase(std::unique(roles.begin(), roles.end()), roles.end());
+          for (auto role : roles)
+          {
+            auto in_role = [role](const Component& component) { return std::get<0>(component) == role; };
+            std::vector<Component> b, a;
+            std::copy_if(before_components.begin(), before_components.end(), std::back_inserter(b), in_role);
+            std::copy_if(after_components.begin(), after_components.end(), std::back_inserter(a), in_role);
+            if (b != a)
+            {
+              change.fields.push_back(RoleKey(role));
+            }
+          }
+        }
+
+        if (before.unknown_properties != after.unknown_properties)
+        {
+          change.fields.push_back("unknown properties");
+        }
+        return change;
+      }
+
+      /// @brief Indices of equivalent reactions, handed out in order so duplicates pair up one to one
+      struct Bucket
+      {
+        std::vector<std::size_t> indices;
+        std::size_t next{ 0 };
+
+        std::optional<std::size_t> Take()
+        {
+          if (next == indices.size())
+          {
+            return std::nullopt;
+          }
+          return indices[next++];
+        }
+      };
+
+      template<typename ReactionT>
+      void DiffReactions(
+          types::ReactionType type,
+          const std::vector<ReactionT>& before,
+          const std::vector<ReactionT>& after,
+          std::vector<ReactionChange>& changes)
+      {
+        std::vector<std::optional<std::size_t>> match(after.size());
+        std::vector<bool> matched(before.size(), false);
+
+        // pair identical reactions first, then reactions with the same name, then reactions with the same structure
+        auto pass = [&](auto&& key_of, bool named_only)
+        {
+          using Key = std::decay_t<decltype(key_of(std::declval<const ReactionT&>()))>;
+          std::unordered_map<Key, Bucket> buckets;
+          for (std::size_t i = 0; i < before.size(); ++i)
+          {
+            if (!matched[i] && !(named_only && before[i].name.empty()))
+            {
+              buckets[key_of(before[i])].indices.push_back(i);
+            }
+          }
+          for (std::size_t j = 0; j < after.size(); ++j)
+          {
+            if (match[j] || (named_only && after[j].name.empty()))
+            {
+              continue;
+            }
+            auto bucket = buckets.find(key_of(after[j]));
+            if (bucket != buckets.end())
+            {
+              match[j] = bucket->second.Take();
+              if (match[j])
+              {
+                matched[*match[j]] = true;
+              }
+            }
+          }
+        };
+        pass([](const ReactionT& r) { return ExactKey(r); }, false);
+        pass([](const ReactionT& r) { return std::string_view(r.name); }, true);
+        pass([](const ReactionT& r) { return StructuralKey(r); }, false);
+
+        for (std::size_t j = 0; j < after.size(); ++j)
+        {
+          if (!match[j])
+          {
+            changes.push_back({ ChangeKind::Added, type, Describe(after[j]), std::nullopt, j, {}, {} });
+            continue;
+          }
+          auto change = Compare(type, before[*match[j]], after[j]);
+          if (!change.parameters.empty() || !change.fields.empty())
+          {
+            change.before_index = *match[j];
+            change.after_index = j;
+            changes.push_back(std::move(change));
+          }
+        }
+        for (std::size_t i = 0; i < before.size(); ++i)
+        {
+          if (!matched[i])
+          {
+            changes.push_back({ ChangeKind::Removed, type, Describe(before[i]), i, std::nullopt, {}, {} });
+          }
+        }
+      }
+
+      /// @brief Finds the list in reactions that holds the same reaction type as list
+      template<typename ReactionT>
+      const std::vector<ReactionT>& MatchingList(const types::Reactions& reactions, const std::vector<ReactionT>&)
+      {
+        const std::vector<ReactionT>* found = nullptr;
+        types::ForEachReactionList(
+            reactions,
+            [&](types::ReactionType, const auto& list)
+            {
+              if constexpr (std::is_same_v<std::decay_t<decltype(list)>, std::vector<ReactionT>>)
+                found = &list;
+            });
+        return *found;
+      }
+
+      std::vector<std::string> ChangedProperties(const types::Species& before, const types::Species& after)
+      {
+        std::vector<std::string> properties;
+        auto compare = [&](const std::string& key, const std::optional<double>& b, const std::optional<double>& a)
+        {
+          if (!SameValue(b, a))
+            properties.push_back(key);
+        };
+        compare(keys.absolute_tolerance, before.absolute_tolerance, after.absolute_tolerance);
+        compare(keys.diffusion_coefficient, before.diffusion_coefficient, after.diffusion_coefficient);
+        compare(keys.molecular_weight, before.molecular_weight, after.molecular_weight);
+        compare(keys.henrys_law_constant_298, before.henrys_law_constant_298, after.henrys_law_constant_298);
+        compare(
+            keys.henrys_law_constant_exponential_factor,
+            before.henrys_law_constant_exponential_factor,
+            after.henrys_law_constant_exponential_factor);
+        compare(keys.n_star, before.n_star, after.n_star);
+        compare(keys.density, before.density, after.density);
+        if (before.tracer_type != after.tracer_type)
+        {
+          properties.push_back(keys.tracer_type);
+        }
+        if (before.unknown_properties != after.unknown_properties)
+        {
+          properties.push_back("unknown properties");
+        }
+        return properties;
+      }
+
+      template<typename T>
+      std::unordered_map<std::string_view, const T*> ByName(const std::vector<T>& items)
+      {
+        std::unordered_map<std::string_view, const T*> map;
+        map.reserve(items.size());
+        for (const auto& item : items)
+        {
+          map.emplace(item.name, &item);
+        }
+        return map;
+      }
+
+      void DiffSpecies(const types::Mechanism& before, const types::Mechanism& after, MechanismDiff& diff)
+      {
+        auto before_species = ByName(before.species);
+        auto after_species = ByName(after.species);
+        for (const auto& species : after.species)
+        {
+          auto match = before_species.find(species.name);
+          if (match == before_species.end())
+          {
+            diff.species.push_back({ species.name, ChangeKind::Added, {} });
+            continue;
+          }
+          auto properties = ChangedProperties(*match->second, species);
+          if (!properties.empty())
+          {
+            diff.species.push_back({ species.name, ChangeKind::Modified, std::move(properties) });
+          }
+        }
+        for (const auto& species : before.species)
+        {
+          if (!after_species.contains(species.name))
+          {
+            diff.species.push_back({ species.name, ChangeKind::Removed, {} });
+          }
+        }
+      }
+
+      void DiffPhases(const types::Mechanism& before, const types::Mechanism& after, MechanismDiff& diff)
+      {
+        auto before_phases = ByName(before.phases);
+        auto after_phases = ByName(after.phases);
+
+        // the phases of each species, to find species that moved
+        std::unordered_map<std::string_view, SpeciesMove> moves;
+        std::vector<std::string_view> move_order;
+        auto record = [&](const std::string& species, const std::string& phase, bool added)
+        {
+          auto [entry, inserted] = moves.try_emplace(species);
+          if (inserted)
+          {
+            entry->second.species = species;
+            move_order.push_back(entry->first);
+          }
+          (added ? entry->second.added_to : entry->second.removed_from).push_back(phase);
+        };
+
+        for (const auto& phase : after.phases)
+        {
+          auto match = before_phases.find(phase.name);
+          if (match == before_phases.end())
+          {
+            diff.phases.push_back({ phase.name, ChangeKind::Added, phase.species, {}, false });
+            for (const auto& species : phase.species)
+            {
+              record(species, phase.name, true);
+            }
+            continue;
+          }
+          const auto& old_phase = *match->second;
+          std::unordered_set<std::string_view> old_species(old_phase.species.begin(), old_phase.species.end());
+          std::unordered_set<std::string_view> new_species(phase.species.begin(), phase.species.end());
+          PhaseChange change{ phase.name, ChangeKind::Modified, {}, {}, false };
+          for (const auto& species : phase.species)
+          {
+            if (!old_species.contains(species))
+            {
+              change.added_species.push_back(species);
+              record(species, phase.name, true);
+            }
+          }
+          for (const auto& species : old_phase.species)
+          {
+            if (!new_species.contains(species))
+            {
+              change.removed_species.push_back(species);
+              record(species, phase.name, false);
+            }
+          }
+          change.unknown_properties_changed = old_phase.unknown_properties != phase.unknown_properties;
+          if (!change.added_species.empty() || !change.removed_species.empty() || change.unknown_properties_changed)
+          {
+            diff.phases.push_back(std::move(change));
+          }
+        }
+        for (const auto& phase : before.phases)
+        {
+          if (!after_phases.contains(phase.name))
+          {
+            diff.phases.push_back({ phase.name, ChangeKind::Removed, {}, phase.species, false });
+            for (const auto& species : phase.species)
+            {
+              record(species, phase.name, false);
+            }
+          }
+        }
+
+        // a species moved if it left one phase and joined another
+        for (auto species : move_order)
+        {
+          auto& move = moves[species];
+          if (!move.removed_from.empty() && !move.added_to.empty())
+          {
+            diff.moves.push_back(std::move(move));
+          }
+        }
+      }
+
+      char Marker(ChangeKind kind)
+      {
+        switch (kind)
+        {
+          case ChangeKind::Added: return '+';
+          case ChangeKind::Removed: return '-';
+          case ChangeKind::Modified: return '~';
+        }
+        return '?';
+      }
+
+      void WriteList(std::ostream& stream, const std::vector<std::string>& items)
+      {
+        for (std::size_t i = 0; i < items.size(); ++i)
+        {
+          stream << (i == 0 ? "" : ", ") << items[i];
+        }
+      }
+    }  // namespace
+
+    MechanismDiff Diff(const types::Mechanism& before, const types::Mechanism& after)
+    {
+      MechanismDiff diff;
+      DiffSpecies(before, after, diff);
+      DiffPhases(before, after, diff);
+      types::ForEachReactionList(
+          before.reactions,
+          [&](types::ReactionType type, const auto& list)
+          { DiffReactions(type, list, MatchingList(after.reactions, list), diff.reactions); });
+      return diff;
+    }
+
+    void WriteReport(const MechanismDiff& diff, std::ostream& stream)
+    {
+      for (const auto& change : diff.species)
+      {
+        stream << Marker(change.kind) << " species " << change.name;
+        if (!change.properties.empty())
+        {
+          stream << ": ";
+          WriteList(stream, change.properties);
+        }
+        stream << "\n";
+      }
+      for (const auto& change : diff.phases)
+      {
+        stream << Marker(change.kind) << " phase " << change.name;
+        if (change.kind == ChangeKind::Modified)
+        {
+          std::string separator = ": ";
+          for (const auto& species : change.added_species)
+          {
+            stream << separator << "+" << species;
+            separator = " ";
+          }
+          for (const auto& species : change.removed_species)
+          {
+            stream << separator << "-" << species;
+            separator = " ";
+          }
+          if (change.unknown_properties_changed)
+          {
+            stream << separator << "unknown properties";
+          }
+        }
+        stream << "\n";
+      }
+      for (const auto& move : diff.moves)
+      {
+        stream << "> species " << move.species << " moved from ";
+        WriteList(stream, move.removed_from);
+        stream << " to ";
+        WriteList(stream, move.added_to);
+        stream << "\n";
+      }
+      for (const auto& change : diff.reactions)
+      {
+        stream << Marker(change.kind) << " " << validation::TypeKey(change.type) << " " << change.description;
+        std::string separator = ": ";
+        for (const auto& parameter : change.parameters)
+        {
+          stream << separator << parameter.name << " " << parameter.before << " -> " << parameter.after;
+          separator = ", ";
+        }
+        for (const auto& field : change.fields)
+        {
+          stream << separator << field;
+          separator = ", ";
+        }
+        stream << "\n";
+      }
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,310 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <array>
+#include <mechanism_configuration/v1/ensemble.hpp>
+#include <mechanism_configuration/v1/reaction_parameters.hpp>
+#include <stdexcept>
+#include <type_traits>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    namespace
+    {
+      /// @brief The most parameters of any reaction with a rate constant, those of Troe
+      constexpr std::size_t max_parameters = 8;
+
+      /// @brief Calls f(reaction) with the reaction a ReactionIndex refers to
+      template<typename Reactions, typename Func>
+      void VisitReaction(Reactions& reactions, const ReactionIndex& index, Func&& f)
+      {
+        types::ForEachReactionList(
+            reactions,
+            [&](types::ReactionType type, auto& list)
+            {
+              if (type == index.type)
+                f(list[index.index]);
+            });
+      }
+
+      /// @brief Sets the numeric parameter of a reaction with a configuration key, the inverse of ForEachParameter
+      template<DescribedReaction T>
+      void SetParameter(T& reaction, const std::string& key, double value)
+      {
+        ForEachField(
+            ReactionDescriptor<T>::fields,
+            [&](const auto& field)
+            {
+              using Field = std::decay_t<decltype(field)>;
+              if constexpr (Field::kind == descriptors::FieldKind::Number)
+              {
+                using M = std::decay_t<decltype(reaction.*field.member)>;
+                if (descriptors::KeyName(field.key) == key)
+                  reaction.*field.member = static_cast<M>(value);
+              }
+            });
+      }
+
+      template<typename A, typename B>
+      constexpr bool SameMember(A a, B b)
+      {
+        if constexpr (std::is_same_v<A, B>)
+          return a == b;
+        else
+          return false;
+      }
+
+      /// @brief Whether the numeric parameters of a reaction type, in ForEachParameter order, are exactly these members
+      template<DescribedReaction T, typename... Members>
+      constexpr bool ParametersAre(Members... members)
+      {
+        std::size_t position = 0;
+        bool matches = true;
+        ForEachField(
+            ReactionDescriptor<T>::fields,
+            [&](const auto& field)
+            {
+              using Field = std::decay_t<decltype(field)>;
+              if constexpr (Field::kind == descriptors::FieldKind::Number)
+              {
+                std::size_t i = 0;
+                ((matches = matches && (i++ != position || SameMember(field.member, members))), ...);
+                ++position;
+              }
+              else if constexpr (Field::kind == descriptors::FieldKind::NumberList)
+              {
+                matches = false;
+              }
+            });
+        return matches && position == sizeof...(members);
+      }
+
+      // Evaluate reads parameters by position, so each position must hold the parameter it is read as
+      static_assert(ParametersAre<types::Arrhenius>(
+          &types::Arrhenius::A,
+          &types::Arrhenius::B,
+          &types::Arrhenius::C,
+          &types::Arrhenius::D,
+          &types::Arrhenius::E));
+      static_assert(ParametersAre<types::CondensedPhaseArrhenius>(
+          &types::CondensedPhaseArrhenius::A,
+          &types::CondensedPhaseArrhenius::B,
+          &types::CondensedPhaseArrhenius::C,
+          &types::CondensedPhaseArrhenius::D,
+          &types::CondensedPhaseArrhenius::E));
+      static_assert(ParametersAre<types::Troe>(
+          &types::Troe::k0_A,
+          &types::Troe::k0_B,
+          &types::Troe::k0_C,
+          &types::Troe::kinf_A,
+          &types::Troe::kinf_B,
+          &types::Troe::kinf_C,
+          &types::Troe::Fc,
+          &types::Troe::N));
+      static_assert(ParametersAre<types::Tunneling>(&types::Tunneling::A, &types::Tunneling::B, &types::Tunneling::C));
+      static_assert(ParametersAre<types::Branched>(&types::Branched::X, &types::Branched::Y, &types::Branched::a0, &types::Branched::n));
+      static_assert(ParametersAre<types::Photolysis>(&types::Photolysis::scaling_factor));
+      static_assert(ParametersAre<types::CondensedPhasePhotolysis>(&types::CondensedPhasePhotolysis::scaling_factor_));
+      static_assert(ParametersAre<types::Emission>(&types::Emission::scaling_factor));
+      static_assert(ParametersAre<types::FirstOrderLoss>(&types::FirstOrderLoss::scaling_factor));
+      static_assert(ParametersAre<types::WetDeposition>(&types::WetDeposition::scaling_factor));
+
+      /// @brief Writes the rate constants of a reaction for one member from its parameters, which are in
+      ///        ForEachParameter order
+      void Evaluate(
+          types::ReactionType type,
+          const double* p,
+          const Conditions& conditions,
+          double external,
+          double* k,
+          std::size_t stride)
+      {
+        using types::ReactionType;
+        switch (type)
+        {
+          case ReactionType::Arrhenius:
+          case ReactionType::CondensedPhaseArrhenius: k[0] = rates::Arrhenius(p[0], p[1], p[2], p[3], p[4], conditions); break;
+          case ReactionType::Troe: k[0] = rates::Troe(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], conditions); break;
+          case ReactionType::Tunneling: k[0] = rates::Tunneling(p[0], p[1], p[2], conditions); break;
+          case ReactionType::Branched:
+            k[0] = rates::Branched(p[0], p[1], p[2], static_cast<int>(p[3]), RateChannel::Nitrate, conditions);
+            k[stride] = rates::Branched(p[0], p[1], p[2], static_cast<int>(p[3]), RateChannel::Alkoxy, conditions);
+            break;
+          default: k[0] = p[0] * external; break;
+        }
+      }
+    }  // namespace
+
+    Ensemble::Ensemble(std::shared_ptr<const types::Mechanism> mechanism, std::size_t number_of_members)
+        : members_(number_of_members)
+    {
+      if (!mechanism)
+      {
+        throw std::invalid_argument("An ensemble needs a mechanism");
+      }
+      auto shared = std::make_shared<Shared>(Shared{ mechanism, RateConstants(*mechanism), {}, {}, {} });
+      const auto& layout = shared->rates.Layout();
+      for (std::size_t slot = 0; slot < layout.size(); ++slot)
+      {
+        // Both branches of a branched reaction come from the nitrate slot's parameters
+        if (layout[slot].channel == RateChannel::Alkoxy)
+          continue;
+        auto& entry = shared->reactions.emplace_back(Reaction{ layout[slot].reaction, slot, shared->parameters.size(), 0, layout[slot].external });
+        VisitReaction(
+            mechanism->reactions,
+            layout[slot].reaction,
+            [&](const auto& reaction)
+            {
+              ForEachParameter(
+                  reaction,
+                  [&](const std::string& key, double value)
+                  {
+                    shared->parameters.push_back({ layout[slot].reaction, key, value });
+                    shared->parameter_reactions.push_back(shared->reactions.size() - 1);
+                  });
+            });
+        entry.number_of_parameters = shared->parameters.size() - entry.first_parameter;
+        if (entry.number_of_parameters > max_parameters)
+        {
+          throw std::logic_error("A reaction has more rate parameters than an ensemble supports");
+        }
+      }
+      shared_ = std::move(shared);
+    }
+
+    std::size_t Ensemble::AddMember()
+    {
+      members_.emplace_back();
+      return members_.size() - 1;
+    }
+
+    std::size_t Ensemble::CopyMember(std::size_t member)
+    {
+      CheckMember(member);
+      members_.push_back(members_[member]);
+      return members_.size() - 1;
+    }
+
+    std::optional<std::size_t> Ensemble::FindParameter(const ReactionIndex& reaction, std::string_view key) const
+    {
+      const auto& parameters = shared_->parameters;
+      for (std::size_t i = 0; i < parameters.size(); ++i)
+      {
+        if (parameters[i].reaction.type == reaction.type && parameters[i].reaction.index == reaction.index && parameters[i].key == key)
+          return i;
+      }
+      return std::nullopt;
+    }
+
+    void Ensemble::Set(std::size_t member, std::size_t parameter, double value)
+    {
+      CheckMember(member);
+      CheckParameter(parameter);
+      auto& overrides = members_[member];
+      auto it = std::lower_bound(
+          overrides.begin(), overrides.end(), parameter, [](const ParameterOverride& o, std::size_t p) { return o.parameter < p; });
+      const bool present = it != overrides.end() && it->parameter == parameter;
+      if (value == shared_->parameters[parameter].value)
+      {
+        if (present)
+          overrides.erase(it);
+      }
+      else if (present)
+      {
+        it->value = value;
+      }
+      else
+      {
+        overrides.insert(it, { parameter, value });
+      }
+    }
+
+    double Ensemble::Get(std::size_t member, std::size_t parameter) const
+    {
+      CheckMember(member);
+      CheckParameter(parameter);
+      const auto& overrides = members_[member];
+      auto it = std::lower_bound(
+          overrides.begin(), overrides.end(), parameter, [](const ParameterOverride& o, std::size_t p) { return o.parameter < p; });
+      if (it != overrides.end() && it->parameter == parameter)
+      {
+        return it->value;
+      }
+      return shared_->parameters[parameter].value;
+    }
+
+    types::Mechanism Ensemble::Materialize(std::size_t member) const
+    {
+      CheckMember(member);
+      types::Mechanism mechanism = *shared_->mechanism;
+      for (const auto& override : members_[member])
+      {
+        const auto& parameter = shared_->parameters[override.parameter];
+        VisitReaction(mechanism.reactions, parameter.reaction, [&](auto& reaction) { SetParameter(reaction, parameter.key, override.value); });
+      }
+      return mechanism;
+    }
+
+    void Ensemble::Calculate(const Conditions& conditions, std::span<const double> external, std::span<double> k) const
+    {
+      const std::size_t members = members_.size();
+      if (k.size() != Size() * members)
+      {
+        throw std::invalid_argument(
+            "Expected space for " + std::to_string(Size()) + " rows of " + std::to_string(members) + " rate constants, got " +
+            std::to_string(k.size()));
+      }
+
+      // The shared rate constants, for every member
+      std::vector<double> shared_k(Size());
+      shared_->rates.Calculate(conditions, external, shared_k);
+      for (std::size_t i = 0; i < shared_k.size(); ++i)
+      {
+        std::fill_n(k.begin() + static_cast<std::ptrdiff_t>(i * members), members, shared_k[i]);
+      }
+
+      // Each member's changed reactions. Overrides are sorted, so those of one reaction are adjacent.
+      std::array<double, max_parameters> p;
+      for (std::size_t m = 0; m < members; ++m)
+      {
+        const auto& overrides = members_[m];
+        for (std::size_t o = 0; o < overrides.size();)
+        {
+          const Reaction& reaction = shared_->reactions[shared_->parameter_reactions[overrides[o].parameter]];
+          const std::size_t first = reaction.first_parameter;
+          const std::size_t last = first + reaction.number_of_parameters;
+          for (std::size_t i = first; i < last; ++i)
+          {
+            p[i - first] = shared_->parameters[i].value;
+          }
+          for (; o < overrides.size() && overrides[o].parameter < last; ++o)
+          {
+            p[overrides[o].parameter - first] = overrides[o].value;
+          }
+          const double external_rate = reaction.external ? external[*reaction.external] : 0.0;
+          Evaluate(reaction.reaction.type, p.data(), conditions, external_rate, &k[reaction.slot * members + m], members);
+        }
+      }
+    }
+
+    void Ensemble::CheckMember(std::size_t member) const
+    {
+      if (member >= members_.size())
+      {
+        throw std::invalid_argument("Member " + std::to_string(member) + " is out of range");
+      }
+    }
+
+    void Ensemble::CheckParameter(std::size_t parameter) const
+    {
+      if (parameter >= NumberOfParameters())
+      {
+        throw std::invalid_argument("Parameter " + std::to_string(parameter) + " is out of range");
+      }
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,100 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/v1/external_rates.hpp>
+#include <mechanism_configuration/v1/rate_constants.hpp>
+#include <stdexcept>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    namespace
+    {
+      const char* KeyPrefix(types::ReactionType type)
+      {
+        switch (type)
+        {
+          case types::ReactionType::Photolysis: return "PHOTO.";
+          case types::ReactionType::CondensedPhasePhotolysis: return "CONDENSED_PHOTO.";
+          case types::ReactionType::Emission: return "EMIS.";
+          case types::ReactionType::FirstOrderLoss: return "LOSS.";
+          case types::ReactionType::WetDeposition: return "WET_DEP.";
+          default: return "";
+        }
+      }
+
+      const std::string& ReactionName(const types::Mechanism& mechanism, const ReactionIndex& reaction)
+      {
+        const std::string* name = nullptr;
+        types::ForEachReactionList(
+            mechanism.reactions,
+            [&](types::ReactionType type, const auto& list)
+            {
+              if (type == reaction.type)
+                name = &list[reaction.index].name;
+            });
+        return *name;
+      }
+    }  // namespace
+
+    ExternalRateRegistry::ExternalRateRegistry(const types::Mechanism& mechanism)
+    {
+      const auto layout = RateConstantLayout(mechanism);
+      for (std::size_t i = 0; i < layout.size(); ++i)
+      {
+        if (!layout[i].external)
+          continue;
+        ExternalRate rate;
+        rate.name = ReactionName(mechanism, layout[i].reaction);
+        rate.reaction = layout[i].reaction;
+        rate.rate_constant = i;
+        const std::string base = KeyPrefix(rate.reaction.type) + rate.name;
+        rate.key = base;
+        for (std::size_t repeat = 2; keys_.contains(rate.key); ++repeat)
+        {
+          rate.key = base + "#" + std::to_string(repeat);
+        }
+        keys_.emplace(rate.key, parameters_.size());
+        parameters_.push_back(std::move(rate));
+      }
+    }
+
+    std::optional<std::size_t> ExternalRateRegistry::Find(std::string_view key) const
+    {
+      auto it = keys_.find(key);
+      if (it == keys_.end())
+      {
+        return std::nullopt;
+      }
+      return it->second;
+    }
+
+    std::vector<std::size_t> ExternalRateRegistry::FindByName(std::string_view name) const
+    {
+      std::vector<std::size_t> found;
+      for (std::size_t i = 0; i < parameters_.size(); ++i)
+      {
+        if (parameters_[i].name == name)
+          found.push_back(i);
+      }
+      return found;
+    }
+
+    std::span<double> ExternalRateRegistry::Row(std::span<double> parameters, std::size_t parameter, std::size_t number_of_cells) const
+    {
+      if (parameters.size() != parameters_.size() * number_of_cells)
+      {
+        throw std::invalid_argument(
+            "Expected the parameter array to hold " + std::to_string(parameters_.size()) + " rows of " + std::to_string(number_of_cells) +
+            " cells, got " + std::to_string(parameters.size()) + " values");
+      }
+      if (parameter >= parameters_.size())
+      {
+        throw std::invalid_argument("Parameter " + std::to_string(parameter) + " is out of range");
+      }
+      return parameters.subspan(parameter * number_of_cells, number_of_cells);
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,132 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cmath>
+#include <mechanism_configuration/v1/forcing.hpp>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    Forcing::Forcing(const types::Mechanism& mechanism)
+        : Forcing(MassActionProcesses(mechanism))
+    {
+    }
+
+    Forcing::Forcing(const MassActionProcesses& processes)
+        : number_of_species_(processes.number_of_species)
+    {
+      for (std::size_t process = 0; process < processes.factors.size(); ++process)
+      {
+        for (const auto& factor : processes.factors[process])
+        {
+          if (factor.exponent == 1.0)
+          {
+            reactants_.push_back(factor.species);
+          }
+          else
+          {
+            fractional_species_.push_back(factor.species);
+            fractional_exponents_.push_back(factor.exponent);
+          }
+        }
+        for (const auto& term : processes.terms[process])
+        {
+          term_species_.push_back(term.species);
+          term_coefficients_.push_back(term.coefficient);
+        }
+        reactant_offsets_.push_back(reactants_.size());
+        fractional_offsets_.push_back(fractional_species_.size());
+        term_offsets_.push_back(term_species_.size());
+      }
+    }
+
+    void Forcing::Calculate(std::span<const double> k, std::span<const double> y, std::span<double> f, std::size_t number_of_cells) const
+    {
+      CheckCellArraySize(k, NumberOfProcesses(), number_of_cells, "k");
+      CheckCellArraySize(y, number_of_species_, number_of_cells, "y");
+      CheckCellArraySize(f, number_of_species_, number_of_cells, "f");
+      std::fill(f.begin(), f.end(), 0.0);
+
+      const std::size_t cells = number_of_cells;
+      double rate[block_size];
+      for (std::size_t block = 0; block < cells; block += block_size)
+      {
+        const std::size_t width = std::min(block_size, cells - block);
+        for (std::size_t process = 0; process < NumberOfProcesses(); ++process)
+        {
+          const double* k_row = k.data() + process * cells + block;
+          for (std::size_t c = 0; c < width; ++c)
+          {
+            rate[c] = k_row[c];
+          }
+          for (std::size_t r = reactant_offsets_[process]; r < reactant_offsets_[process + 1]; ++r)
+          {
+            const double* y_row = y.data() + reactants_[r] * cells + block;
+            for (std::size_t c = 0; c < width; ++c)
+            {
+              rate[c] *= y_row[c];
+            }
+          }
+          for (std::size_t r = fractional_offsets_[process]; r < fractional_offsets_[process + 1]; ++r)
+          {
+            const double* y_row = y.data() + fractional_species_[r] * cells + block;
+            const double exponent = fractional_exponents_[r];
+            for (std::size_t c = 0; c < width; ++c)
+            {
+              rate[c] *= std::pow(y_row[c], exponent);
+            }
+          }
+          for (std::size_t t = term_offsets_[process]; t < term_offsets_[process + 1]; ++t)
+          {
+            double* f_row = f.data() + term_species_[t] * cells + block;
+            const double coefficient = term_coefficients_[t];
+            for (std::size_t c = 0; c < width; ++c)
+            {
+              f_row[c] += coefficient * rate[c];
+            }
+          }
+        }
+      }
+    }
+
+    void ReferenceForcing(
+        const types::Mechanism& mechanism,
+        std::span<const double> k,
+        std::span<const double> y,
+        std::span<double> f,
+        std::size_t number_of_cells)
+    {
+      const auto layout = RateConstantLayout(mechanism);
+      const auto indices = IndexSpecies(mechanism);
+      CheckCellArraySize(k, layout.size(), number_of_cells, "k");
+      CheckCellArraySize(y, mechanism.species.size(), number_of_cells, "y");
+      CheckCellArraySize(f, mechanism.species.size(), number_of_cells, "f");
+      std::fill(f.begin(), f.end(), 0.0);
+
+      for (std::size_t cell = 0; cell < number_of_cells; ++cell)
+      {
+        auto at = [&](std::size_t row) { return row * number_of_cells + cell; };
+        for (std::size_t process = 0; process < layout.size(); ++process)
+        {
+          auto components = ComponentsOf(mechanism, layout[process]);
+          double rate = k[at(process)];
+          for (const auto& reactant : components.reactants)
+          {
+            rate *= std::pow(y[at(RequireSpecies(indices, reactant.species_name))], reactant.coefficient);
+          }
+          for (const auto& reactant : components.reactants)
+          {
+            f[at(RequireSpecies(indices, reactant.species_name))] -= reactant.coefficient * rate;
+          }
+          for (const auto& product : components.products)
+          {
+            f[at(RequireSpecies(indices, product.species_name))] += product.coefficient * rate;
+          }
+        }
+      }
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,193 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <yaml-cpp/yaml.h>
+
+#include <mechanism_configuration/v1/incremental_parser.hpp>
+#include <mechanism_configuration/v1/parser_types.hpp>
+#include <mechanism_configuration/v1/utils.hpp>
+#include <mechanism_configuration/v1/validation.hpp>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    namespace
+    {
+      template<typename T>
+      void Append(std::vector<T>& to, const std::vector<T>& from)
+      {
+        to.insert(to.end(), from.begin(), from.end());
+      }
+
+      // Scalars are prefixed with their length and collections with their size, so no two different nodes
+      // are written as the same text
+      void AppendCanonicalText(const YAML::Node& node, std::string& text)
+      {
+        switch (node.Type())
+        {
+          case YAML::NodeType::Scalar:
+            text += 's' + std::to_string(node.Scalar().size()) + ':';
+            text += node.Scalar();
+            break;
+          case YAML::NodeType::Sequence:
+            text += 'q' + std::to_string(node.size()) + ':';
+            for (const auto& element : node)
+            {
+              AppendCanonicalText(element, text);
+            }
+            break;
+          case YAML::NodeType::Map:
+            text += 'm' + std::to_string(node.size()) + ':';
+            for (const auto& element : node)
+            {
+              AppendCanonicalText(element.first, text);
+              AppendCanonicalText(element.second, text);
+            }
+            break;
+          case YAML::NodeType::Null: text += 'n'; break;
+          default: text += 'u'; break;
+        }
+      }
+    }  // namespace
+
+    std::string CanonicalText(const YAML::Node& node)
+    {
+      std::string text;
+      AppendCanonicalText(node, text);
+      return text;
+    }
+
+    void AppendReactions(types::Reactions& to, const types::Reactions& from)
+    {
+      Append(to.arrhenius, from.arrhenius);
+      Append(to.branched, from.branched);
+      Append(to.condensed_phase_arrhenius, from.condensed_phase_arrhenius);
+      Append(to.condensed_phase_photolysis, from.condensed_phase_photolysis);
+      Append(to.emission, from.emission);
+      Append(to.first_order_loss, from.first_order_loss);
+      Append(to.simpol_phase_transfer, from.simpol_phase_transfer);
+      Append(to.aqueous_equilibrium, from.aqueous_equilibrium);
+      Append(to.wet_deposition, from.wet_deposition);
+      Append(to.henrys_law, from.henrys_law);
+      Append(to.photolysis, from.photolysis);
+      Append(to.surface, from.surface);
+      Append(to.troe, from.troe);
+      Append(to.tunneling, from.tunneling);
+    }
+
+    void IncrementalParser::Reset()
+    {
+      has_sections_ = false;
+      species_text_.clear();
+      phases_text_.clear();
+      species_.clear();
+      phases_.clear();
+      index_ = PhaseIndex();
+      reaction_cache_.clear();
+      reused_reactions_ = 0;
+    }
+
+    ParserResult<types::Mechanism> IncrementalParser::Parse(const std::filesystem::path& config_path)
+    {
+      ParserResult<types::Mechanism> result;
+      if (!std::filesystem::exists(config_path) || !std::filesystem::is_regular_file(config_path))
+      {
+        result.errors.push_back({ ConfigParseStatus::FileNotFound, "missing or is a directory" });
+        SetErrorFile(result.errors, config_path);
+        return result;
+      }
+
+      result = Parse(YAML::LoadFile(config_path.string()));
+
+      SetErrorFile(result.errors, config_path);
+
+      return result;
+    }
+
+    ParserResult<types::Mechanism> IncrementalParser::Parse(const YAML::Node& object)
+    {
+      ParserResult<types::Mechanism> result;
+      std::unique_ptr<types::Mechanism> mechanism = std::make_unique<types::Mechanism>();
+      reused_reactions_ = 0;
+
+      auto header_errors = ParseMechanismHeader(object, *mechanism);
+      if (!header_errors.empty())
+      {
+        result.errors = std::move(header_errors);
+        return result;
+      }
+
+      std::string species_text = CanonicalText(object[validation::keys.species]);
+      std::string phases_text = CanonicalText(object[validation::keys.phases]);
+
+      if (!has_sections_ || species_text != species_text_ || phases_text != phases_text_)
+      {
+        Reset();
+
+        auto species_parsing = ParseSpecies(object[validation::keys.species]);
+        result.errors.insert(result.errors.end(), species_parsing.first.begin(), species_parsing.first.end());
+
+        auto phases_parsing = ParsePhases(object[validation::keys.phases], species_parsing.second);
+        result.errors.insert(result.errors.end(), phases_parsing.first.begin(), phases_parsing.first.end());
+
+        // sections with errors are parsed again next time so that their errors are reported again
+        if (result.errors.empty())
+        {
+          has_sections_ = true;
+          species_text_ = std::move(species_text);
+          phases_text_ = std::move(phases_text);
+        }
+        species_ = std::move(species_parsing.second);
+        phases_ = std::move(phases_parsing.second);
+        index_ = PhaseIndex(species_, phases_);
+      }
+
+      std::unordered_map<std::string, types::Reactions> reaction_cache;
+      ReactionMarks marks;
+      for (const auto& reaction : object[validation::keys.reactions])
+      {
+        std::string text = CanonicalText(reaction);
+        auto it = reaction_cache.find(text);
+        if (it == reaction_cache.end())
+        {
+          auto previous = reaction_cache_.find(text);
+          if (previous != reaction_cache_.end())
+          {
+            it = reaction_cache.emplace(std::move(text), std::move(previous->second)).first;
+            reaction_cache_.erase(previous);
+          }
+        }
+        if (it != reaction_cache.end())
+        {
+          AppendReactions(mechanism->reactions, it->second);
+          RecordReactionMarks(mechanism->reactions, reaction.Mark(), marks);
+          ++reused_reactions_;
+          continue;
+        }
+
+        types::Reactions parsed;
+        auto parse_errors = ParseReaction(reaction, index_, parsed);
+        AppendReactions(mechanism->reactions, parsed);
+        RecordReactionMarks(mechanism->reactions, reaction.Mark(), marks);
+        if (parse_errors.empty())
+        {
+          reaction_cache.emplace(std::move(text), std::move(parsed));
+        }
+        result.errors.insert(result.errors.end(), parse_errors.begin(), parse_errors.end());
+      }
+      reaction_cache_ = std::move(reaction_cache);
+
+      // duplicates are found across the whole list, so they are checked on every parse rather than cached
+      auto duplicate_errors = FindDuplicateReactionErrors(mechanism->reactions, marks);
+      result.errors.insert(result.errors.end(), duplicate_errors.begin(), duplicate_errors.end());
+
+      mechanism->species = species_;
+      mechanism->phases = phases_;
+
+      result.mechanism = std::move(mechanism);
+      return result;
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
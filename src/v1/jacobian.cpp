@@ -0,0 +1,141 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cmath>
+#include <mechanism_configuration/v1/jacobian.hpp>
+#include <set>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    Jacobian::Jacobian(const types::Mechanism& mechanism)
+        : Jacobian(MassActionProcesses(mechanism))
+    {
+    }
+
+    Jacobian::Jacobian(const MassActionProcesses& processes)
+    {
+      const auto& factors = processes.factors;
+      const auto& terms = processes.terms;
+
+      // The sparsity pattern: the diagonal, and (i, j) wherever a process changes i and has j as a reactant
+      std::vector<std::set<std::size_t>> rows(processes.number_of_species);
+      for (std::size_t i = 0; i < rows.size(); ++i)
+      {
+        rows[i].insert(i);
+      }
+      for (std::size_t p = 0; p < factors.size(); ++p)
+      {
+        for (const auto& factor : factors[p])
+        {
+          for (const auto& term : terms[p])
+          {
+            rows[term.species].insert(factor.species);
+          }
+        }
+      }
+      for (const auto& row : rows)
+      {
+        columns_.insert(columns_.end(), row.begin(), row.end());
+        row_offsets_.push_back(columns_.size());
+      }
+
+      for (std::size_t p = 0; p < factors.size(); ++p)
+      {
+        for (const auto& factor : factors[p])
+        {
+          factor_species_.push_back(factor.species);
+          factor_exponents_.push_back(factor.exponent);
+          for (const auto& term : terms[p])
+          {
+            scatter_elements_.push_back(*NonZeroIndex(term.species, factor.species));
+            scatter_coefficients_.push_back(term.coefficient);
+          }
+          scatter_offsets_.push_back(scatter_elements_.size());
+        }
+        factor_offsets_.push_back(factor_species_.size());
+      }
+    }
+
+    std::optional<std::size_t> Jacobian::NonZeroIndex(std::size_t row, std::size_t column) const
+    {
+      if (row >= NumberOfSpecies())
+      {
+        return std::nullopt;
+      }
+      auto begin = columns_.begin() + static_cast<std::ptrdiff_t>(row_offsets_[row]);
+      auto end = columns_.begin() + static_cast<std::ptrdiff_t>(row_offsets_[row + 1]);
+      auto it = std::lower_bound(begin, end, column);
+      if (it == end || *it != column)
+      {
+        return std::nullopt;
+      }
+      return static_cast<std::size_t>(it - columns_.begin());
+    }
+
+    void Jacobian::Calculate(std::span<const double> k, std::span<const double> y, std::span<double> values, std::size_t number_of_cells) const
+    {
+      CheckCellArraySize(k, NumberOfProcesses(), number_of_cells, "k");
+      CheckCellArraySize(y, NumberOfSpecies(), number_of_cells, "y");
+      CheckCellArraySize(values, NumberOfNonZeros(), number_of_cells, "values");
+      std::fill(values.begin(), values.end(), 0.0);
+
+      const std::size_t cells = number_of_cells;
+      double derivative[block_size];
+      for (std::size_t block = 0; block < cells; block += block_size)
+      {
+        const std::size_t width = std::min(block_size, cells - block);
+        for (std::size_t process = 0; process < NumberOfProcesses(); ++process)
+        {
+          const double* k_row = k.data() + process * cells + block;
+          const std::size_t first = factor_offsets_[process];
+          const std::size_t last = factor_offsets_[process + 1];
+          for (std::size_t m = first; m < last; ++m)
+          {
+            // d rate / d y_m = k * (product of the other factors) * e_m y_m^(e_m - 1)
+            for (std::size_t c = 0; c < width; ++c)
+            {
+              derivative[c] = k_row[c];
+            }
+            for (std::size_t l = first; l < last; ++l)
+            {
+              if (l == m)
+                continue;
+              const double* y_row = y.data() + factor_species_[l] * cells + block;
+              const double exponent = factor_exponents_[l];
+              if (exponent == 1.0)
+              {
+                for (std::size_t c = 0; c < width; ++c)
+                  derivative[c] *= y_row[c];
+              }
+              else
+              {
+                for (std::size_t c = 0; c < width; ++c)
+                  derivative[c] *= std::pow(y_row[c], exponent);
+              }
+            }
+            if (factor_exponents_[m] != 1.0)
+            {
+              const double* y_row = y.data() + factor_species_[m] * cells + block;
+              const double exponent = factor_exponents_[m];
+              for (std::size_t c = 0; c < width; ++c)
+                derivative[c] *= exponent * std::pow(y_row[c], exponent - 1.0);
+            }
+            for (std::size_t s = scatter_offsets_[m]; s < scatter_offsets_[m + 1]; ++s)
+            {
+              double* value_row = values.data() + scatter_elements_[s] * cells + block;
+              const double coefficient = scatter_coefficients_[s];
+              for (std::size_t c = 0; c < width; ++c)
+              {
+                value_row[c] += coefficient * derivative[c];
+              }
+            }
+          }
+        }
+      }
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
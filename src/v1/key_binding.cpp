@@ -0,0 +1,90 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/v1/key_binding.hpp>
+#include <mechanism_configuration/v1/utils.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    KeyTable::KeyTable(const std::vector<std::string>& required_keys, const std::vector<std::string>& optional_keys)
+        : keys_(required_keys),
+          required_(required_keys.size())
+    {
+      std::sort(keys_.begin(), keys_.end());
+      keys_.insert(keys_.end(), optional_keys.begin(), optional_keys.end());
+      slots_.reserve(keys_.size());
+      for (std::size_t slot = 0; slot < keys_.size(); ++slot)
+      {
+        slots_.emplace(keys_[slot], slot);
+      }
+    }
+
+    std::size_t KeyTable::Slot(const std::string& key) const
+    {
+      auto it = slots_.find(key);
+      if (it == slots_.end())
+      {
+        throw std::logic_error("Key '" + key + "' is not part of the key table");
+      }
+      return it->second;
+    }
+
+    BoundObject::BoundObject(const YAML::Node& object, const KeyTable& table)
+        : table_(table),
+          values_(table.size()),
+          present_(table.size(), false)
+    {
+      if (!object || object.IsNull())
+      {
+        errors_.push_back({ ConfigParseStatus::RequiredKeyNotFound, object.Mark(), "", "Object is null" });
+        return;
+      }
+
+      const std::string comment_start = "__";
+      std::vector<std::pair<std::string, YAML::Mark>> invalid_keys;
+
+      for (const auto& entry : object)
+      {
+        const std::string& key = entry.first.Scalar();
+        auto it = table.slots_.find(key);
+        if (it != table.slots_.end())
+        {
+          if (!present_[it->second])
+          {
+            values_[it->second] = entry.second;
+            present_[it->second] = true;
+          }
+          continue;
+        }
+        if (key.compare(0, comment_start.size(), comment_start) == 0)
+        {
+          comments_[key] = CommentText(entry.second);
+        }
+        else if (key.find(comment_start) == std::string::npos)
+        {
+          invalid_keys.emplace_back(key, entry.second.Mark());
+        }
+      }
+
+      for (std::size_t slot = 0; slot < table.required_; ++slot)
+      {
+        if (!present_[slot])
+        {
+          errors_.push_back({ ConfigParseStatus::RequiredKeyNotFound, object.Mark(), table.keys_[slot] });
+        }
+      }
+
+      std::stable_sort(invalid_keys.begin(), invalid_keys.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+      for (const auto& [key, mark] : invalid_keys)
+      {
+        errors_.push_back({ ConfigParseStatus::InvalidKey, mark, key });
+      }
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,102 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cmath>
+#include <mechanism_configuration/v1/mass_action.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    ProcessComponents ComponentsOf(const types::Mechanism& mechanism, const RateConstantSlot& slot)
+    {
+      ProcessComponents components;
+      types::ForEachReactionList(
+          mechanism.reactions,
+          [&](types::ReactionType type, const auto& list)
+          {
+            if (type != slot.reaction.type)
+            {
+              return;
+            }
+            const auto& reaction = list[slot.reaction.index];
+            if constexpr (requires { reaction.reactants; })
+              components.reactants = reaction.reactants;
+            if constexpr (requires { reaction.products; })
+              components.products = reaction.products;
+            if constexpr (requires { reaction.nitrate_products; })
+              components.products = slot.channel == RateChannel::Alkoxy ? reaction.alkoxy_products : reaction.nitrate_products;
+          });
+      return components;
+    }
+
+    MassActionProcesses::MassActionProcesses(const types::Mechanism& mechanism)
+        : number_of_species(mechanism.species.size())
+    {
+      const auto indices = IndexSpecies(mechanism);
+      for (const auto& slot : RateConstantLayout(mechanism))
+      {
+        auto components = ComponentsOf(mechanism, slot);
+        auto& process_factors = factors.emplace_back();
+        auto& process_terms = terms.emplace_back();
+        auto add_term = [&process_terms](std::size_t species, double coefficient)
+        {
+          auto it = std::find_if(process_terms.begin(), process_terms.end(), [species](const Term& t) { return t.species == species; });
+          if (it == process_terms.end())
+            process_terms.push_back({ species, coefficient });
+          else
+            it->coefficient += coefficient;
+        };
+        for (const auto& reactant : components.reactants)
+        {
+          const std::size_t species = RequireSpecies(indices, reactant.species_name);
+          const double whole = std::floor(reactant.coefficient);
+          if (whole == reactant.coefficient && whole >= 0.0)
+            process_factors.insert(process_factors.end(), static_cast<std::size_t>(whole), Factor{ species, 1.0 });
+          else
+            process_factors.push_back({ species, reactant.coefficient });
+          add_term(species, -reactant.coefficient);
+        }
+        for (const auto& product : components.products)
+        {
+          add_term(RequireSpecies(indices, product.species_name), product.coefficient);
+        }
+        std::erase_if(process_terms, [](const Term& t) { return t.coefficient == 0.0; });
+      }
+    }
+
+    SpeciesIndices IndexSpecies(const types::Mechanism& mechanism)
+    {
+      SpeciesIndices indices;
+      for (std::size_t i = 0; i < mechanism.species.size(); ++i)
+      {
+        indices.emplace(mechanism.species[i].name, i);
+      }
+      return indices;
+    }
+
+    std::size_t RequireSpecies(const SpeciesIndices& indices, const std::string& name)
+    {
+      auto it = indices.find(name);
+      if (it == indices.end())
+      {
+        throw std::invalid_argument("Unknown species '" + name + "'");
+      }
+      return it->second;
+    }
+
+    void CheckCellArraySize(std::span<const double> array, std::size_t rows, std::size_t number_of_cells, const char* name)
+    {
+      if (array.size() != rows * number_of_cells)
+      {
+        throw std::invalid_argument(
+            std::string("Expected ") + name + " to hold " + std::to_string(rows) + " rows of " + std::to_string(number_of_cells) +
+            " cells, got " + std::to_string(array.size()) + " values");
+      }
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
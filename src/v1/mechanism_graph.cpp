@@ -0,0 +1,444 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <limits>
+#include <mechanism_configuration/v1/mechanism_graph.hpp>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    namespace
+    {
+      /// @brief Whether reactions of a type can run in both directions, converting their products back into
+      ///        their reactants
+      bool IsReversibleType(types::ReactionType type)
+      {
+        return type == types::ReactionType::SimpolPhaseTransfer || type == types::ReactionType::AqueousEquilibrium ||
+               type == types::ReactionType::HenrysLaw;
+      }
+    }  // namespace
+
+    MechanismGraph::MechanismGraph(const types::Mechanism& mechanism)
+    {
+      species_names_.reserve(mechanism.species.size());
+      for (const auto& species : mechanism.species)
+      {
+        species_indices_.emplace(species.name, species_names_.size());
+        species_names_.push_back(species.name);
+      }
+
+      reaction_channels_.push_back(0);
+      // wet deposition removes whole aerosol phases and has no individual reactants, so it adds an empty channel
+      types::ForEachReactionList(
+          mechanism.reactions,
+          [this](types::ReactionType type, const auto& list)
+          {
+            for (std::size_t i = 0; i < list.size(); ++i)
+            {
+              std::vector<std::string> reactants, products;
+              types::ForEachComponent(
+                  list[i],
+                  [&](types::ComponentRole role, const std::string& name, double)
+                  {
+                    if (types::IsReactant(role))
+                      reactants.push_back(name);
+                    else if (types::IsProduct(role))
+                      products.push_back(name);
+                  });
+              AddReaction(type, i, reactants, products, IsReversibleType(type));
+            }
+          });
+
+      BuildSpeciesAdjacency();
+    }
+
+    void MechanismGraph::AddReaction(
+        types::ReactionType type,
+        std::size_t index,
+        const std::vector<std::string>& reactants,
+        const std::vector<std::string>& products,
+        bool reversible)
+    {
+      auto to_indices = [this](const std::vector<std::string>& names)
+      {
+        std::vector<std::size_t> indices;
+        indices.reserve(names.size());
+        for (const auto& name : names)
+        {
+          auto it = species_indices_.find(name);
+          if (it != species_indices_.end())
+          {
+            indices.push_back(it->second);
+          }
+        }
+        // a species listed twice, or with a coefficient, is still a single node
+        std::sort(indices.begin(), indices.end());
+        indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+        return indices;
+      };
+
+      auto add_channel = [this](std::size_t reaction, const std::vector<std::size_t>& inputs, const std::vector<std::size_t>& outputs)
+      {
+        Channel channel;
+        channel.reaction = reaction;
+        channel.inputs_begin = channel_species_.size();
+        channel_species_.insert(channel_species_.end(), inputs.begin(), inputs.end());
+        channel.inputs_end = channel.outputs_begin = channel_species_.size();
+        channel_species_.insert(channel_species_.end(), outputs.begin(), outputs.end());
+        channel.outputs_end = channel_species_.size();
+        channels_.push_back(channel);
+      };
+
+      std::size_t reaction = reactions_.size();
+      reactions_.push_back({ type, index });
+      auto inputs = to_indices(reactants);
+      auto outputs = to_indices(products);
+      add_channel(reaction, inputs, outputs);
+      if (reversible)
+      {
+        add_channel(reaction, outputs, inputs);
+      }
+      reaction_channels_.push_back(channels_.size());
+    }
+
+    void MechanismGraph::BuildSpeciesAdjacency()
+    {
+      consumer_offsets_.assign(species_names_.size() + 1, 0);
+      for (const auto& channel : channels_)
+      {
+        for (std::size_t i = channel.inputs_begin; i < channel.inputs_end; ++i)
+        {
+          ++consumer_offsets_[channel_species_[i] + 1];
+        }
+      }
+      for (std::size_t s = 0; s < species_names_.size(); ++s)
+      {
+        consumer_offsets_[s + 1] += consumer_offsets_[s];
+      }
+      consumers_.resize(consumer_offsets_.back());
+      std::vector<std::size_t> next(consumer_offsets_.begin(), consumer_offsets_.end() - 1);
+      for (std::size_t c = 0; c < channels_.size(); ++c)
+      {
+        const auto& channel = channels_[c];
+        for (std::size_t i = channel.inputs_begin; i < channel.inputs_end; ++i)
+        {
+          consumers_[next[channel_species_[i]]++] = c;
+        }
+      }
+    }
+
+    std::optional<std::size_t> MechanismGraph::SpeciesIndex(const std::string& name) const
+    {
+      auto it = species_indices_.find(name);
+      if (it == species_indices_.end())
+      {
+        return std::nullopt;
+      }
+      return it->second;
+    }
+
+    std::span<const std::size_t> MechanismGraph::Reactants(std::size_t reaction) const
+    {
+      const auto& channel = channels_[reaction_channels_[reaction]];
+      return { channel_species_.data() + channel.inputs_begin, channel.inputs_end - channel.inputs_begin };
+    }
+
+    std::span<const std::size_t> MechanismGraph::Products(std::size_t reaction) const
+    {
+      const auto& channel = channels_[reaction_channels_[reaction]];
+      return { channel_species_.data() + channel.outputs_begin, channel.outputs_end - channel.outputs_begin };
+    }
+
+    bool MechanismGraph::IsReversible(std::size_t reaction) const
+    {
+      return reaction_channels_[reaction + 1] - reaction_channels_[reaction] > 1;
+    }
+
+    Reachability MechanismGraph::Reachable(std::span<const std::size_t> initial_species) const
+    {
+      Reachability result;
+      result.species.assign(species_names_.size(), false);
+      result.reactions.assign(reactions_.size(), false);
+
+      std::vector<std::size_t> remaining(channels_.size());
+      std::vector<std::size_t> queue;
+      queue.reserve(species_names_.size());
+
+      auto add_species = [&](std::size_t species)
+      {
+        if (!result.species[species])
+        {
+          result.species[species] = true;
+          queue.push_back(species);
+        }
+      };
+      auto fire = [&](std::size_t c)
+      {
+        const auto& channel = channels_[c];
+        result.reactions[channel.reaction] = true;
+        for (std::size_t i = channel.outputs_begin; i < channel.outputs_end; ++i)
+        {
+          add_species(channel_species_[i]);
+        }
+      };
+
+      for (std::size_t species : initial_species)
+      {
+        add_species(species);
+      }
+      for (std::size_t c = 0; c < channels_.size(); ++c)
+      {
+        remaining[c] = channels_[c].inputs_end - channels_[c].inputs_begin;
+        if (remaining[c] == 0)
+        {
+          fire(c);
+        }
+      }
+
+      for (std::size_t head = 0; head < queue.size(); ++head)
+      {
+        std::size_t species = queue[head];
+        for (std::size_t i = consumer_offsets_[species]; i < consumer_offsets_[species + 1]; ++i)
+        {
+          std::size_t c = consumers_[i];
+          if (--remaining[c] == 0)
+          {
+            fire(c);
+          }
+        }
+      }
+
+      return result;
+    }
+
+    Reachability MechanismGraph::Reachable(const std::vector<std::string>& initial_species) const
+    {
+      std::vector<std::size_t> indices;
+      indices.reserve(initial_species.size());
+      for (const auto& name : initial_species)
+      {
+        if (auto index = SpeciesIndex(name))
+        {
+          indices.push_back(*index);
+        }
+      }
+      return Reachable(std::span<const std::size_t>(indices));
+    }
+
+    std::vector<std::size_t> MechanismGraph::DeadSpecies(const std::vector<std::string>& initial_species) const
+    {
+      auto reachable = Reachable(initial_species);
+      std::vector<std::size_t> dead;
+      for (std::size_t s = 0; s < reachable.species.size(); ++s)
+      {
+        if (!reachable.species[s])
+        {
+          dead.push_back(s);
+        }
+      }
+      return dead;
+    }
+
+    std::vector<std::size_t> MechanismGraph::DeadReactions(const std::vector<std::string>& initial_species) const
+    {
+      auto reachable = Reachable(initial_species);
+      std::vector<std::size_t> dead;
+      for (std::size_t r = 0; r < reachable.reactions.size(); ++r)
+      {
+        if (!reachable.reactions[r])
+        {
+          dead.push_back(r);
+        }
+      }
+      return dead;
+    }
+
+    std::vector<StronglyConnectedComponent> MechanismGraph::Cycles() const
+    {
+      // Iterative Tarjan over species nodes [0, S) and channel nodes [S, S + C)
+      constexpr std::size_t unvisited = std::numeric_limits<std::size_t>::max();
+      const std::size_t n_species = species_names_.size();
+      const std::size_t n_nodes = n_species + channels_.size();
+
+      auto edges_begin = [&](std::size_t node)
+      { return node < n_species ? consumer_offsets_[node] : channels_[node - n_species].outputs_begin; };
+      auto edges_end = [&](std::size_t node)
+      { return node < n_species ? consumer_offsets_[node + 1] : channels_[node - n_species].outputs_end; };
+      auto edge_target = [&](std::size_t node, std::size_t edge)
+      { return node < n_species ? consumers_[edge] + n_species : channel_species_[edge]; };
+
+      std::vector<std::size_t> index(n_nodes, unvisited);
+      std::vector<std::size_t> low_link(n_nodes, 0);
+      std::vector<bool> on_stack(n_nodes, false);
+      std::vector<std::size_t> stack;
+      std::vector<std::pair<std::size_t, std::size_t>> call_stack;
+      std::vector<StronglyConnectedComponent> cycles;
+      std::vector<std::size_t> in_degree(n_nodes, not_in_component);
+      std::size_t next_index = 0;
+
+      for (std::size_t root = 0; root < n_nodes; ++root)
+      {
+        if (index[root] != unvisited)
+        {
+          continue;
+        }
+        call_stack.push_back({ root, edges_begin(root) });
+        index[root] = low_link[root] = next_index++;
+        stack.push_back(root);
+        on_stack[root] = true;
+
+        while (!call_stack.empty())
+        {
+          auto& [node, edge] = call_stack.back();
+          if (edge < edges_end(node))
+          {
+            std::size_t target = edge_target(node, edge++);
+            if (index[target] == unvisited)
+            {
+              index[target] = low_link[target] = next_index++;
+              stack.push_back(target);
+              on_stack[target] = true;
+              call_stack.push_back({ target, edges_begin(target) });
+            }
+            else if (on_stack[target])
+            {
+              low_link[node] = std::min(low_link[node], index[target]);
+            }
+            continue;
+          }
+
+          std::size_t finished = node;
+          call_stack.pop_back();
+          if (!call_stack.empty())
+          {
+            std::size_t parent = call_stack.back().first;
+            low_link[parent] = std::min(low_link[parent], low_link[finished]);
+          }
+          if (low_link[finished] != index[finished])
+          {
+            continue;
+          }
+
+          StronglyConnectedComponent component;
+          std::vector<std::size_t> component_channels;
+          std::size_t member;
+          do
+          {
+            member = stack.back();
+            stack.pop_back();
+            on_stack[member] = false;
+            if (member < n_species)
+            {
+              component.species.push_back(member);
+            }
+            else
+            {
+              component_channels.push_back(member - n_species);
+              component.reactions.push_back(channels_[member - n_species].reaction);
+            }
+          } while (member != finished);
+
+          std::sort(component.species.begin(), component.species.end());
+          std::sort(component.reactions.begin(), component.reactions.end());
+          component.reactions.erase(std::unique(component.reactions.begin(), component.reactions.end()), component.reactions.end());
+
+          if (HasForwardCycle(component.species, component_channels, in_degree))
+          {
+            cycles.push_back(std::move(component));
+          }
+        }
+      }
+
+      return cycles;
+    }
+
+    bool MechanismGraph::HasForwardCycle(
+        const std::vector<std::size_t>& species,
+        const std::vector<std::size_t>& channels,
+        std::vector<std::size_t>& in_degree) const
+    {
+      // Kahn's algorithm over the species and forward channels of the component: the forward subgraph has a
+      // cycle if and only if some of its nodes are never freed of incoming edges
+      const std::size_t n_species = species_names_.size();
+      auto is_forward = [this](std::size_t c) { return reaction_channels_[channels_[c].reaction] == c; };
+      auto in_component = [&](std::size_t node) { return in_degree[node] != not_in_component; };
+
+      for (std::size_t s : species)
+        in_degree[s] = 0;
+      std::size_t n_nodes = species.size();
+      for (std::size_t c : channels)
+      {
+        if (is_forward(c))
+        {
+          in_degree[n_species + c] = 0;
+          ++n_nodes;
+        }
+      }
+      for (std::size_t c : channels)
+      {
+        if (!is_forward(c))
+          continue;
+        const auto& channel = channels_[c];
+        for (std::size_t i = channel.inputs_begin; i < channel.inputs_end; ++i)
+        {
+          if (in_component(channel_species_[i]))
+            ++in_degree[n_species + c];
+        }
+        for (std::size_t i = channel.outputs_begin; i < channel.outputs_end; ++i)
+        {
+          if (in_component(channel_species_[i]))
+            ++in_degree[channel_species_[i]];
+        }
+      }
+
+      std::vector<std::size_t> queue;
+      queue.reserve(n_nodes);
+      for (std::size_t s : species)
+      {
+        if (in_degree[s] == 0)
+          queue.push_back(s);
+      }
+      for (std::size_t c : channels)
+      {
+        if (is_forward(c) && in_degree[n_species + c] == 0)
+          queue.push_back(n_species + c);
+      }
+      auto release = [&](std::size_t node)
+      {
+        if (--in_degree[node] == 0)
+          queue.push_back(node);
+      };
+      for (std::size_t head = 0; head < queue.size(); ++head)
+      {
+        const std::size_t node = queue[head];
+        if (node < n_species)
+        {
+          for (std::size_t i = consumer_offsets_[node]; i < consumer_offsets_[node + 1]; ++i)
+          {
+            if (is_forward(consumers_[i]) && in_component(n_species + consumers_[i]))
+              release(n_species + consumers_[i]);
+          }
+        }
+        else
+        {
+          const auto& channel = channels_[node - n_species];
+          for (std::size_t i = channel.outputs_begin; i < channel.outputs_end; ++i)
+          {
+            if (in_component(channel_species_[i]))
+              release(channel_species_[i]);
+          }
+        }
+      }
+      const bool has_cycle = queue.size() < n_nodes;
+
+      for (std::size_t s : species)
+        in_degree[s] = not_in_component;
+      for (std::size_t c : channels)
+        in_degree[n_species + c] = not_in_component;
+      return has_cycle;
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -19,38 +19,20 @@ namespace mechanism_configuration
       ParserResult<types::Mechanism> result;
       if (!std::filesystem::exists(config_path) || !std::filesystem::is_regular_file(config_path))
       {
-        result.errors.push_back({ ConfigParseStatus::FileNotFound, "File not found or is a directory" });
+        result.errors.push_back({ ConfigParseStatus::FileNotFound, "missing or is a directory" });
+        SetErrorFile(result.errors, config_path);
         return result;
       }
       YAML::Node object = YAML::LoadFile(config_path.string());
       std::unique_ptr<types::Mechanism> mechanism = std::make_unique<types::Mechanism>();
 
-      const auto mechanism_required_keys = {
-        validation::keys.version, validation::keys.species, validation::keys.phases, validation::keys.reactions
-      };
-      const auto mechanism_optional_keys = { validation::keys.name };
-
-      auto validate = ValidateSchema(object, mechanism_required_keys, mechanism_optional_keys);
-
-      if (!validate.empty())
+      auto header_errors = ParseMechanismHeader(object, *mechanism);
+      if (!header_errors.empty())
       {
-        result.errors = validate;
+        result.errors = std::move(header_errors);
         return result;
       }
 
-      Version version = Version(object[validation::keys.version].as<std::string>());
-
-      if (version.major != 1)
-      {
-        result.errors.push_back({ ConfigParseStatus::InvalidVersion, "Invalid version." });
-        return result;
-      }
-
-      mechanism->version = version;
-
-      std::string name = object[validation::keys.name].as<std::string>();
-      mechanism->name = name;
-
       auto species_parsing = ParseSpecies(object[validation::keys.species]);
       result.errors.insert(result.errors.end(), species_parsing.first.begin(), species_parsing.first.end());
 
@@ -60,15 +42,11 @@ namespace mechanism_configuration
       auto reactions_parsing = ParseReactions(object[validation::keys.reactions], species_parsing.second, phases_parsing.second);
       result.errors.insert(result.errors.end(), reactions_parsing.first.begin(), reactions_parsing.first.end());
 
-      mechanism->species = species_parsing.second;
-      mechanism->phases = phases_parsing.second;
-      mechanism->reactions = reactions_parsing.second;
+      mechanism->species = std::move(species_parsing.second);
+      mechanism->phases = std::move(phases_parsing.second);
+      mechanism->reactions = std::move(reactions_parsing.second);
 
-      // prepend the file name to the error messages
-      for (auto& error : result.errors)
-      {
-        error.second = config_path.string() + ":" + error.second;
-      }
+      SetErrorFile(result.errors, config_path);
 
       result.mechanism = std::move(mechanism);
       return result;
@@ -0,0 +1,102 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/v1/phase_index.hpp>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    PhaseIndex::PhaseIndex(const std::vector<types::Species>& species, const std::vector<types::Phase>& phases)
+    {
+      species_.reserve(species.size());
+      for (const auto& spec : species)
+      {
+        species_.emplace(spec.name, species_.size());
+      }
+
+      phases_.reserve(phases.size());
+      members_.assign(phases.size() * species_.size(), false);
+      for (const auto& phase : phases)
+      {
+        // the first phase with a given name wins, matching a linear search over the phase list
+        auto inserted = phases_.emplace(phase.name, phases_.size());
+        if (!inserted.second)
+        {
+          continue;
+        }
+        std::size_t row = inserted.first->second * species_.size();
+        for (const auto& name : phase.species)
+        {
+          auto it = species_.find(name);
+          if (it != species_.end())
+          {
+            members_[row + it->second] = true;
+          }
+        }
+      }
+    }
+
+    std::optional<std::size_t> PhaseIndex::SpeciesOrdinal(std::string_view name) const
+    {
+      auto it = species_.find(name);
+      if (it == species_.end())
+      {
+        return std::nullopt;
+      }
+      return it->second;
+    }
+
+    std::optional<std::size_t> PhaseIndex::PhaseOrdinal(std::string_view name) const
+    {
+      auto it = phases_.find(name);
+      if (it == phases_.end())
+      {
+        return std::nullopt;
+      }
+      return it->second;
+    }
+
+    bool PhaseIndex::PhaseHasSpecies(std::string_view phase, std::string_view species) const
+    {
+      auto it = phases_.find(phase);
+      return it != phases_.end() && Contains(it->second, species);
+    }
+
+    bool PhaseIndex::RequiresUnknownSpecies(const std::vector<std::string_view>& requested_species) const
+    {
+      for (const auto& spec : requested_species)
+      {
+        if (!HasSpecies(spec))
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    bool PhaseIndex::PhaseRequiresUnknownSpecies(std::string_view phase, const std::vector<std::string_view>& requested_species) const
+    {
+      auto it = phases_.find(phase);
+      if (it == phases_.end())
+      {
+        return true;
+      }
+      for (const auto& spec : requested_species)
+      {
+        if (!Contains(it->second, spec))
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    bool PhaseIndex::Contains(std::size_t phase, std::string_view species) const
+    {
+      auto it = species_.find(species);
+      return it != species_.end() && members_[phase * species_.size() + it->second];
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -0,0 +1,248 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cmath>
+#include <mechanism_configuration/constants.hpp>
+#include <mechanism_configuration/v1/rate_constants.hpp>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    namespace
+    {
+      template<typename T>
+      constexpr bool is_external_rate = std::is_same_v<T, types::Photolysis> || std::is_same_v<T, types::CondensedPhasePhotolysis> ||
+                                        std::is_same_v<T, types::Emission> || std::is_same_v<T, types::FirstOrderLoss> ||
+                                        std::is_same_v<T, types::WetDeposition>;
+
+      template<typename T>
+      double ScalingFactor(const T& reaction)
+      {
+        if constexpr (std::is_same_v<T, types::CondensedPhasePhotolysis>)
+          return reaction.scaling_factor_;
+        else
+          return reaction.scaling_factor;
+      }
+
+      /// @brief Calls f(slot, reaction) for every rate constant of a mechanism, in layout order
+      template<typename Func>
+      void ForEachRateConstant(const types::Mechanism& mechanism, Func&& f)
+      {
+        std::size_t external = 0;
+        types::ForEachReactionList(
+            mechanism.reactions,
+            [&](types::ReactionType type, const auto& list)
+            {
+              using T = typename std::decay_t<decltype(list)>::value_type;
+              for (std::size_t i = 0; i < list.size(); ++i)
+              {
+                ReactionIndex reaction{ type, i };
+                if constexpr (std::is_same_v<T, types::Branched>)
+                {
+                  f(RateConstantSlot{ reaction, RateChannel::Nitrate, std::nullopt }, list[i]);
+                  f(RateConstantSlot{ reaction, RateChannel::Alkoxy, std::nullopt }, list[i]);
+                }
+                else if constexpr (is_external_rate<T>)
+                {
+                  f(RateConstantSlot{ reaction, RateChannel::Forward, external++ }, list[i]);
+                }
+                else if constexpr (
+                    std::is_same_v<T, types::Arrhenius> || std::is_same_v<T, types::CondensedPhaseArrhenius> ||
+                    std::is_same_v<T, types::Troe> || std::is_same_v<T, types::Tunneling>)
+                {
+                  f(RateConstantSlot{ reaction, RateChannel::Forward, std::nullopt }, list[i]);
+                }
+              }
+            });
+      }
+    }  // namespace
+
+    std::vector<RateConstantSlot> RateConstantLayout(const types::Mechanism& mechanism)
+    {
+      std::vector<RateConstantSlot> layout;
+      ForEachRateConstant(mechanism, [&layout](const RateConstantSlot& slot, const auto&) { layout.push_back(slot); });
+      return layout;
+    }
+
+    RateConstants::RateConstants(const types::Mechanism& mechanism)
+    {
+      ForEachRateConstant(
+          mechanism,
+          [this](const RateConstantSlot& slot, const auto& r)
+          {
+            using T = std::decay_t<decltype(r)>;
+            const std::size_t index = layout_.size();
+            layout_.push_back(slot);
+            if constexpr (std::is_same_v<T, types::Arrhenius> || std::is_same_v<T, types::CondensedPhaseArrhenius>)
+              arrhenius_.push_back({ index, r.A, r.B, r.C, r.D, r.E });
+            else if constexpr (std::is_same_v<T, types::Troe>)
+              troe_.push_back({ index, r.k0_A, r.k0_B, r.k0_C, r.kinf_A, r.kinf_B, r.kinf_C, r.Fc, r.N });
+            else if constexpr (std::is_same_v<T, types::Tunneling>)
+              tunneling_.push_back({ index, r.A, r.B, r.C });
+            else if constexpr (std::is_same_v<T, types::Branched>)
+            {
+              // Both branches share one term; the nitrate slot comes first
+              if (slot.channel == RateChannel::Nitrate)
+                branched_.push_back({ index, r.X, r.Y, r.a0, r.n });
+            }
+            else if constexpr (is_external_rate<T>)
+              external_.push_back({ index, *slot.external, ScalingFactor(r) });
+          });
+    }
+
+    void RateConstants::Calculate(const Conditions& conditions, std::span<const double> external, std::span<double> k) const
+    {
+      if (external.size() != external_.size())
+      {
+        throw std::invalid_argument(
+            "Expected " + std::to_string(external_.size()) + " external rates, got " + std::to_string(external.size()));
+      }
+      if (k.size() != layout_.size())
+      {
+        throw std::invalid_argument("Expected space for " + std::to_string(layout_.size()) + " rate constants, got " + std::to_string(k.size()));
+      }
+      for (const auto& term : arrhenius_)
+      {
+        k[term.slot] = rates::Arrhenius(term.A, term.B, term.C, term.D, term.E, conditions);
+      }
+      for (const auto& term : troe_)
+      {
+        k[term.slot] = rates::Troe(term.k0_A, term.k0_B, term.k0_C, term.kinf_A, term.kinf_B, term.kinf_C, term.Fc, term.N, conditions);
+      }
+      for (const auto& term : tunneling_)
+      {
+        k[term.slot] = rates::Tunneling(term.A, term.B, term.C, conditions);
+      }
+      for (const auto& term : branched_)
+      {
+        k[term.slot] = rates::Branched(term.X, term.Y, term.a0, term.n, RateChannel::Nitrate, conditions);
+        k[term.slot + 1] = rates::Branched(term.X, term.Y, term.a0, term.n, RateChannel::Alkoxy, conditions);
+      }
+      for (const auto& term : external_)
+      {
+        k[term.slot] = term.scaling_factor * external[term.external];
+      }
+    }
+
+    void RateConstants::Calculate(
+        std::span<const Conditions> conditions,
+        std::span<const double> external,
+        std::span<double> k,
+        std::size_t number_of_cells) const
+    {
+      const std::size_t cells = number_of_cells;
+      if (conditions.size() != cells)
+      {
+        throw std::invalid_argument("Expected conditions for " + std::to_string(cells) + " cells, got " + std::to_string(conditions.size()));
+      }
+      if (external.size() != external_.size() * cells)
+      {
+        throw std::invalid_argument(
+            "Expected " + std::to_string(external_.size()) + " rows of " + std::to_string(cells) + " external rates, got " +
+            std::to_string(external.size()) + " values");
+      }
+      if (k.size() != layout_.size() * cells)
+      {
+        throw std::invalid_argument(
+            "Expected space for " + std::to_string(layout_.size()) + " rows of " + std::to_string(cells) + " rate constants, got " +
+            std::to_string(k.size()));
+      }
+      for (const auto& term : arrhenius_)
+      {
+        double* k_row = k.data() + term.slot * cells;
+        for (std::size_t c = 0; c < cells; ++c)
+          k_row[c] = rates::Arrhenius(term.A, term.B, term.C, term.D, term.E, conditions[c]);
+      }
+      for (const auto& term : troe_)
+      {
+        double* k_row = k.data() + term.slot * cells;
+        for (std::size_t c = 0; c < cells; ++c)
+          k_row[c] = rates::Troe(term.k0_A, term.k0_B, term.k0_C, term.kinf_A, term.kinf_B, term.kinf_C, term.Fc, term.N, conditions[c]);
+      }
+      for (const auto& term : tunneling_)
+      {
+        double* k_row = k.data() + term.slot * cells;
+        for (std::size_t c = 0; c < cells; ++c)
+          k_row[c] = rates::Tunneling(term.A, term.B, term.C, conditions[c]);
+      }
+      for (const auto& term : branched_)
+      {
+        double* nitrate_row = k.data() + term.slot * cells;
+        double* alkoxy_row = nitrate_row + cells;
+        for (std::size_t c = 0; c < cells; ++c)
+        {
+          nitrate_row[c] = rates::Branched(term.X, term.Y, term.a0, term.n, RateChannel::Nitrate, conditions[c]);
+          alkoxy_row[c] = rates::Branched(term.X, term.Y, term.a0, term.n, RateChannel::Alkoxy, conditions[c]);
+        }
+      }
+      for (const auto& term : external_)
+      {
+        double* k_row = k.data() + term.slot * cells;
+        const double* external_row = external.data() + term.external * cells;
+        for (std::size_t c = 0; c < cells; ++c)
+          k_row[c] = term.scaling_factor * external_row[c];
+      }
+    }
+
+    namespace rates
+    {
+      double Arrhenius(double A, double B, double C, double D, double E, const Conditions& conditions)
+      {
+        const double T = conditions.temperature;
+        return A * std::exp(C / T) * std::pow(T / D, B) * (1.0 + E * conditions.pressure);
+      }
+
+      double Troe(
+          double k0_A,
+          double k0_B,
+          double k0_C,
+          double kinf_A,
+          double kinf_B,
+          double kinf_C,
+          double Fc,
+          double N,
+          const Conditions& conditions)
+      {
+        const double T = conditions.temperature;
+        const double M = conditions.air_density;
+        const double k0 = k0_A * std::exp(k0_C / T) * std::pow(T / 300.0, k0_B);
+        const double kinf = kinf_A * std::exp(kinf_C / T) * std::pow(T / 300.0, kinf_B);
+        const double ratio = k0 * M / kinf;
+        return k0 * M / (1.0 + ratio) * std::pow(Fc, 1.0 / (1.0 + std::pow(std::log10(ratio), 2) / N));
+      }
+
+      double Tunneling(double A, double B, double C, const Conditions& conditions)
+      {
+        const double T = conditions.temperature;
+        return A * std::exp(-B / T + C / (T * T * T));
+      }
+
+      double BranchedFactor(int n, double temperature, double air_density)
+      {
+        const double a = 2.0e-22 * std::exp(n) * air_density;
+        const double b = 0.43 * std::pow(temperature / 298.0, -8.0);
+        const double ratio = a / b;
+        return a / (1.0 + ratio) * std::pow(0.41, 1.0 / (1.0 + std::pow(std::log10(ratio), 2)));
+      }
+
+      double BranchedRatio(double a0, int n)
+      {
+        return BranchedFactor(n, 293.0, 2.45e19) * (1.0 - a0) / a0;
+      }
+
+      double Branched(double X, double Y, double a0, int n, RateChannel channel, const Conditions& conditions)
+      {
+        const double T = conditions.temperature;
+        const double A = BranchedFactor(n, T, conditions.air_density * constants::avogadro * 1.0e-6);
+        const double z = BranchedRatio(a0, n);
+        const double k = X * std::exp(-Y / T);
+        return channel == RateChannel::Alkoxy ? k * z / (z + A) : k * A / (A + z);
+      }
+    }  // namespace rates
+  }  // namespace v1
+}  // namespace mechanism_configuration
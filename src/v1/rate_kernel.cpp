@@ -0,0 +1,506 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cmath>
+#include <map>
+#include <mechanism_configuration/constants.hpp>
+#include <mechanism_configuration/v1/mass_action.hpp>
+#include <mechanism_configuration/v1/rate_kernel.hpp>
+#include <mechanism_configuration/v1/serializer.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <dlfcn.h>
+#endif
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    namespace
+    {
+      /// @brief A product of a constant and named factors, written without the factors that are one
+      struct Product
+      {
+        double constant{ 1.0 };
+        std::vector<std::string> factors;
+
+        std::string str() const
+        {
+          std::string expression = factors.empty() || constant != 1.0 ? FormatCppNumber(constant) : "";
+          for (const auto& factor : factors)
+          {
+            expression += (expression.empty() ? "" : " * ") + factor;
+          }
+          return expression;
+        }
+      };
+
+      /// @brief Collects the statements of a kernel and the shared temperature terms they use
+      class KernelBuilder
+      {
+       public:
+        /// @brief Multiplies product by exp(C / T), sharing the term between all reactions with the same C
+        void Exp(double C, Product& product)
+        {
+          if (C == 0.0)
+          {
+            return;
+          }
+          uses_inverse_temperature_ = true;
+          product.factors.push_back(Shared(exponentials_, C, "exp_"));
+        }
+
+        /// @brief Multiplies product by (T / reference)^B, folding reference^-B into its constant and sharing T^B.
+        ///        Exponents too large for T^B to stay finite over atmospheric temperatures are left unfolded.
+        void Power(double B, double reference, Product& product)
+        {
+          if (B == 0.0)
+          {
+            return;
+          }
+          const double folded = product.constant * std::pow(reference, -B);
+          if (std::abs(B) > 100.0 || !std::isnormal(folded))
+          {
+            product.factors.push_back("std::pow(T / " + FormatCppNumber(reference) + ", " + FormatCppNumber(B) + ")");
+            return;
+          }
+          product.constant = folded;
+          product.factors.push_back(B == 1.0 ? "T" : Shared(powers_, B, "pow_"));
+        }
+
+        std::string Pressure()
+        {
+          uses_pressure_ = true;
+          return "P";
+        }
+
+        std::string AirDensity()
+        {
+          uses_air_density_ = true;
+          return "M";
+        }
+
+        std::string InverseTemperatureCubed()
+        {
+          uses_inverse_temperature_ = true;
+          uses_inverse_temperature_cubed_ = true;
+          return "inv_T3";
+        }
+
+        std::string InverseTemperature()
+        {
+          uses_inverse_temperature_ = true;
+          return "inv_T";
+        }
+
+        std::ostringstream& Body()
+        {
+          return body_;
+        }
+
+        void Write(std::ostream& stream, std::size_t size, std::size_t external_size) const
+        {
+          stream << "// Generated by WriteRateKernel. Do not edit.\n\n";
+          stream << "#include <cmath>\n#include <cstddef>\n#include <limits>\n\n";
+          stream << "#if defined(_WIN32)\n";
+          stream << "  #define MECHANISM_RATE_KERNEL_EXPORT extern \"C\" __declspec(dllexport)\n";
+          stream << "#else\n";
+          stream << "  #define MECHANISM_RATE_KERNEL_EXPORT extern \"C\" __attribute__((visibility(\"default\")))\n";
+          stream << "#endif\n\n";
+          stream << "MECHANISM_RATE_KERNEL_EXPORT std::size_t mechanism_rate_constant_count()\n{\n  return " << size << ";\n}\n\n";
+          stream << "MECHANISM_RATE_KERNEL_EXPORT std::size_t mechanism_external_rate_count()\n{\n  return " << external_size << ";\n}\n\n";
+          stream << "MECHANISM_RATE_KERNEL_EXPORT void mechanism_rate_constants(const double* conditions, const double* external, double* k)\n{\n";
+          stream << "  const double T = conditions[0];\n";
+          if (uses_pressure_)
+            stream << "  const double P = conditions[1];\n";
+          if (uses_air_density_)
+            stream << "  const double M = conditions[2];\n";
+          if (uses_inverse_temperature_)
+            stream << "  const double inv_T = 1.0 / T;\n";
+          if (uses_inverse_temperature_cubed_)
+            stream << "  const double inv_T3 = inv_T * inv_T * inv_T;\n";
+          for (const auto& [C, name] : exponentials_)
+          {
+            stream << "  const double " << name << " = std::exp(" << FormatCppNumber(C) << " * inv_T);\n";
+          }
+          for (const auto& [B, name] : powers_)
+          {
+            stream << "  const double " << name << " = std::pow(T, " << FormatCppNumber(B) << ");\n";
+          }
+          stream << body_.str();
+          if (external_size == 0)
+            stream << "  (void)external;\n";
+          if (size == 0)
+            stream << "  (void)k;\n";
+          stream << "}\n";
+        }
+
+       private:
+        std::string Shared(std::map<double, std::string>& terms, double value, const char* prefix)
+        {
+          auto [it, inserted] = terms.try_emplace(value, "");
+          if (inserted)
+          {
+            it->second = prefix + std::to_string(terms.size() - 1);
+          }
+          return it->second;
+        }
+
+        std::map<double, std::string> exponentials_;
+        std::map<double, std::string> powers_;
+        bool uses_pressure_{ false };
+        bool uses_air_density_{ false };
+        bool uses_inverse_temperature_{ false };
+        bool uses_inverse_temperature_cubed_{ false };
+        std::ostringstream body_;
+      };
+
+      template<typename T>
+      void WriteArrhenius(KernelBuilder& kernel, std::size_t slot, const T& r)
+      {
+        Product k{ r.A, {} };
+        kernel.Exp(r.C, k);
+        kernel.Power(r.B, r.D, k);
+        if (r.E != 0.0)
+        {
+          k.factors.push_back("(1.0 + " + FormatCppNumber(r.E) + " * " + kernel.Pressure() + ")");
+        }
+        kernel.Body() << "  k[" << slot << "] = " << k.str() << ";\n";
+      }
+
+      void WriteTroe(KernelBuilder& kernel, std::size_t slot, const types::Troe& r)
+      {
+        Product k0{ r.k0_A, { kernel.AirDensity() } };
+        kernel.Exp(r.k0_C, k0);
+        kernel.Power(r.k0_B, 300.0, k0);
+        Product kinf{ r.kinf_A, {} };
+        kernel.Exp(r.kinf_C, kinf);
+        kernel.Power(r.kinf_B, 300.0, kinf);
+        auto& body = kernel.Body();
+        body << "  {\n";
+        body << "    const double k0_M = " << k0.str() << ";\n";
+        body << "    const double ratio = k0_M / ";
+        if (kinf.factors.empty())
+        {
+          body << kinf.str();
+        }
+        else
+        {
+          body << '(' << kinf.str() << ')';
+        }
+        body << ";\n";
+        body << "    const double log_ratio = std::log10(ratio);\n";
+        body << "    k[" << slot << "] = k0_M / (1.0 + ratio) * std::pow(" << FormatCppNumber(r.Fc) << ", 1.0 / (1.0 + log_ratio * log_ratio * "
+             << FormatCppNumber(1.0 / r.N) << "));\n";
+        body << "  }\n";
+      }
+
+      void WriteTunneling(KernelBuilder& kernel, std::size_t slot, const types::Tunneling& r)
+      {
+        std::string exponent;
+        if (r.B != 0.0)
+        {
+          exponent = FormatCppNumber(-r.B) + " * " + kernel.InverseTemperature();
+        }
+        if (r.C != 0.0)
+        {
+          exponent += (exponent.empty() ? "" : " + ") + FormatCppNumber(r.C) + " * " + kernel.InverseTemperatureCubed();
+        }
+        Product k{ r.A, {} };
+        if (!exponent.empty())
+        {
+          k.factors.push_back("std::exp(" + exponent + ")");
+        }
+        kernel.Body() << "  k[" << slot << "] = " << k.str() << ";\n";
+      }
+
+      void WriteBranched(KernelBuilder& kernel, std::size_t slot, const types::Branched& r)
+      {
+        // a = k0 [M] with [M] in molecules cm-3, and b = 0.43 (T / 298)^-8
+        Product a{ 2.0e-22 * std::exp(r.n) * constants::avogadro * 1.0e-6, { kernel.AirDensity() } };
+        Product b{ 0.43, {} };
+        kernel.Power(-8.0, 298.0, b);
+        Product k{ r.X, {} };
+        kernel.Exp(-r.Y, k);
+        const std::string z = FormatCppNumber(rates::BranchedRatio(r.a0, r.n));
+        auto& body = kernel.Body();
+        body << "  {\n";
+        body << "    const double a = " << a.str() << ";\n";
+        body << "    const double ratio = a / (" << b.str() << ");\n";
+        body << "    const double log_ratio = std::log10(ratio);\n";
+        body << "    const double A = a / (1.0 + ratio) * std::pow(0.41, 1.0 / (1.0 + log_ratio * log_ratio));\n";
+        body << "    const double k_total = " << k.str() << ";\n";
+        body << "    k[" << slot << "] = k_total * A / (A + " << z << ");\n";
+        body << "    k[" << slot + 1 << "] = k_total * " << z << " / (" << z << " + A);\n";
+        body << "  }\n";
+      }
+
+      template<typename T>
+      void WriteExternal(KernelBuilder& kernel, std::size_t slot, std::size_t external, const T& r)
+      {
+        double scaling_factor;
+        if constexpr (std::is_same_v<T, types::CondensedPhasePhotolysis>)
+          scaling_factor = r.scaling_factor_;
+        else
+          scaling_factor = r.scaling_factor;
+        Product k{ scaling_factor, { "external[" + std::to_string(external) + "]" } };
+        kernel.Body() << "  k[" << slot << "] = " << k.str() << ";\n";
+      }
+
+      template<typename T>
+      const T& ReactionAt(const types::Mechanism& mechanism, std::size_t index)
+      {
+        const T* reaction = nullptr;
+        types::ForEachReactionList(
+            mechanism.reactions,
+            [&](types::ReactionType, const auto& list)
+            {
+              if constexpr (std::is_same_v<typename std::decay_t<decltype(list)>::value_type, T>)
+              {
+                reaction = &list[index];
+              }
+            });
+        return *reaction;
+      }
+
+      /// @brief Writes the species tendencies as one assignment per species, summing the rates of the processes
+      ///        that change it. Rates are computed once, and only for processes that change some species.
+      void WriteForcing(const MassActionProcesses& processes, std::ostream& stream)
+      {
+        // the terms of each species, in process order, as (coefficient, rate) pairs
+        std::vector<std::vector<std::pair<double, std::string>>> species_terms(processes.number_of_species);
+        std::ostringstream rates;
+        for (std::size_t process = 0; process < processes.factors.size(); ++process)
+        {
+          if (processes.terms[process].empty())
+          {
+            continue;
+          }
+          // whole factors first and then fractional ones, in the order Forcing multiplies them
+          std::string rate = "k[" + std::to_string(process) + "]";
+          for (const auto& factor : processes.factors[process])
+          {
+            if (factor.exponent == 1.0)
+              rate += " * y[" + std::to_string(factor.species) + "]";
+          }
+          for (const auto& factor : processes.factors[process])
+          {
+            if (factor.exponent != 1.0)
+              rate += " * std::pow(y[" + std::to_string(factor.species) + "], " + FormatCppNumber(factor.exponent) + ")";
+          }
+          const std::string name = "r" + std::to_string(process);
+          rates << "  const double " << name << " = " << rate << ";\n";
+          for (const auto& term : processes.terms[process])
+          {
+            species_terms[term.species].emplace_back(term.coefficient, name);
+          }
+        }
+
+        stream << "\nMECHANISM_RATE_KERNEL_EXPORT std::size_t mechanism_species_count()\n{\n  return " << processes.number_of_species
+               << ";\n}\n\n";
+        stream << "MECHANISM_RATE_KERNEL_EXPORT void mechanism_forcing(const double* k, const double* y, double* f)\n{\n";
+        stream << rates.str();
+        for (std::size_t species = 0; species < species_terms.size(); ++species)
+        {
+          std::string sum;
+          for (const auto& [coefficient, rate] : species_terms[species])
+          {
+            const double magnitude = std::abs(coefficient);
+            const std::string term = magnitude == 1.0 ? rate : FormatCppNumber(magnitude) + " * " + rate;
+            if (sum.empty())
+              sum = (coefficient < 0.0 ? "-" : "") + term;
+            else
+              sum += (coefficient < 0.0 ? " - " : " + ") + term;
+          }
+          stream << "  f[" << species << "] = " << (sum.empty() ? "0.0" : sum) << ";\n";
+        }
+        if (rates.str().empty())
+          stream << "  (void)k;\n  (void)y;\n";
+        if (species_terms.empty())
+          stream << "  (void)f;\n";
+        stream << "}\n";
+      }
+
+      std::size_t ExternalCount(const std::vector<RateConstantSlot>& layout)
+      {
+        std::size_t count = 0;
+        for (const auto& slot : layout)
+        {
+          count += slot.external ? 1 : 0;
+        }
+        return count;
+      }
+
+      void* OpenLibrary(const std::filesystem::path& library)
+      {
+#if defined(_WIN32)
+        return reinterpret_cast<void*>(LoadLibraryW(library.c_str()));
+#else
+        return dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+#endif
+      }
+
+      void* FindSymbol(void* handle, const char* name)
+      {
+#if defined(_WIN32)
+        return reinterpret_cast<void*>(GetProcAddress(reinterpret_cast<HMODULE>(handle), name));
+#else
+        return dlsym(handle, name);
+#endif
+      }
+
+      void CloseLibrary(void* handle)
+      {
+#if defined(_WIN32)
+        FreeLibrary(reinterpret_cast<HMODULE>(handle));
+#else
+        dlclose(handle);
+#endif
+      }
+    }  // namespace
+
+    void WriteRateKernel(const types::Mechanism& mechanism, std::ostream& stream)
+    {
+      using types::ReactionType;
+      const auto layout = RateConstantLayout(mechanism);
+      KernelBuilder kernel;
+      for (std::size_t slot = 0; slot < layout.size(); ++slot)
+      {
+        const auto& entry = layout[slot];
+        const std::size_t index = entry.reaction.index;
+        switch (entry.reaction.type)
+        {
+          case ReactionType::Arrhenius: WriteArrhenius(kernel, slot, ReactionAt<types::Arrhenius>(mechanism, index)); break;
+          case ReactionType::CondensedPhaseArrhenius:
+            WriteArrhenius(kernel, slot, ReactionAt<types::CondensedPhaseArrhenius>(mechanism, index));
+            break;
+          case ReactionType::Troe: WriteTroe(kernel, slot, ReactionAt<types::Troe>(mechanism, index)); break;
+          case ReactionType::Tunneling: WriteTunneling(kernel, slot, ReactionAt<types::Tunneling>(mechanism, index)); break;
+          case ReactionType::Branched:
+            // One block writes both branches
+            if (entry.channel == RateChannel::Nitrate)
+            {
+              WriteBranched(kernel, slot, ReactionAt<types::Branched>(mechanism, index));
+            }
+            break;
+          case ReactionType::Photolysis: WriteExternal(kernel, slot, *entry.external, ReactionAt<types::Photolysis>(mechanism, index)); break;
+          case ReactionType::CondensedPhasePhotolysis:
+            WriteExternal(kernel, slot, *entry.external, ReactionAt<types::CondensedPhasePhotolysis>(mechanism, index));
+            break;
+          case ReactionType::Emission: WriteExternal(kernel, slot, *entry.external, ReactionAt<types::Emission>(mechanism, index)); break;
+          case ReactionType::FirstOrderLoss:
+            WriteExternal(kernel, slot, *entry.external, ReactionAt<types::FirstOrderLoss>(mechanism, index));
+            break;
+          case ReactionType::WetDeposition:
+            WriteExternal(kernel, slot, *entry.external, ReactionAt<types::WetDeposition>(mechanism, index));
+            break;
+          default: break;
+        }
+      }
+      kernel.Write(stream, layout.size(), ExternalCount(layout));
+      WriteForcing(MassActionProcesses(mechanism), stream);
+    }
+
+    RateKernelPlugin::RateKernelPlugin(const std::filesystem::path& library)
+    {
+      handle_ = OpenLibrary(library);
+      if (!handle_)
+      {
+        throw std::runtime_error("Unable to load rate kernel " + library.string());
+      }
+      auto count = reinterpret_cast<std::size_t (*)()>(FindSymbol(handle_, "mechanism_rate_constant_count"));
+      auto external_count = reinterpret_cast<std::size_t (*)()>(FindSymbol(handle_, "mechanism_external_rate_count"));
+      kernel_ = reinterpret_cast<KernelFunction>(FindSymbol(handle_, "mechanism_rate_constants"));
+      auto species_count = reinterpret_cast<std::size_t (*)()>(FindSymbol(handle_, "mechanism_species_count"));
+      forcing_ = reinterpret_cast<KernelFunction>(FindSymbol(handle_, "mechanism_forcing"));
+      if (!count || !external_count || !kernel_ || !species_count || !forcing_)
+      {
+        Close();
+        throw std::runtime_error(library.string() + " is not a rate kernel");
+      }
+      size_ = count();
+      external_size_ = external_count();
+      species_size_ = species_count();
+    }
+
+    RateKernelPlugin::~RateKernelPlugin()
+    {
+      Close();
+    }
+
+    RateKernelPlugin::RateKernelPlugin(RateKernelPlugin&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr)),
+          kernel_(std::exchange(other.kernel_, nullptr)),
+          forcing_(std::exchange(other.forcing_, nullptr)),
+          size_(other.size_),
+          external_size_(other.external_size_),
+          species_size_(other.species_size_)
+    {
+    }
+
+    RateKernelPlugin& RateKernelPlugin::operator=(RateKernelPlugin&& other) noexcept
+    {
+      if (this != &other)
+      {
+        Close();
+        handle_ = std::exchange(other.handle_, nullptr);
+        kernel_ = std::exchange(other.kernel_, nullptr);
+        forcing_ = std::exchange(other.forcing_, nullptr);
+        size_ = other.size_;
+        external_size_ = other.external_size_;
+        species_size_ = other.species_size_;
+      }
+      return *this;
+    }
+
+    void RateKernelPlugin::Close()
+    {
+      if (handle_)
+      {
+        CloseLibrary(handle_);
+        handle_ = nullptr;
+        kernel_ = nullptr;
+        forcing_ = nullptr;
+      }
+    }
+
+    void RateKernelPlugin::Calculate(const Conditions& conditions, std::span<const double> external, std::span<double> k) const
+    {
+      if (external.size() != external_size_)
+      {
+        throw std::invalid_argument(
+            "Expected " + std::to_string(external_size_) + " external rates, got " + std::to_string(external.size()));
+      }
+      if (k.size() != size_)
+      {
+        throw std::invalid_argument("Expected space for " + std::to_string(size_) + " rate constants, got " + std::to_string(k.size()));
+      }
+      const double state[3] = { conditions.temperature, conditions.pressure, conditions.air_density };
+      kernel_(state, external.data(), k.data());
+    }
+
+    void RateKernelPlugin::CalculateForcing(std::span<const double> k, std::span<const double> y, std::span<double> f) const
+    {
+      if (k.size() != size_)
+      {
+        throw std::invalid_argument("Expected " + std::to_string(size_) + " rate constants, got " + std::to_string(k.size()));
+      }
+      if (y.size() != species_size_ || f.size() != species_size_)
+      {
+        throw std::invalid_argument(
+            "Expected " + std::to_string(species_size_) + " concentrations and tendencies, got " + std::to_string(y.size()) + " and " +
+            std::to_string(f.size()));
+      }
+      forcing_(k.data(), y.data(), f.data());
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
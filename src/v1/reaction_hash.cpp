@@ -0,0 +1,241 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/v1/reaction_hash.hpp>
+#include <mechanism_configuration/v1/reaction_parameters.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    namespace
+    {
+      /// @brief 64-bit FNV-1a, which is stable across platforms and runs
+      class Hasher
+      {
+       public:
+        void Add(const void* data, std::size_t size)
+        {
+          auto bytes = static_cast<const unsigned char*>(data);
+          for (std::size_t i = 0; i < size; ++i)
+          {
+            hash_ = (hash_ ^ bytes[i]) * 0x100000001b3ull;
+          }
+        }
+
+        void Add(std::string_view value)
+        {
+          Add(value.data(), value.size());
+          Add(std::uint64_t{ value.size() });
+        }
+
+        void Add(std::uint64_t value)
+        {
+          unsigned char bytes[sizeof(value)];
+          for (std::size_t i = 0; i < sizeof(value); ++i)
+          {
+            bytes[i] = static_cast<unsigned char>(value >> (8 * i));
+          }
+          Add(bytes, sizeof(bytes));
+        }
+
+        void Add(double value)
+        {
+          // +0 and -0 are the same coefficient
+          value = value == 0.0 ? 0.0 : value;
+          std::uint64_t bits;
+          std::memcpy(&bits, &value, sizeof(bits));
+          Add(bits);
+        }
+
+        std::uint64_t Value() const
+        {
+          return hash_;
+        }
+
+       private:
+        std::uint64_t hash_{ 0xcbf29ce484222325ull };
+      };
+
+      template<typename ReactionT>
+      std::uint64_t Hash(types::ReactionType type, const ReactionT& reaction)
+      {
+        Hasher hasher;
+        hasher.Add(static_cast<std::uint64_t>(type));
+        types::ForEachPhaseName(reaction, [&](const std::string& phase) { hasher.Add(std::string_view(phase)); });
+        for (const auto& component : CanonicalComponents(reaction))
+        {
+          hasher.Add(static_cast<std::uint64_t>(component.role));
+          hasher.Add(std::string_view(component.name));
+          hasher.Add(component.coefficient);
+        }
+        return hasher.Value();
+      }
+
+      template<typename ReactionT>
+      bool SameCanonicalForm(const ReactionT& a, const ReactionT& b)
+      {
+        bool same_phases = true;
+        std::vector<const std::string*> phases;
+        types::ForEachPhaseName(a, [&](const std::string& phase) { phases.push_back(&phase); });
+        std::size_t i = 0;
+        types::ForEachPhaseName(b, [&](const std::string& phase) { same_phases = same_phases && *phases[i++] == phase; });
+        return same_phases && CanonicalComponents(a) == CanonicalComponents(b);
+      }
+
+      template<typename ReactionT>
+      bool SameParameters(const ReactionT& a, const ReactionT& b)
+      {
+        std::vector<double> values;
+        ForEachParameter(a, [&](const std::string&, double value) { values.push_back(value); });
+        bool same = true;
+        std::size_t i = 0;
+        ForEachParameter(b, [&](const std::string&, double value) { same = same && values[i++] == value; });
+        return same;
+      }
+
+      /// @brief Hashes a reaction's rate parameters, treating +0 and -0 as the same value
+      template<typename ReactionT>
+      std::uint64_t ParameterHash(const ReactionT& reaction)
+      {
+        Hasher hasher;
+        ForEachParameter(reaction, [&](const std::string&, double value) { hasher.Add(value); });
+        return hasher.Value();
+      }
+
+      /// @brief The earliest of the reactions with one canonical form and one set of rate parameters, and the
+      ///        earliest of those with each name
+      struct ParameterGroup
+      {
+        std::size_t first;
+        std::unordered_map<std::string_view, std::size_t> by_name;
+      };
+
+      /// @brief The earliest of the reactions with one canonical form, and those reactions grouped by the hash
+      ///        of their rate parameters
+      struct CanonicalGroup
+      {
+        std::size_t first;
+        std::unordered_map<std::uint64_t, std::vector<ParameterGroup>> by_parameters;
+      };
+    }  // namespace
+
+    std::uint64_t CanonicalHash(const types::Arrhenius& reaction)
+    {
+      return Hash(types::ReactionType::Arrhenius, reaction);
+    }
+
+    std::uint64_t CanonicalHash(const types::Branched& reaction)
+    {
+      return Hash(types::ReactionType::Branched, reaction);
+    }
+
+    std::uint64_t CanonicalHash(const types::CondensedPhaseArrhenius& reaction)
+    {
+      return Hash(types::ReactionType::CondensedPhaseArrhenius, reaction);
+    }
+
+    std::uint64_t CanonicalHash(const types::CondensedPhasePhotolysis& reaction)
+    {
+      return Hash(types::ReactionType::CondensedPhasePhotolysis, reaction);
+    }
+
+    std::uint64_t CanonicalHash(const types::Emission& reaction)
+    {
+      return Hash(types::ReactionType::Emission, reaction);
+    }
+
+    std::uint64_t CanonicalHash(const types::FirstOrderLoss& reaction)
+    {
+      return Hash(types::ReactionType::FirstOrderLoss, reaction);
+    }
+
+    std::uint64_t CanonicalHash(const types::SimpolPhaseTransfer& reaction)
+    {
+      return Hash(types::ReactionType::SimpolPhaseTransfer, reaction);
+    }
+
+    std::uint64_t CanonicalHash(const types::AqueousEquilibrium& reaction)
+    {
+      return Hash(types::ReactionType::AqueousEquilibrium, reaction);
+    }
+
+    std::uint64_t CanonicalHash(const types::WetDeposition& reaction)
+    {
+      return Hash(types::ReactionType::WetDeposition, reaction);
+    }
+
+    std::uint64_t CanonicalHash(const types::HenrysLaw& reaction)
+    {
+      return Hash(types::ReactionType::HenrysLaw, reaction);
+    }
+
+    std::uint64_t CanonicalHash(const types::Photolysis& reaction)
+    {
+      return Hash(types::ReactionType::Photolysis, reaction);
+    }
+
+    std::uint64_t CanonicalHash(const types::Surface& reaction)
+    {
+      return Hash(types::ReactionType::Surface, reaction);
+    }
+
+    std::uint64_t CanonicalHash(const types::Troe& reaction)
+    {
+      return Hash(types::ReactionType::Troe, reaction);
+    }
+
+    std::uint64_t CanonicalHash(const types::Tunneling& reaction)
+    {
+      return Hash(types::ReactionType::Tunneling, reaction);
+    }
+
+    std::vector<DuplicateReaction> FindDuplicateReactions(const types::Reactions& reactions)
+    {
+      std::vector<DuplicateReaction> duplicates;
+      types::ForEachReactionList(
+          reactions,
+          [&](types::ReactionType type, const auto& list)
+          {
+            // one group per distinct canonical form seen so far, by hash; equal hashes are confirmed by comparing
+            // canonical forms, so each reaction is compared with O(1) groups in expectation
+            std::unordered_map<std::uint64_t, std::vector<CanonicalGroup>> groups;
+            groups.reserve(list.size());
+            for (std::size_t i = 0; i < list.size(); ++i)
+            {
+              auto& forms = groups[CanonicalHash(list[i])];
+              auto form = std::find_if(
+                  forms.begin(), forms.end(), [&](const CanonicalGroup& g) { return SameCanonicalForm(list[g.first], list[i]); });
+              if (form == forms.end())
+              {
+                form = forms.insert(forms.end(), { i, {} });
+              }
+              auto& parameter_sets = form->by_parameters[ParameterHash(list[i])];
+              auto parameters = std::find_if(
+                  parameter_sets.begin(),
+                  parameter_sets.end(),
+                  [&](const ParameterGroup& g) { return SameParameters(list[g.first], list[i]); });
+              if (parameters == parameter_sets.end())
+              {
+                parameters = parameter_sets.insert(parameter_sets.end(), { i, {} });
+              }
+              auto [named, inserted] = parameters->by_name.emplace(list[i].name, i);
+              if (form->first == i)
+              {
+                continue;
+              }
+              // prefer the earliest exact repeat, then the earliest reaction with identical parameters, then the earliest
+              std::size_t original = !inserted ? named->second : parameters->first != i ? parameters->first : form->first;
+              duplicates.push_back({ { type, original }, { type, i }, parameters->first != i, list[original].name == list[i].name });
+            }
+          });
+      return duplicates;
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
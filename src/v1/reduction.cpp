@@ -0,0 +1,210 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <mechanism_configuration/v1/reduction.hpp>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    namespace
+    {
+      std::vector<std::size_t> Lookup(const MechanismGraph& graph, const std::vector<std::string>& names)
+      {
+        std::vector<std::size_t> indices;
+        indices.reserve(names.size());
+        for (const auto& name : names)
+        {
+          auto index = graph.SpeciesIndex(name);
+          if (!index)
+          {
+            throw std::invalid_argument("Unknown species: " + name);
+          }
+          indices.push_back(*index);
+        }
+        return indices;
+      }
+    }  // namespace
+
+    ReducedMechanism Reduce(
+        const types::Mechanism& mechanism,
+        const std::vector<std::string>& target_species,
+        const std::vector<std::string>& emitted_species)
+    {
+      MechanismGraph graph(mechanism);
+      const std::size_t n_species = graph.NumberOfSpecies();
+      const std::size_t n_reactions = graph.NumberOfReactions();
+
+      auto targets = Lookup(graph, target_species);
+      std::vector<bool> alive(n_reactions, true);
+      if (!emitted_species.empty())
+      {
+        auto emitted = Lookup(graph, emitted_species);
+        alive = graph.Reachable(std::span<const std::size_t>(emitted)).reactions;
+      }
+
+      // species -> every reaction it takes part in, in compressed sparse row form
+      std::vector<std::size_t> offsets(n_species + 1, 0);
+      for (std::size_t r = 0; r < n_reactions; ++r)
+      {
+        for (std::size_t s : graph.Reactants(r))
+          ++offsets[s + 1];
+        for (std::size_t s : graph.Products(r))
+          ++offsets[s + 1];
+      }
+      for (std::size_t s = 0; s < n_species; ++s)
+      {
+        offsets[s + 1] += offsets[s];
+      }
+      std::vector<std::size_t> incidence(offsets.back());
+      std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+      for (std::size_t r = 0; r < n_reactions; ++r)
+      {
+        for (std::size_t s : graph.Reactants(r))
+          incidence[next[s]++] = r;
+        for (std::size_t s : graph.Products(r))
+          incidence[next[s]++] = r;
+      }
+
+      std::vector<bool> needed(n_species, false);
+      std::vector<bool> kept_reaction(n_reactions, false);
+      std::vector<std::size_t> queue;
+      auto need = [&](std::size_t s)
+      {
+        if (!needed[s])
+        {
+          needed[s] = true;
+          queue.push_back(s);
+        }
+      };
+      for (std::size_t s : targets)
+      {
+        need(s);
+      }
+      for (std::size_t head = 0; head < queue.size(); ++head)
+      {
+        std::size_t s = queue[head];
+        for (std::size_t i = offsets[s]; i < offsets[s + 1]; ++i)
+        {
+          std::size_t r = incidence[i];
+          if (!alive[r] || kept_reaction[r])
+          {
+            continue;
+          }
+          kept_reaction[r] = true;
+          for (std::size_t reactant : graph.Reactants(r))
+          {
+            need(reactant);
+          }
+          if (graph.IsReversible(r))
+          {
+            for (std::size_t product : graph.Products(r))
+            {
+              need(product);
+            }
+          }
+        }
+      }
+
+      // wet deposition has no species of its own, but removes every needed species in its aerosol phase
+      std::unordered_set<std::string> needed_names;
+      for (std::size_t s = 0; s < n_species; ++s)
+      {
+        if (needed[s])
+        {
+          needed_names.insert(graph.SpeciesName(s));
+        }
+      }
+      std::unordered_set<std::string> phases_with_needed_species;
+      for (const auto& phase : mechanism.phases)
+      {
+        for (const auto& name : phase.species)
+        {
+          if (needed_names.count(name))
+          {
+            phases_with_needed_species.insert(phase.name);
+            break;
+          }
+        }
+      }
+
+      ReducedMechanism result;
+      result.mechanism.version = mechanism.version;
+      result.mechanism.name = mechanism.name;
+
+      std::unordered_set<std::string> kept_species = needed_names;
+      std::unordered_set<std::string> kept_phases;
+      std::size_t r = 0;
+      types::ForEachReactionList(
+          mechanism.reactions,
+          [&](types::ReactionType type, const auto& list)
+          {
+            using ListType = std::decay_t<decltype(list)>;
+            ListType* reduced_list = nullptr;
+            types::ForEachReactionList(
+                result.mechanism.reactions,
+                [&](types::ReactionType reduced_type, auto& candidate)
+                {
+                  if constexpr (std::is_same_v<std::decay_t<decltype(candidate)>, ListType>)
+                  {
+                    if (reduced_type == type)
+                    {
+                      reduced_list = &candidate;
+                    }
+                  }
+                });
+            for (std::size_t i = 0; i < list.size(); ++i, ++r)
+            {
+              const auto& reaction = list[i];
+              bool keep = kept_reaction[r];
+              if constexpr (std::is_same_v<ListType, std::vector<types::WetDeposition>>)
+              {
+                keep = alive[r] && phases_with_needed_species.count(reaction.aerosol_phase);
+              }
+              if (!keep)
+              {
+                continue;
+              }
+              reduced_list->push_back(reaction);
+              result.reactions.push_back({ type, i });
+              types::ForEachSpeciesName(reaction, [&](const std::string& name) { kept_species.insert(name); });
+              types::ForEachPhaseName(reaction, [&](const std::string& name) { kept_phases.insert(name); });
+            }
+          });
+
+      for (std::size_t s = 0; s < mechanism.species.size(); ++s)
+      {
+        if (kept_species.count(mechanism.species[s].name))
+        {
+          result.mechanism.species.push_back(mechanism.species[s]);
+          result.species.push_back(s);
+        }
+      }
+
+      for (std::size_t p = 0; p < mechanism.phases.size(); ++p)
+      {
+        const auto& phase = mechanism.phases[p];
+        types::Phase reduced_phase;
+        reduced_phase.name = phase.name;
+        reduced_phase.unknown_properties = phase.unknown_properties;
+        for (const auto& name : phase.species)
+        {
+          if (kept_species.count(name))
+          {
+            reduced_phase.species.push_back(name);
+          }
+        }
+        if (!reduced_phase.species.empty() || kept_phases.count(phase.name))
+        {
+          result.mechanism.phases.push_back(std::move(reduced_phase));
+          result.phases.push_back(p);
+        }
+      }
+
+      return result;
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
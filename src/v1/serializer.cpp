@@ -0,0 +1,462 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <mechanism_configuration/v1/reaction_descriptors.hpp>
+#include <mechanism_configuration/v1/serializer.hpp>
+#include <mechanism_configuration/v1/validation.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace mechanism_configuration
+{
+  namespace v1
+  {
+    namespace
+    {
+      /// @brief Formats a number with the fewest digits that parse back to the same value
+      std::string FormatNumber(double value)
+      {
+        if (std::isnan(value))
+          return ".nan";
+        if (std::isinf(value))
+          return value > 0 ? ".inf" : "-.inf";
+        char buffer[32];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        return std::string(buffer, result.ptr);
+      }
+
+      /// @brief Writes JSON with two-space indentation directly to a stream
+      class JsonSink
+      {
+       public:
+        explicit JsonSink(std::ostream& stream)
+            : stream_(stream)
+        {
+        }
+
+        ~JsonSink()
+        {
+          stream_ << '\n';
+        }
+
+        void BeginMap()
+        {
+          Open('{');
+        }
+
+        void EndMap()
+        {
+          Close('}');
+        }
+
+        void BeginSequence()
+        {
+          Open('[');
+        }
+
+        void EndSequence()
+        {
+          Close(']');
+        }
+
+        void Key(const std::string& key)
+        {
+          Separate();
+          WriteString(key);
+          stream_ << ": ";
+          after_key_ = true;
+        }
+
+        void String(const std::string& value)
+        {
+          Separate();
+          WriteString(value);
+        }
+
+        void Number(double value)
+        {
+          Separate();
+          if (std::isfinite(value))
+            stream_ << FormatNumber(value);
+          else
+            WriteString(FormatNumber(value));
+        }
+
+        void Integer(int value)
+        {
+          Separate();
+          stream_ << value;
+        }
+
+       private:
+        void Open(char bracket)
+        {
+          Separate();
+          stream_ << bracket;
+          first_.push_back(true);
+        }
+
+        void Close(char bracket)
+        {
+          bool empty = first_.back();
+          first_.pop_back();
+          if (!empty)
+            NewLine();
+          stream_ << bracket;
+        }
+
+        /// @brief Starts a new element, after a comma if it is not the first in its container
+        void Separate()
+        {
+          if (after_key_)
+          {
+            after_key_ = false;
+            return;
+          }
+          if (first_.empty())
+            return;
+          if (!first_.back())
+            stream_ << ',';
+          first_.back() = false;
+          NewLine();
+        }
+
+        void NewLine()
+        {
+          stream_ << '\n' << std::string(2 * first_.size(), ' ');
+        }
+
+        void WriteString(const std::string& value)
+        {
+          stream_ << '"';
+          for (unsigned char c : value)
+          {
+            switch (c)
+            {
+              case '"': stream_ << "\\\""; break;
+              case '\\': stream_ << "\\\\"; break;
+              case '\n': stream_ << "\\n"; break;
+              case '\r': stream_ << "\\r"; break;
+              case '\t': stream_ << "\\t"; break;
+              default:
+                if (c < 0x20)
+                {
+                  char escaped[7];
+                  std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                  stream_ << escaped;
+                }
+                else
+                {
+                  stream_ << c;
+                }
+            }
+          }
+          stream_ << '"';
+        }
+
+        std::ostream& stream_;
+        /// @brief For each open container, whether no element has been written to it yet
+        std::vector<bool> first_;
+        bool after_key_ = false;
+      };
+
+      /// @brief Writes block-style YAML through a yaml-cpp emitter attached to a stream
+      class YamlSink
+      {
+       public:
+        explicit YamlSink(std::ostream& stream)
+            : emitter_(stream)
+        {
+        }
+
+        ~YamlSink()
+        {
+          emitter_ << YAML::Newline;
+        }
+
+        void BeginMap()
+        {
+          emitter_ << YAML::BeginMap;
+        }
+
+        void EndMap()
+        {
+          emitter_ << YAML::EndMap;
+        }
+
+        void BeginSequence()
+        {
+          emitter_ << YAML::BeginSeq;
+        }
+
+        void EndSequence()
+        {
+          emitter_ << YAML::EndSeq;
+        }
+
+        void Key(const std::string& key)
+        {
+          emitter_ << YAML::Key << key << YAML::Value;
+        }
+
+        void String(const std::string& value)
+        {
+          emitter_ << value;
+        }
+
+        void Number(double value)
+        {
+          // a plain scalar, which the emitter would otherwise write with a fixed precision
+          emitter_ << FormatNumber(value);
+        }
+
+        void Integer(int value)
+        {
+          emitter_ << value;
+        }
+
+       private:
+        YAML::Emitter emitter_;
+      };
+
+      const auto& keys = validation::keys;
+
+      template<typename Sink>
+      void WriteUnknownProperties(Sink& sink, const std::unordered_map<std::string, std::string>& properties)
+      {
+        std::vector<const std::pair<const std::string, std::string>*> sorted;
+        sorted.reserve(properties.size());
+        for (const auto& property : properties)
+          sorted.push_back(&property);
+        std::sort(sorted.begin(), sorted.end(), [](auto a, auto b) { return a->first < b->first; });
+        for (const auto* property : sorted)
+        {
+          sink.Key(property->first);
+          sink.String(property->second);
+        }
+      }
+
+      template<typename Sink>
+      void WriteString(Sink& sink, const std::string& key, const std::string& value)
+      {
+        sink.Key(key);
+        sink.String(value);
+      }
+
+      template<typename Sink>
+      void WriteNumber(Sink& sink, const std::string& key, double value)
+      {
+        sink.Key(key);
+        sink.Number(value);
+      }
+
+      template<typename Sink>
+      void WriteNumber(Sink& sink, const std::string& key, const std::optional<double>& value)
+      {
+        if (value)
+          WriteNumber(sink, key, *value);
+      }
+
+      template<typename Sink>
+      void WriteName(Sink& sink, const std::string& name)
+      {
+        if (!name.empty())
+          WriteString(sink, keys.name, name);
+      }
+
+      template<typename Sink>
+      void WriteComponents(Sink& sink, const std::string& key, const std::vector<types::ReactionComponent>& components)
+      {
+        sink.Key(key);
+        sink.BeginSequence();
+        for (const auto& component : components)
+        {
+          sink.BeginMap();
+          WriteString(sink, keys.species_name, component.species_name);
+          WriteNumber(sink, keys.coefficient, component.coefficient);
+          WriteUnknownProperties(sink, component.unknown_properties);
+          sink.EndMap();
+        }
+        sink.EndSequence();
+      }
+
+      template<typename Sink>
+      void Write(Sink& sink, const types::Species& species)
+      {
+        WriteString(sink, keys.name, species.name);
+        WriteNumber(sink, keys.absolute_tolerance, species.absolute_tolerance);
+        WriteNumber(sink, keys.diffusion_coefficient, species.diffusion_coefficient);
+        WriteNumber(sink, keys.molecular_weight, species.molecular_weight);
+        WriteNumber(sink, keys.henrys_law_constant_298, species.henrys_law_constant_298);
+        WriteNumber(sink, keys.henrys_law_constant_exponential_factor, species.henrys_law_constant_exponential_factor);
+        WriteNumber(sink, keys.n_star, species.n_star);
+        WriteNumber(sink, keys.density, species.density);
+        if (species.tracer_type)
+          WriteString(sink, keys.tracer_type, *species.tracer_type);
+        WriteUnknownProperties(sink, species.unknown_properties);
+      }
+
+      template<typename Sink>
+      void Write(Sink& sink, const types::Phase& phase)
+      {
+        WriteString(sink, keys.name, phase.name);
+        sink.Key(keys.species);
+        sink.BeginSequence();
+        for (const auto& species : phase.species)
+          sink.String(species);
+        sink.EndSequence();
+        WriteUnknownProperties(sink, phase.unknown_properties);
+      }
+
+      template<typename Sink, typename T, typename Field>
+      void WriteField(Sink& sink, const T& r, const Field& field)
+      {
+        const std::string& key = descriptors::KeyName(field.key);
+        if constexpr (Field::kind == descriptors::FieldKind::Number)
+        {
+          if constexpr (std::is_integral_v<std::remove_reference_t<decltype(r.*field.member)>>)
+          {
+            sink.Key(key);
+            sink.Integer(r.*field.member);
+          }
+          else
+          {
+            WriteNumber(sink, key, r.*field.member);
+          }
+        }
+        else if constexpr (Field::kind == descriptors::FieldKind::NumberList)
+        {
+          sink.Key(key);
+          sink.BeginSequence();
+          for (double value : r.*field.member)
+            sink.Number(value);
+          sink.EndSequence();
+        }
+        else if constexpr (Field::kind == descriptors::FieldKind::Components)
+        {
+          WriteComponents(sink, key, r.*field.member);
+        }
+        else if constexpr (Field::kind == descriptors::FieldKind::Species)
+        {
+          WriteString(sink, key, descriptors::SpeciesName(r.*field.member));
+        }
+        else if constexpr (Field::kind == descriptors::FieldKind::Phase)
+        {
+          WriteString(sink, key, r.*field.member);
+        }
+      }
+
+      template<typename Sink, DescribedReaction T>
+      void Write(Sink& sink, const T& r)
+      {
+        WriteString(sink, keys.type, descriptors::KeyName(ReactionDescriptor<T>::type_key));
+        WriteName(sink, r.name);
+        ForEachField(ReactionDescriptor<T>::fields, [&](const auto& field) { WriteField(sink, r, field); });
+        WriteUnknownProperties(sink, r.unknown_properties);
+      }
+
+      template<typename Sink, typename T>
+      void WriteList(Sink& sink, const std::string& key, const std::vector<T>& list)
+      {
+        sink.Key(key);
+        sink.BeginSequence();
+        for (const auto& element : list)
+        {
+          sink.BeginMap();
+          Write(sink, element);
+          sink.EndMap();
+        }
+        sink.EndSequence();
+      }
+
+      template<typename Sink>
+      void WriteDocument(Sink& sink, const types::Mechanism& mechanism)
+      {
+        sink.BeginMap();
+        WriteString(sink, keys.version, mechanism.version.to_string());
+        WriteName(sink, mechanism.name);
+        WriteList(sink, keys.species, mechanism.species);
+        WriteList(sink, keys.phases, mechanism.phases);
+        sink.Key(keys.reactions);
+        sink.BeginSequence();
+        types::ForEachReactionList(
+            mechanism.reactions,
+            [&](types::ReactionType, const auto& list)
+            {
+              for (const auto& reaction : list)
+              {
+                sink.BeginMap();
+                Write(sink, reaction);
+                sink.EndMap();
+              }
+            });
+        sink.EndSequence();
+        sink.EndMap();
+      }
+    }  // namespace
+
+    void WriteMechanism(const types::Mechanism& mechanism, std::ostream& stream, OutputFormat format)
+    {
+      if (format == OutputFormat::Json)
+      {
+        JsonSink sink(stream);
+        WriteDocument(sink, mechanism);
+      }
+      else
+      {
+        YamlSink sink(stream);
+        WriteDocument(sink, mechanism);
+      }
+    }
+
+    void WriteMechanism(const types::Mechanism& mechanism, const std::filesystem::path& path)
+    {
+      std::ofstream stream(path);
+      if (!stream)
+      {
+        throw std::runtime_error("Unable to open " + path.string() + " for writing");
+      }
+      WriteMechanism(mechanism, stream, path.extension() == ".json" ? OutputFormat::Json : OutputFormat::Yaml);
+      stream.flush();
+      if (!stream)
+      {
+        throw std::runtime_error("Unable to write " + path.string());
+      }
+    }
+
+    std::string ToString(const types::Mechanism& mechanism, OutputFormat format)
+    {
+      std::ostringstream stream;
+      WriteMechanism(mechanism, stream, format);
+      return stream.str();
+    }
+
+    std::string FormatCppNumber(double value)
+    {
+      if (std::isnan(value))
+      {
+        return "std::numeric_limits<double>::quiet_NaN()";
+      }
+      if (std::isinf(value))
+      {
+        return value > 0 ? "std::numeric_limits<double>::infinity()" : "-std::numeric_limits<double>::infinity()";
+      }
+      std::string number = FormatNumber(value);
+      if (number.find_first_of(".e") == std::string::npos)
+      {
+        number += ".0";
+      }
+      return number;
+    }
+  }  // namespace v1
+}  // namespace mechanism_configuration
@@ -11,10 +11,10 @@ namespace mechanism_configuration
     {
       Errors errors;
       std::vector<types::Species> all_species;
+      all_species.reserve(objects.size());
 
       for (const auto& object : objects)
       {
-        types::Species species;
         auto required_keys = { validation::keys.name };
         auto optional_keys = { validation::keys.absolute_tolerance,
                                validation::keys.diffusion_coefficient,
@@ -28,8 +28,8 @@ namespace mechanism_configuration
         errors.insert(errors.end(), validate.begin(), validate.end());
         if (validate.empty())
         {
-          std::string name = object[validation::keys.name].as<std::string>();
-          species.name = name;
+          types::Species& species = all_species.emplace_back();
+          species.name = object[validation::keys.name].as<std::string>();
 
           if (object[validation::keys.tracer_type])
             species.tracer_type = object[validation::keys.tracer_type].as<std::string>();
@@ -50,17 +50,15 @@ namespace mechanism_configuration
             species.density = object[validation::keys.density].as<double>();
 
           species.unknown_properties = GetComments(object);
-
-          all_species.push_back(species);
         }
       }
 
       if (!ContainsUniqueObjectsByName<types::Species>(all_species))
       {
-        errors.push_back({ ConfigParseStatus::DuplicateSpeciesDetected, "Duplicate species detected." });
+        errors.push_back({ ConfigParseStatus::DuplicateSpeciesDetected, objects.Mark() });
       }
 
-      return { errors, all_species };
+      return { std::move(errors), std::move(all_species) };
     }
   }  // namespace v1
 }  // namespace mechanism_configuration
@@ -1,12 +1,29 @@
+#include <mechanism_configuration/v1/key_binding.hpp>
 #include <mechanism_configuration/v1/parser_types.hpp>
+#include <mechanism_configuration/v1/reaction_hash.hpp>
 #include <mechanism_configuration/v1/utils.hpp>
 #include <mechanism_configuration/v1/validation.hpp>
 #include <mechanism_configuration/validate_schema.hpp>
 
+#include <algorithm>
+#include <array>
+#include <unordered_set>
+
 namespace mechanism_configuration
 {
   namespace v1
   {
+    std::string CommentText(const YAML::Node& value)
+    {
+      if (value.IsScalar())
+      {
+        return value.as<std::string>();
+      }
+      std::stringstream ss;
+      ss << value;
+      return ss.str();
+    }
+
     std::unordered_map<std::string, std::string> GetComments(const YAML::Node& object)
     {
       std::unordered_map<std::string, std::string> unknown_properties;
@@ -19,17 +36,7 @@ namespace mechanism_configuration
         // Check if the key starts with the comment prefix
         if (key_str.compare(0, comment_start.size(), comment_start) == 0)
         {
-          // Check if the value is a YAML node
-          if (key.second.IsScalar())
-          {
-            unknown_properties[key_str] = key.second.as<std::string>();
-          }
-          else
-          {
-            std::stringstream ss;
-            ss << key.second;
-            unknown_properties[key_str] = ss.str();
-          }
+          unknown_properties[key_str] = CommentText(key.second);
         }
       }
 
@@ -37,94 +44,197 @@ namespace mechanism_configuration
       return unknown_properties;
     }
 
-    std::pair<Errors, std::vector<types::Phase>> ParsePhases(const YAML::Node& objects, const std::vector<types::Species> existing_species)
+    Errors ParseMechanismHeader(const YAML::Node& object, types::Mechanism& mechanism)
+    {
+      const auto mechanism_required_keys = {
+        validation::keys.version, validation::keys.species, validation::keys.phases, validation::keys.reactions
+      };
+      const auto mechanism_optional_keys = { validation::keys.name };
+
+      auto errors = ValidateSchema(object, mechanism_required_keys, mechanism_optional_keys);
+      if (!errors.empty())
+      {
+        return errors;
+      }
+
+      Version version = Version(object[validation::keys.version].as<std::string>());
+
+      if (version.major != 1)
+      {
+        errors.push_back({ ConfigParseStatus::InvalidVersion, object[validation::keys.version].Mark(), validation::keys.version, version.to_string() });
+        return errors;
+      }
+
+      mechanism.version = version;
+
+      if (object[validation::keys.name])
+      {
+        mechanism.name = object[validation::keys.name].as<std::string>();
+      }
+
+      return errors;
+    }
+
+    std::pair<Errors, std::vector<types::Phase>> ParsePhases(const YAML::Node& objects, const std::vector<types::Species>& existing_species)
     {
       Errors errors;
-      ConfigParseStatus status = ConfigParseStatus::Success;
       std::vector<types::Phase> all_phases;
+      all_phases.reserve(objects.size());
       const std::vector<std::string> phase_required_keys = { validation::keys.name, validation::keys.species };
       const std::vector<std::string> phase_optional_keys = {};
 
+      std::unordered_set<std::string_view> known_species;
+      known_species.reserve(existing_species.size());
+      for (const auto& spec : existing_species)
+      {
+        known_species.insert(spec.name);
+      }
+
       for (const auto& object : objects)
       {
-        types::Phase phase;
         auto validate = ValidateSchema(object, phase_required_keys, phase_optional_keys);
         errors.insert(errors.end(), validate.begin(), validate.end());
         if (validate.empty())
         {
-          std::string name = object[validation::keys.name].as<std::string>();
+          types::Phase phase;
+          phase.name = object[validation::keys.name].as<std::string>();
 
-          std::vector<std::string> species{};
-          for (const auto& spec : object[validation::keys.species])
+          const auto& species = object[validation::keys.species];
+          phase.species.reserve(species.size());
+          for (const auto& spec : species)
           {
-            species.push_back(spec.as<std::string>());
+            phase.species.push_back(spec.as<std::string>());
           }
-
-          phase.name = name;
-          phase.species = species;
           phase.unknown_properties = GetComments(object);
 
-          if (RequiresUnknownSpecies(species, existing_species))
+          if (std::any_of(
+                  phase.species.begin(),
+                  phase.species.end(),
+                  [&known_species](const std::string& spec) { return !known_species.count(spec); }))
           {
-            errors.push_back({ ConfigParseStatus::PhaseRequiresUnknownSpecies, "Phase requires unknown species." });
+            errors.push_back({ ConfigParseStatus::PhaseRequiresUnknownSpecies, object.Mark(), "", std::move(phase.name) });
           }
           else
           {
-            all_phases.push_back(phase);
+            all_phases.push_back(std::move(phase));
           }
         }
       }
 
       if (!ContainsUniqueObjectsByName<types::Phase>(all_phases))
       {
-        errors.push_back({ ConfigParseStatus::DuplicatePhasesDetected, "Duplicate phases detected." });
+        errors.push_back({ ConfigParseStatus::DuplicatePhasesDetected, objects.Mark() });
       }
 
-      return { errors, all_phases };
+      return { std::move(errors), std::move(all_phases) };
     }
 
     std::pair<Errors, types::ReactionComponent> ParseReactionComponent(const YAML::Node& object)
     {
-      Errors errors;
-      ConfigParseStatus status = ConfigParseStatus::Success;
-      types::ReactionComponent component;
-      const std::vector<std::string> reaction_component_required_keys = { validation::keys.species_name };
-      const std::vector<std::string> reaction_component_optional_keys = { validation::keys.coefficient };
+      static const KeyTable keys({ validation::keys.species_name }, { validation::keys.coefficient });
 
-      auto validate = ValidateSchema(object, reaction_component_required_keys, reaction_component_optional_keys);
-      errors.insert(errors.end(), validate.begin(), validate.end());
-      if (validate.empty())
-        if (status == ConfigParseStatus::Success)
+      types::ReactionComponent component;
+      BoundObject bound(object, keys);
+      Errors errors = bound.SchemaErrors();
+      if (errors.empty())
+      {
+        component.species_name = bound[validation::keys.species_name].as<std::string>();
+        if (bound.Has(validation::keys.coefficient))
         {
-          std::string species_name = object[validation::keys.species_name].as<std::string>();
-          double coefficient = 1;
-          if (object[validation::keys.coefficient])
-          {
-            coefficient = object[validation::keys.coefficient].as<double>();
-          }
-
-          component.species_name = species_name;
-          component.coefficient = coefficient;
-          component.unknown_properties = GetComments(object);
+          component.coefficient = bound[validation::keys.coefficient].as<double>();
         }
+        component.unknown_properties = bound.TakeComments();
+      }
 
-      return { errors, component };
+      return { std::move(errors), std::move(component) };
     }
 
-    std::pair<Errors, std::vector<types::ReactionComponent>> ParseReactantsOrProducts(const std::string& key, const YAML::Node& object)
+    std::pair<Errors, std::vector<types::ReactionComponent>> ParseReactionComponents(const YAML::Node& components)
     {
       Errors errors;
       std::vector<types::ReactionComponent> result{};
-      for (const auto& product : object[key])
+      result.reserve(components.size());
+      for (const auto& object : components)
       {
-        auto component_parse = ParseReactionComponent(product);
+        auto component_parse = ParseReactionComponent(object);
         errors.insert(errors.end(), component_parse.first.begin(), component_parse.first.end());
         if (component_parse.first.empty())
         {
-          result.push_back(component_parse.second);
+          result.push_back(std::move(component_parse.second));
+        }
+      }
+      return { std::move(errors), std::move(result) };
+    }
+
+    std::pair<Errors, std::vector<types::ReactionComponent>> ParseReactantsOrProducts(const std::string& key, const YAML::Node& object)
+    {
+      return ParseReactionComponents(object[key]);
+    }
+
+    Errors ParseReaction(const YAML::Node& object, const PhaseIndex& index, types::Reactions& reactions)
+    {
+      static const std::map<std::string, std::shared_ptr<IReactionParser>> parsers = {
+        { validation::keys.Arrhenius_key, std::make_shared<ArrheniusParser>() },
+        { validation::keys.HenrysLaw_key, std::make_shared<HenrysLawParser>() },
+        { validation::keys.WetDeposition_key, std::make_shared<WetDepositionParser>() },
+        { validation::keys.AqueousPhaseEquilibrium_key, std::make_shared<AqueousEquilibriumParser>() },
+        { validation::keys.SimpolPhaseTransfer_key, std::make_shared<SimpolPhaseTransferParser>() },
+        { validation::keys.FirstOrderLoss_key, std::make_shared<FirstOrderLossParser>() },
+        { validation::keys.Emission_key, std::make_shared<EmissionParser>() },
+        { validation::keys.CondensedPhasePhotolysis_key, std::make_shared<CondensedPhasePhotolysisParser>() },
+        { validation::keys.Photolysis_key, std::make_shared<PhotolysisParser>() },
+        { validation::keys.Surface_key, std::make_shared<SurfaceParser>() },
+        { validation::keys.Tunneling_key, std::make_shared<TunnelingParser>() },
+        { validation::keys.Branched_key, std::make_shared<BranchedParser>() },
+        { validation::keys.Troe_key, std::make_shared<TroeParser>() },
+        { validation::keys.CondensedPhaseArrhenius_key, std::make_shared<CondensedPhaseArrheniusParser>() },
+      };
+
+      Errors errors;
+      std::string type = object[validation::keys.type].as<std::string>();
+      auto it = parsers.find(type);
+      if (it != parsers.end())
+      {
+        errors = it->second->parse(object, index, reactions);
+      }
+      else
+      {
+        errors.push_back({ ConfigParseStatus::UnknownType, object[validation::keys.type].Mark(), validation::keys.type, type });
+      }
+      return errors;
+    }
+
+    Errors ParseReaction(
+        const YAML::Node& object,
+        const std::vector<types::Species>& existing_species,
+        const std::vector<types::Phase>& existing_phases,
+        types::Reactions& reactions)
+    {
+      return ParseReaction(object, PhaseIndex(existing_species, existing_phases), reactions);
+    }
+
+    void RecordReactionMarks(const types::Reactions& reactions, const YAML::Mark& mark, ReactionMarks& marks)
+    {
+      types::ForEachReactionList(
+          reactions,
+          [&](types::ReactionType type, const auto& list) { marks[static_cast<std::size_t>(type)].resize(list.size(), mark); });
+    }
+
+    Errors FindDuplicateReactionErrors(const types::Reactions& reactions, const ReactionMarks& marks)
+    {
+      Errors errors;
+      for (const auto& duplicate : FindDuplicateReactions(reactions))
+      {
+        if (duplicate.identical_parameters && duplicate.identical_names)
+        {
+          const auto& original = marks[static_cast<std::size_t>(duplicate.original.type)][duplicate.original.index];
+          errors.push_back({ ConfigParseStatus::DuplicateReactionDetected,
+                             marks[static_cast<std::size_t>(duplicate.duplicate.type)][duplicate.duplicate.index],
+                             validation::TypeKey(duplicate.duplicate.type),
+                             "same as the reaction at line " + std::to_string(original.line + 1) });
         }
       }
-      return { errors, result };
+      return errors;
     }
 
     std::pair<Errors, types::Reactions>
@@ -132,41 +242,20 @@ namespace mechanism_configuration
     {
       Errors errors;
       types::Reactions reactions;
-
-      std::map<std::string, std::unique_ptr<IReactionParser>> parsers;
-      parsers[validation::keys.Arrhenius_key] = std::make_unique<ArrheniusParser>();
-      parsers[validation::keys.HenrysLaw_key] = std::make_unique<HenrysLawParser>();
-      parsers[validation::keys.WetDeposition_key] = std::make_unique<WetDepositionParser>();
-      parsers[validation::keys.AqueousPhaseEquilibrium_key] = std::make_unique<AqueousEquilibriumParser>();
-      parsers[validation::keys.SimpolPhaseTransfer_key] = std::make_unique<SimpolPhaseTransferParser>();
-      parsers[validation::keys.FirstOrderLoss_key] = std::make_unique<FirstOrderLossParser>();
-      parsers[validation::keys.Emission_key] = std::make_unique<EmissionParser>();
-      parsers[validation::keys.CondensedPhasePhotolysis_key] = std::make_unique<CondensedPhasePhotolysisParser>();
-      parsers[validation::keys.Photolysis_key] = std::make_unique<PhotolysisParser>();
-      parsers[validation::keys.Surface_key] = std::make_unique<SurfaceParser>();
-      parsers[validation::keys.Tunneling_key] = std::make_unique<TunnelingParser>();
-      parsers[validation::keys.Branched_key] = std::make_unique<BranchedParser>();
-      parsers[validation::keys.Troe_key] = std::make_unique<TroeParser>();
-      parsers[validation::keys.CondensedPhaseArrhenius_key] = std::make_unique<CondensedPhaseArrheniusParser>();
+      ReactionMarks marks;
+      const PhaseIndex index(existing_species, existing_phases);
 
       for (const auto& object : objects)
       {
-        std::string type = object[validation::keys.type].as<std::string>();
-        auto it = parsers.find(type);
-        if (it != parsers.end())
-        {
-          auto parse_errors = it->second->parse(object, existing_species, existing_phases, reactions);
-          errors.insert(errors.end(), parse_errors.begin(), parse_errors.end());
-        }
-        else
-        {
-          std::string line = std::to_string(object[validation::keys.type].Mark().line + 1);
-          std::string column = std::to_string(object[validation::keys.type].Mark().column + 1);
-          errors.push_back({ ConfigParseStatus::UnknownType, "Unknown type: " + type + " at line " + line + " column " + column });
-        }
+        auto parse_errors = ParseReaction(object, index, reactions);
+        errors.insert(errors.end(), parse_errors.begin(), parse_errors.end());
+        RecordReactionMarks(reactions, object.Mark(), marks);
       }
 
-      return { errors, reactions };
+      auto duplicate_errors = FindDuplicateReactionErrors(reactions, marks);
+      errors.insert(errors.end(), duplicate_errors.begin(), duplicate_errors.end());
+
+      return { std::move(errors), std::move(reactions) };
     }
   }  // namespace v1
 }  // namespace mechanism_configuration
@@ -6,11 +6,9 @@ namespace mechanism_configuration
   Errors ValidateSchema(const YAML::Node& object, const std::vector<std::string>& required_keys, const std::vector<std::string>& optional_keys)
   {
     Errors errors;
-    std::string line = std::to_string(object.Mark().line + 1);
-    std::string column = std::to_string(object.Mark().column + 1);
     if (!object || object.IsNull())
     {
-      errors.push_back({ ConfigParseStatus::RequiredKeyNotFound, line + ":" + column + ": error: Object is null" });
+      errors.push_back({ ConfigParseStatus::RequiredKeyNotFound, object.Mark(), "", "Object is null" });
       return errors;
     }
 
@@ -35,7 +33,7 @@ namespace mechanism_configuration
 
     for (const auto& key : missing_keys)
     {
-      errors.push_back({ ConfigParseStatus::RequiredKeyNotFound, line + ":" + column + ": error: Missing required key '" + key + "'" });
+      errors.push_back({ ConfigParseStatus::RequiredKeyNotFound, object.Mark(), key });
     }
 
     // Find keys that are neither required nor optional
@@ -52,9 +50,7 @@ namespace mechanism_configuration
     {
       if (key.find("__") == std::string::npos)
       {
-        std::string line = std::to_string(object[key].Mark().line + 1);
-        std::string column = std::to_string(object[key].Mark().column + 1);
-        errors.push_back({ ConfigParseStatus::InvalidKey, line + ":" + column + ": error: Non-standard key '" + key + "' found" });
+        errors.push_back({ ConfigParseStatus::InvalidKey, object[key].Mark(), key });
       }
     }
 
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/c_api.h>
+#include <mechanism_configuration/parse_status.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+TEST(CApi, ReadsAParsedMechanism)
+{
+  mc_mechanism* mechanism = mc_parse("examples/v1/full_configuration.yaml");
+  ASSERT_EQ(mc_is_valid(mechanism), 1);
+  EXPECT_EQ(mc_num_errors(mechanism), 0);
+  EXPECT_EQ(mc_num_species(mechanism), 11);
+  EXPECT_EQ(mc_num_phases(mechanism), 4);
+  EXPECT_EQ(std::string(mc_species_name(mechanism, 0)), "A");
+
+  std::size_t name_length = mc_max_species_name_length(mechanism);
+  std::vector<char> names(mc_num_species(mechanism) * name_length);
+  mc_get_species_names(mechanism, names.data(), name_length);
+  EXPECT_EQ(std::string(names.begin(), names.begin() + name_length), "A" + std::string(name_length - 1, ' '));
+
+  ASSERT_EQ(mc_num_reactions(mechanism, MC_ARRHENIUS), 2);
+  ASSERT_EQ(mc_num_reaction_params(MC_ARRHENIUS), 5);
+  std::vector<double> params(2 * 5);
+  mc_get_arrhenius_params(mechanism, params.data());
+  EXPECT_EQ(params[0], 32.1);
+  EXPECT_EQ(params[1], -2.3);
+  EXPECT_EQ(params[2], 102.3);
+  EXPECT_EQ(params[3], 63.4);
+  EXPECT_EQ(params[4], -1.3);
+
+  EXPECT_EQ(mc_num_reaction_params(MC_TROE), 8);
+  EXPECT_EQ(mc_num_reaction_params(MC_HENRYS_LAW), 0);
+  std::vector<double> troe(mc_num_reactions(mechanism, MC_TROE) * 8);
+  mc_get_reaction_params(mechanism, MC_TROE, troe.data());
+  EXPECT_EQ(troe[0], 1.2e-12);
+
+  ASSERT_EQ(mc_num_reactant_entries(mechanism, MC_ARRHENIUS), 2);
+  std::vector<std::size_t> offsets(3), species(2);
+  std::vector<double> coefficients(2);
+  mc_get_reactants(mechanism, MC_ARRHENIUS, offsets.data(), species.data(), coefficients.data());
+  EXPECT_EQ(offsets, (std::vector<std::size_t>{ 0, 1, 2 }));
+  EXPECT_EQ(std::string(mc_species_name(mechanism, species[0])), "B");
+  EXPECT_EQ(coefficients[0], 1.0);
+
+  ASSERT_EQ(mc_num_product_entries(mechanism, MC_ARRHENIUS), 2);
+  mc_get_products(mechanism, MC_ARRHENIUS, offsets.data(), species.data(), coefficients.data());
+  EXPECT_EQ(std::string(mc_species_name(mechanism, species[1])), "C");
+
+  ASSERT_EQ(mc_num_external_rates(mechanism), 5);
+  EXPECT_EQ(std::string(mc_external_rate_key(mechanism, 0)), "CONDENSED_PHOTO.condensed photo B");
+  EXPECT_EQ(std::string(mc_external_rate_key(mechanism, 4)), "PHOTO.photo B");
+  std::size_t parameter = 0;
+  ASSERT_EQ(mc_find_external_rate(mechanism, "LOSS.my first order loss", &parameter), 1);
+  EXPECT_EQ(parameter, 2);
+  EXPECT_EQ(mc_find_external_rate(mechanism, "PHOTO.missing", &parameter), 0);
+
+  mc_free(mechanism);
+}
+
+TEST(CApi, ReportsErrors)
+{
+  mc_mechanism* mechanism = mc_parse("examples/_missing_configuration.yaml");
+  EXPECT_EQ(mc_is_valid(mechanism), 0);
+  ASSERT_GE(mc_num_errors(mechanism), 1);
+  EXPECT_NE(std::string(mc_error_message(mechanism, 0)).find("_missing_configuration.yaml"), std::string::npos);
+  EXPECT_EQ(mc_num_species(mechanism), 0);
+  EXPECT_EQ(mc_num_reactions(mechanism, MC_ARRHENIUS), 0);
+  EXPECT_EQ(mc_num_external_rates(mechanism), 0);
+  mc_free(mechanism);
+}
+
+TEST(CApi, ChecksIndicesAndHandles)
+{
+  mc_mechanism* mechanism = mc_parse("examples/v1/full_configuration.yaml");
+  ASSERT_EQ(mc_is_valid(mechanism), 1);
+  EXPECT_EQ(mc_error_status(mechanism, 0), -1);
+  EXPECT_EQ(mc_error_message(mechanism, 0), nullptr);
+  EXPECT_EQ(mc_species_name(mechanism, mc_num_species(mechanism)), nullptr);
+  EXPECT_EQ(mc_external_rate_key(mechanism, mc_num_external_rates(mechanism)), nullptr);
+  std::size_t parameter = 0;
+  EXPECT_EQ(mc_find_external_rate(mechanism, nullptr, &parameter), 0);
+  mc_free(mechanism);
+
+  EXPECT_EQ(mc_is_valid(nullptr), 0);
+  EXPECT_EQ(mc_num_errors(nullptr), 0);
+  EXPECT_EQ(mc_num_species(nullptr), 0);
+  EXPECT_EQ(mc_num_reactions(nullptr, MC_ARRHENIUS), 0);
+  EXPECT_EQ(mc_num_external_rates(nullptr), 0);
+  mc_free(nullptr);
+}
+
+TEST(CApi, ReportsExceptionsAsErrors)
+{
+  const char* path = "c_api_malformed.yaml";
+  {
+    std::ofstream file(path);
+    file << "version: 1.0.0\nspecies: [\n";
+  }
+  mc_mechanism* mechanism = mc_parse(path);
+  ASSERT_NE(mechanism, nullptr);
+  EXPECT_EQ(mc_is_valid(mechanism), 0);
+  ASSERT_EQ(mc_num_errors(mechanism), 1);
+  EXPECT_EQ(mc_error_status(mechanism, 0), static_cast<int>(mechanism_configuration::ConfigParseStatus::UnhandledException));
+  EXPECT_EQ(mc_num_species(mechanism), 0);
+  mc_free(mechanism);
+  std::remove(path);
+
+  mechanism = mc_parse(nullptr);
+  ASSERT_NE(mechanism, nullptr);
+  EXPECT_EQ(mc_is_valid(mechanism), 0);
+  EXPECT_EQ(mc_num_errors(mechanism), 1);
+  mc_free(mechanism);
+}
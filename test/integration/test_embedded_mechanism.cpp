@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include <full_configuration_mechanism.hpp>
+#include <mechanism_configuration/v1/diff.hpp>
+#include <mechanism_configuration/v1/parser.hpp>
+#include <mechanism_configuration/v1/serializer.hpp>
+
+using namespace mechanism_configuration;
+
+// The tables are usable in constant expressions
+static_assert(full_configuration::species_names.size() == 11);
+static_assert(full_configuration::phase_names.size() == 4);
+static_assert(full_configuration::arrhenius_parameters.size() == 2);
+static_assert(full_configuration::tunneling_parameters[0].B > 0);
+
+TEST(EmbeddedMechanism, MatchesParsedConfiguration)
+{
+  auto parsed = v1::Parser().Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  const auto& embedded = full_configuration::Mechanism();
+
+  EXPECT_TRUE(v1::Diff(*parsed.mechanism, embedded).Empty());
+  EXPECT_EQ(v1::ToString(*parsed.mechanism, v1::OutputFormat::Yaml), v1::ToString(embedded, v1::OutputFormat::Yaml));
+  EXPECT_EQ(embedded.name, full_configuration::name);
+  EXPECT_EQ(embedded.version.major, 1);
+}
+
+TEST(EmbeddedMechanism, TablesHoldTheParsedParameters)
+{
+  auto parsed = v1::Parser().Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  const auto& mechanism = *parsed.mechanism;
+
+  for (std::size_t i = 0; i < mechanism.species.size(); ++i)
+  {
+    EXPECT_EQ(mechanism.species[i].name, full_configuration::species_names[i]);
+  }
+  for (std::size_t i = 0; i < mechanism.reactions.arrhenius.size(); ++i)
+  {
+    EXPECT_EQ(mechanism.reactions.arrhenius[i].A, full_configuration::arrhenius_parameters[i].A);
+    EXPECT_EQ(mechanism.reactions.arrhenius[i].C, full_configuration::arrhenius_parameters[i].C);
+  }
+  EXPECT_EQ(mechanism.reactions.branched[0].n, full_configuration::branched_parameters[0].n);
+  EXPECT_EQ(mechanism.reactions.simpol_phase_transfer[0].B, full_configuration::simpol_phase_transfer_parameters[0].B);
+}
+
+TEST(EmbeddedMechanism, IsBuiltOnce)
+{
+  EXPECT_EQ(&full_configuration::Mechanism(), &full_configuration::Mechanism());
+}
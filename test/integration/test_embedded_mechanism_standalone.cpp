@@ -0,0 +1,15 @@
+#include <gtest/gtest.h>
+
+#include <full_configuration_mechanism.hpp>
+
+// This test is not linked to the library, so it checks that the generated header stands on its own
+
+TEST(EmbeddedMechanism, BuildsWithoutTheLibrary)
+{
+  const auto& mechanism = full_configuration::Mechanism();
+  EXPECT_EQ(mechanism.name, full_configuration::name);
+  ASSERT_EQ(mechanism.species.size(), full_configuration::species_names.size());
+  EXPECT_EQ(mechanism.species[0].name, full_configuration::species_names[0]);
+  ASSERT_EQ(mechanism.reactions.arrhenius.size(), full_configuration::arrhenius_parameters.size());
+  EXPECT_EQ(mechanism.reactions.arrhenius[0].A, full_configuration::arrhenius_parameters[0].A);
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/parser.hpp>
+#include <yaml-cpp/yaml.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <string>
+
+using namespace mechanism_configuration;
+
+// Counts the allocations whose size is that of a copy of a long name, so that copies of names made while
+// parsing can be told apart from the parser's other allocations
+namespace
+{
+  constexpr std::size_t name_length = 200;
+  std::atomic<bool> counting{ false };
+  std::atomic<std::size_t> name_allocations{ 0 };
+
+  void* Allocate(std::size_t size)
+  {
+    // A string of name_length characters needs name_length + 1 bytes; some libraries round the capacity up
+    if (counting && size > name_length && size <= name_length + 16)
+    {
+      ++name_allocations;
+    }
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+    {
+      return p;
+    }
+    throw std::bad_alloc();
+  }
+
+  template<typename Func>
+  std::size_t CountNameAllocations(Func&& f)
+  {
+    name_allocations = 0;
+    counting = true;
+    f();
+    counting = false;
+    return name_allocations;
+  }
+
+  std::string Name(char prefix, std::size_t i)
+  {
+    std::string name = prefix + std::to_string(i);
+    name.resize(name_length, '_');
+    return name;
+  }
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+  return Allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return Allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+TEST(ParseAllocations, BuildsTheMechanismWithoutCopyingNames)
+{
+  // Species with long names, a phase listing all of them and reactions between them, so that every name in
+  // the configuration is long enough to be allocated on its own
+  constexpr std::size_t number_of_species = 50;
+  std::string config = "version: 1.0.0\nname: allocations\nspecies:\n";
+  for (std::size_t i = 0; i < number_of_species; ++i)
+  {
+    config += "  - name: " + Name('S', i) + "\n";
+  }
+  config += "phases:\n  - name: " + Name('P', 0) + "\n    species:\n";
+  for (std::size_t i = 0; i < number_of_species; ++i)
+  {
+    config += "      - " + Name('S', i) + "\n";
+  }
+  config += "reactions:\n";
+  for (std::size_t i = 0; i + 1 < number_of_species; ++i)
+  {
+    config += "  - type: ARRHENIUS\n    gas phase: " + Name('P', 0) + "\n    name: " + Name('R', i) + "\n";
+    config += "    reactants:\n      - species name: " + Name('S', i) + "\n";
+    config += "    products:\n      - species name: " + Name('S', i + 1) + "\n";
+  }
+  // Every long name in the configuration: the species, the phase listing them, and each reaction's phase,
+  // name, reactant and product
+  const std::size_t names_in_config = number_of_species + 1 + number_of_species + 4 * (number_of_species - 1);
+
+  const auto path = std::filesystem::temp_directory_path() / "mechanism_configuration_parse_allocations.yaml";
+  std::ofstream(path) << config;
+
+  // The allocations yaml-cpp makes to load the file are not the parser's
+  const std::size_t load = CountNameAllocations([&] { YAML::LoadFile(path.string()); });
+  v1::Parser parser;
+  ParserResult<v1::types::Mechanism> parsed;
+  const std::size_t parse = CountNameAllocations([&] { parsed = parser.Parse(path); });
+  std::filesystem::remove(path);
+
+  ASSERT_TRUE(parsed) << (parsed.errors.empty() ? "" : parsed.errors[0].to_string());
+  ASSERT_EQ(parsed.mechanism->species.size(), number_of_species);
+  ASSERT_EQ(parsed.mechanism->reactions.arrhenius.size(), number_of_species - 1);
+  ASSERT_GE(parse, load);
+
+  // Reading a name from yaml-cpp makes one string, which is moved into place. The only other copies are the
+  // keys of the index used to check references against the species and phases, one per species and phase.
+  const double per_name = static_cast<double>(parse - load) / static_cast<double>(names_in_config);
+  std::cout << "name allocations per name: " << per_name << std::endl;
+  EXPECT_LE(per_name, 1.25);
+}
@@ -3,6 +3,8 @@
 #include <mechanism_configuration/parser.hpp>
 #include <mechanism_configuration/v1/types.hpp>
 
+#include <stdexcept>
+
 TEST(ParserBase, ParsesFullV0ConfigurationWithoutExtension)
 {
   mechanism_configuration::UniversalParser parser;
@@ -57,6 +59,69 @@ TEST(ParserBase, ParserReportsBadFiles)
     auto parsed = parser.Parse(path);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, mechanism_configuration::ConfigParseStatus::FileNotFound);
+    EXPECT_EQ(parsed.errors[0].status, mechanism_configuration::ConfigParseStatus::FileNotFound);
   }
 }
+
+TEST(ParserBase, ParseManyReturnsResultsInInputOrder)
+{
+  mechanism_configuration::UniversalParser parser;
+  std::vector<std::filesystem::path> paths = { "examples/v1/full_configuration.yaml",
+                                               "examples/v0/config.json",
+                                               "examples/_missing_configuration.yaml",
+                                               "examples/v1/full_configuration.json",
+                                               "examples/v0/config.yaml" };
+  for (std::size_t max_concurrency : { 0, 1, 2 })
+  {
+    auto results = parser.ParseMany(paths, max_concurrency);
+    ASSERT_EQ(results.size(), paths.size());
+
+    EXPECT_TRUE(results[0]);
+    EXPECT_EQ(results[0].mechanism->version.major, 1);
+    EXPECT_TRUE(results[1]);
+    EXPECT_EQ(results[1].mechanism->version.major, 0);
+    EXPECT_FALSE(results[2]);
+    EXPECT_EQ(results[2].errors.size(), 1);
+    EXPECT_EQ(results[2].errors[0].status, mechanism_configuration::ConfigParseStatus::FileNotFound);
+    EXPECT_TRUE(results[3]);
+    EXPECT_EQ(results[3].mechanism->version.major, 1);
+    EXPECT_TRUE(results[4]);
+    EXPECT_EQ(results[4].mechanism->version.major, 0);
+  }
+}
+
+namespace
+{
+  struct ThrowingParser
+  {
+    mechanism_configuration::ParserResult<mechanism_configuration::GlobalMechanism> Parse(const std::filesystem::path&)
+    {
+      throw std::runtime_error("parser failed");
+    }
+  };
+}  // namespace
+
+TEST(ParserBase, ParseConcurrentlyReportsExceptions)
+{
+  std::vector<std::filesystem::path> paths = { "a.yaml", "b.yaml" };
+  auto results = mechanism_configuration::ParseConcurrently<ThrowingParser>(paths, 2);
+  ASSERT_EQ(results.size(), paths.size());
+  for (std::size_t i = 0; i < paths.size(); ++i)
+  {
+    EXPECT_FALSE(results[i]);
+    ASSERT_EQ(results[i].errors.size(), 1);
+    EXPECT_EQ(results[i].errors[0].status, mechanism_configuration::ConfigParseStatus::UnhandledException);
+    EXPECT_EQ(results[i].errors[0].detail, "parser failed");
+    ASSERT_TRUE(results[i].errors[0].file);
+    EXPECT_EQ(*results[i].errors[0].file, paths[i]);
+  }
+}
+
+TEST(ParserBase, ParseAsyncReturnsFuture)
+{
+  mechanism_configuration::UniversalParser parser;
+  auto future = parser.ParseAsync("examples/v1/full_configuration.yaml");
+  auto parsed = future.get();
+  EXPECT_TRUE(parsed);
+  EXPECT_EQ(parsed.mechanism->version.major, 1);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/constants.hpp>
+#include <mechanism_configuration/v1/forcing.hpp>
+#include <mechanism_configuration/v1/parser.hpp>
+#include <mechanism_configuration/v1/rate_constants.hpp>
+#include <mechanism_configuration/v1/rate_kernel.hpp>
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+TEST(RateKernelPlugin, MatchesTheGenericPath)
+{
+  auto parsed = v1::Parser().Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  v1::RateConstants generic(*parsed.mechanism);
+  v1::RateKernelPlugin plugin(RATE_KERNEL_LIBRARY);
+  ASSERT_EQ(plugin.Size(), generic.Size());
+  ASSERT_EQ(plugin.NumberOfExternalRates(), generic.NumberOfExternalRates());
+
+  std::vector<double> external(generic.NumberOfExternalRates());
+  for (std::size_t i = 0; i < external.size(); ++i)
+  {
+    external[i] = 1.0e-3 * (i + 1);
+  }
+  std::vector<double> expected(generic.Size());
+  std::vector<double> actual(plugin.Size());
+  for (double temperature : { 220.0, 272.5, 298.15, 310.0 })
+  {
+    for (double pressure : { 5.0e4, 101325.0 })
+    {
+      v1::Conditions conditions{ temperature, pressure, pressure / (constants::R * temperature) };
+      generic.Calculate(conditions, external, expected);
+      plugin.Calculate(conditions, external, actual);
+      for (std::size_t i = 0; i < expected.size(); ++i)
+      {
+        EXPECT_NEAR(actual[i], expected[i], 1.0e-12 * std::abs(expected[i])) << "rate constant " << i << " at " << temperature << " K";
+      }
+    }
+  }
+}
+
+TEST(RateKernelPlugin, ForcingMatchesTheGenericPath)
+{
+  auto parsed = v1::Parser().Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  v1::Forcing generic(*parsed.mechanism);
+  v1::RateKernelPlugin plugin(RATE_KERNEL_LIBRARY);
+  ASSERT_EQ(plugin.NumberOfSpecies(), generic.NumberOfSpecies());
+  ASSERT_EQ(plugin.Size(), generic.NumberOfProcesses());
+
+  std::vector<double> k(plugin.Size());
+  std::vector<double> y(plugin.NumberOfSpecies());
+  for (std::size_t i = 0; i < k.size(); ++i)
+  {
+    k[i] = 0.5 + 0.01 * i;
+  }
+  for (std::size_t i = 0; i < y.size(); ++i)
+  {
+    y[i] = 0.2 + 0.05 * i;
+  }
+  std::vector<double> expected(y.size());
+  std::vector<double> actual(y.size());
+  generic.Calculate(k, y, expected, 1);
+  plugin.CalculateForcing(k, y, actual);
+  for (std::size_t i = 0; i < expected.size(); ++i)
+  {
+    EXPECT_NEAR(actual[i], expected[i], 1.0e-12 * std::abs(expected[i])) << "species " << i;
+  }
+  EXPECT_THROW(plugin.CalculateForcing(k, y, std::span<double>(actual).first(0)), std::invalid_argument);
+}
+
+TEST(RateKernelPlugin, RejectsLibrariesWithoutAKernel)
+{
+  EXPECT_THROW(v1::RateKernelPlugin("no_such_rate_kernel.so"), std::runtime_error);
+}
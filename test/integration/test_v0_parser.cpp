@@ -40,6 +40,6 @@ TEST(ParserBase, ParserReportsBadFiles)
     auto parsed = parser.Parse(path);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::FileNotFound);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::FileNotFound);
   }
 }
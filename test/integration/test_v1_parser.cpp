@@ -56,7 +56,7 @@ TEST(ParserBase, ParserReportsBadFiles)
     auto parsed = parser.Parse(path);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::FileNotFound);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::FileNotFound);
   }
 }
 
@@ -67,5 +67,36 @@ TEST(ParserBase, ParserReportsDirectory)
   auto parsed = parser.Parse(path);
   EXPECT_FALSE(parsed);
   EXPECT_EQ(parsed.errors.size(), 1);
-  EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::FileNotFound);
+  EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::FileNotFound);
+}
+
+TEST(ParserBase, ErrorsCarryStructuredLocation)
+{
+  v1::Parser parser;
+  std::string path = "v1_unit_configs/reactions/arrhenius/mutually_exclusive.yaml";
+  auto parsed = parser.Parse(path);
+  EXPECT_FALSE(parsed);
+  ASSERT_EQ(parsed.errors.size(), 1);
+
+  const auto& error = parsed.errors[0];
+  EXPECT_EQ(error.status, ConfigParseStatus::MutuallyExclusiveOption);
+  ASSERT_NE(error.file, nullptr);
+  EXPECT_EQ(*error.file, std::filesystem::path(path));
+  EXPECT_EQ(error.line, 9);
+  EXPECT_EQ(error.column, 7);
+  EXPECT_EQ(error.key, "Ea");
+  EXPECT_EQ(error.detail, "C");
+  EXPECT_EQ(error.to_string(), path + ":9:7: error: Mutually exclusive option: C [Ea]");
+}
+
+TEST(ParserBase, EveryStatusHasANameAndDescription)
+{
+  for (int i = 0; i <= static_cast<int>(ConfigParseStatus::UnhandledException); ++i)
+  {
+    auto status = static_cast<ConfigParseStatus>(i);
+    EXPECT_NE(configParseStatusToString(status), "Unknown");
+    EXPECT_NE(configParseStatusDescription(status), "Unknown error");
+  }
+  EXPECT_EQ(configParseStatusToString(ConfigParseStatus::UnknownPhase), "UnknownPhase");
+  EXPECT_EQ(configParseStatusDescription(ConfigParseStatus::UnknownPhase), "Unknown phase");
 }
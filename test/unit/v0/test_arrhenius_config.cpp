@@ -16,30 +16,30 @@ TEST(ArrheniusConfig, DetectsInvalidConfig)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::RequiredKeyNotFound);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
 
     file = "./v0_unit_configs/arrhenius/missing_products/config" + extension;
     parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::RequiredKeyNotFound);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
 
     file = "./v0_unit_configs/arrhenius/mutually_exclusive/config" + extension;
     parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::MutuallyExclusiveOption);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::MutuallyExclusiveOption);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -119,12 +119,12 @@ TEST(ArrheniusConfig, DetectsNonstandardKeys)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 3);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::InvalidKey);
-    EXPECT_EQ(parsed.errors[1].first, ConfigParseStatus::InvalidKey);
-    EXPECT_EQ(parsed.errors[2].first, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[1].status, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[2].status, ConfigParseStatus::InvalidKey);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -139,10 +139,10 @@ TEST(ArrheniusConfig, DetectsNonstandardProductCoefficient)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::InvalidKey);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -157,10 +157,10 @@ TEST(ArrheniusConfig, DetectsNonstandardReactantCoefficient)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::InvalidKey);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
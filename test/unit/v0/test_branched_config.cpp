@@ -16,42 +16,42 @@ TEST(BranchedConfig, DetectsInvalidConfig)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 5);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[1].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[2].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[3].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[4].first, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[1].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[2].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[3].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[4].status, ConfigParseStatus::RequiredKeyNotFound);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
 
     file = "./v0_unit_configs/branched/missing_alkoxy_products/config" + extension;
     parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 5);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[1].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[2].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[3].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[4].first, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[1].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[2].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[3].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[4].status, ConfigParseStatus::RequiredKeyNotFound);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
 
     file = "./v0_unit_configs/branched/missing_nitrate_products/config" + extension;
     parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 5);
-    EXPECT_EQ(parsed.errors[1].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[2].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[3].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[4].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[1].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[2].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[3].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[4].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::RequiredKeyNotFound);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -121,11 +121,11 @@ TEST(BranchedConfig, DetectsNonstandardKeys)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 2);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::InvalidKey);
-    EXPECT_EQ(parsed.errors[1].first, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[1].status, ConfigParseStatus::InvalidKey);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -140,20 +140,20 @@ TEST(BranchedConfig, DetectsNonstandardProductCoefficient)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::InvalidKey);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
 
     file = "./v0_unit_configs/branched/nonstandard_nitrate_product_coef/config" + extension;
     parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::InvalidKey);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -168,10 +168,10 @@ TEST(BranchedConfig, DetectsNonstandardReactantCoefficient)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::InvalidKey);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
\ No newline at end of file
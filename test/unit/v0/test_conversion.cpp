@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <mechanism_configuration/v0/conversion.hpp>
+#include <mechanism_configuration/v0/parser.hpp>
+#include <mechanism_configuration/v1/parser.hpp>
+#include <mechanism_configuration/v1/serializer.hpp>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  v1::types::Mechanism ConvertValidConfig(const std::string& type)
+  {
+    v0::Parser parser;
+    auto parsed = parser.Parse("./v0_unit_configs/" + type + "/valid/config.yaml");
+    EXPECT_TRUE(parsed);
+    return v0::ConvertToV1(*parsed.mechanism);
+  }
+}  // namespace
+
+TEST(Conversion, ParserKeepsGasPhase)
+{
+  v0::Parser parser;
+  auto parsed = parser.Parse("./v0_unit_configs/arrhenius/valid/config.yaml");
+  ASSERT_TRUE(parsed);
+  ASSERT_EQ(parsed.mechanism->phases.size(), 1);
+  EXPECT_EQ(parsed.mechanism->phases[0].name, "GAS");
+  EXPECT_EQ(parsed.mechanism->phases[0].species.size(), parsed.mechanism->species.size());
+}
+
+TEST(Conversion, ConvertedConfigsParseAsVersion1)
+{
+  std::vector<std::string> types = { "arrhenius", "branched",  "emission", "first_order_loss", "photolysis", "species",
+                                     "surface",   "ternary_chemical_activation", "troe", "tunneling", "user_defined" };
+  auto directory = std::filesystem::temp_directory_path() / "mechanism_configuration_conversion";
+  std::filesystem::create_directories(directory);
+  for (const auto& type : types)
+  {
+    auto converted = ConvertValidConfig(type);
+    auto path = directory / (type + ".yaml");
+    v1::WriteMechanism(converted, path);
+
+    v1::Parser parser;
+    auto parsed = parser.Parse(path);
+    EXPECT_TRUE(parsed) << type;
+    for (const auto& error : parsed.errors)
+    {
+      std::cout << error.to_string() << std::endl;
+    }
+  }
+  std::filesystem::remove_all(directory);
+}
+
+TEST(Conversion, MapsMusicaNames)
+{
+  auto mechanism = ConvertValidConfig("photolysis");
+  ASSERT_FALSE(mechanism.reactions.photolysis.empty());
+  EXPECT_EQ(mechanism.reactions.photolysis[0].name, "jfoo");
+  EXPECT_EQ(mechanism.reactions.photolysis[0].gas_phase, "GAS");
+  EXPECT_EQ(mechanism.reactions.photolysis[0].unknown_properties.count(v0::V0_TYPE_PROPERTY), 0);
+
+  mechanism = ConvertValidConfig("emission");
+  ASSERT_FALSE(mechanism.reactions.emission.empty());
+  EXPECT_EQ(mechanism.reactions.emission[0].name.find('.'), std::string::npos);
+
+  mechanism = ConvertValidConfig("first_order_loss");
+  ASSERT_FALSE(mechanism.reactions.first_order_loss.empty());
+  EXPECT_EQ(mechanism.reactions.first_order_loss[0].name.find('.'), std::string::npos);
+
+  mechanism = ConvertValidConfig("surface");
+  ASSERT_FALSE(mechanism.reactions.surface.empty());
+  for (const auto& surface : mechanism.reactions.surface)
+  {
+    bool has_phase = false;
+    for (const auto& phase : mechanism.phases)
+    {
+      has_phase = has_phase || phase.name == surface.aerosol_phase;
+    }
+    EXPECT_TRUE(has_phase) << surface.aerosol_phase;
+  }
+}
+
+TEST(Conversion, MarksTypesWithoutVersion1Counterpart)
+{
+  auto mechanism = ConvertValidConfig("ternary_chemical_activation");
+  ASSERT_FALSE(mechanism.reactions.troe.empty());
+  for (const auto& troe : mechanism.reactions.troe)
+  {
+    EXPECT_EQ(troe.unknown_properties.at(v0::V0_TYPE_PROPERTY), "TERNARY_CHEMICAL_ACTIVATION");
+  }
+
+  // one user-defined reaction has two reactants and becomes an Arrhenius reaction
+  mechanism = ConvertValidConfig("user_defined");
+  EXPECT_EQ(mechanism.reactions.photolysis.size() + mechanism.reactions.arrhenius.size(), 2);
+  EXPECT_EQ(mechanism.reactions.arrhenius.size(), 1);
+  for (const auto& photolysis : mechanism.reactions.photolysis)
+  {
+    EXPECT_EQ(photolysis.unknown_properties.at(v0::V0_TYPE_PROPERTY), "USER_DEFINED");
+  }
+  EXPECT_EQ(mechanism.reactions.arrhenius[0].name, "foo");
+  EXPECT_EQ(mechanism.reactions.arrhenius[0].A, 1.0);
+}
+
+TEST(Conversion, WarnsAboutChangedRates)
+{
+  v0::Parser parser;
+  std::vector<v0::ConversionWarning> warnings;
+
+  auto parsed = parser.Parse("./v0_unit_configs/ternary_chemical_activation/valid/config.yaml");
+  ASSERT_TRUE(parsed);
+  auto mechanism = v0::ConvertToV1(*parsed.mechanism, warnings);
+  EXPECT_EQ(warnings.size(), mechanism.reactions.troe.size());
+  for (const auto& warning : warnings)
+  {
+    EXPECT_EQ(warning.type, "TERNARY_CHEMICAL_ACTIVATION");
+    EXPECT_NE(warning.reaction.find(" -> "), std::string::npos);
+  }
+
+  // only the user-defined reaction that becomes ARRHENIUS loses its host-supplied rate
+  warnings.clear();
+  parsed = parser.Parse("./v0_unit_configs/user_defined/valid/config.yaml");
+  ASSERT_TRUE(parsed);
+  v0::ConvertToV1(*parsed.mechanism, warnings);
+  ASSERT_EQ(warnings.size(), 1);
+  EXPECT_EQ(warnings[0].type, "USER_DEFINED");
+  EXPECT_EQ(warnings[0].to_string().rfind("warning: USER_DEFINED ", 0), 0);
+
+  // a photolysis reaction with two reactants has no valid version 1 photolysis counterpart either
+  v0::types::Mechanism photolysis;
+  v0::types::UserDefined two_reactants;
+  two_reactants.name = "PHOTO.two";
+  two_reactants.scaling_factor = 2.0;
+  two_reactants.reactants = { { "A" }, { "B" } };
+  two_reactants.products = { { "C" } };
+  photolysis.reactions.user_defined.push_back(two_reactants);
+  warnings.clear();
+  auto converted = v0::ConvertToV1(photolysis, warnings);
+  EXPECT_TRUE(converted.reactions.photolysis.empty());
+  ASSERT_EQ(converted.reactions.arrhenius.size(), 1);
+  EXPECT_EQ(converted.reactions.arrhenius[0].name, "two");
+  EXPECT_EQ(converted.reactions.arrhenius[0].A, 2.0);
+  ASSERT_EQ(warnings.size(), 1);
+  EXPECT_EQ(warnings[0].reaction, "PHOTO.two");
+
+  warnings.clear();
+  parsed = parser.Parse("./v0_unit_configs/arrhenius/valid/config.yaml");
+  ASSERT_TRUE(parsed);
+  v0::ConvertToV1(*parsed.mechanism, warnings);
+  EXPECT_TRUE(warnings.empty());
+}
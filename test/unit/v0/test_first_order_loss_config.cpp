@@ -15,20 +15,20 @@ TEST(FirstOrderLossConfig, DetectsInvalidConfig)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::RequiredKeyNotFound);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
 
     file = "./v0_unit_configs/first_order_loss/missing_MUSICA_name/config" + extension;
     parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::RequiredKeyNotFound);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -78,10 +78,10 @@ TEST(FirstOrderLossConfig, DetectsNonstandardKeys)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::InvalidKey);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
\ No newline at end of file
@@ -15,30 +15,30 @@ TEST(PhotolysisConfig, DetectsInvalidConfig)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::RequiredKeyNotFound);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
 
     file = "./v0_unit_configs/photolysis/missing_products/config" + extension;
     parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::RequiredKeyNotFound);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
 
     file = "./v0_unit_configs/photolysis/missing_MUSICA_name/config" + extension;
     parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::RequiredKeyNotFound);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -96,10 +96,10 @@ TEST(PhotolysisConfig, DetectsNonstandardKeys)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::InvalidKey);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -114,10 +114,10 @@ TEST(PhotolysisConfig, DetectsNonstandardProductCoefficient)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::InvalidKey);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -132,10 +132,10 @@ TEST(PhotolysisConfig, DetectsNonstandardReactantCoefficient)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::InvalidKey);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
\ No newline at end of file
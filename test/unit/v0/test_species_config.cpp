@@ -19,7 +19,7 @@ TEST(SpeciesConfig, ValidSpeciesConfig)
     {
       for (auto& error : parsed.errors)
       {
-        std::cerr << error.second << std::endl;
+        std::cerr << error.to_string() << std::endl;
       }
     }
     v0::types::Mechanism mechanism = *parsed;
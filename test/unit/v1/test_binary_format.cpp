@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/binary_format.hpp>
+#include <mechanism_configuration/v1/parser.hpp>
+
+#include "test_mechanisms.hpp"
+
+#include <stdexcept>
+
+using namespace mechanism_configuration;
+using namespace test_mechanisms;
+
+TEST(BinaryFormat, RoundTripsAMechanism)
+{
+  auto mechanism = FullConfiguration();
+  auto bytes = v1::WriteBinary(mechanism);
+  auto read = v1::ReadBinary(bytes);
+
+  EXPECT_EQ(read.name, mechanism.name);
+  EXPECT_EQ(read.version.to_string(), mechanism.version.to_string());
+  ASSERT_EQ(read.species.size(), mechanism.species.size());
+  for (std::size_t i = 0; i < read.species.size(); ++i)
+  {
+    EXPECT_EQ(read.species[i].name, mechanism.species[i].name);
+    EXPECT_EQ(read.species[i].molecular_weight, mechanism.species[i].molecular_weight);
+    EXPECT_EQ(read.species[i].unknown_properties, mechanism.species[i].unknown_properties);
+  }
+  ASSERT_EQ(read.reactions.arrhenius.size(), mechanism.reactions.arrhenius.size());
+  EXPECT_EQ(read.reactions.arrhenius[0].A, mechanism.reactions.arrhenius[0].A);
+  EXPECT_EQ(read.reactions.arrhenius[0].reactants.size(), mechanism.reactions.arrhenius[0].reactants.size());
+  EXPECT_EQ(read.reactions.simpol_phase_transfer[0].B, mechanism.reactions.simpol_phase_transfer[0].B);
+  EXPECT_EQ(read.reactions.branched[0].n, mechanism.reactions.branched[0].n);
+
+  // every field is written, so writing the read mechanism again gives the same bytes
+  EXPECT_EQ(v1::WriteBinary(read), bytes);
+}
+
+TEST(BinaryFormat, RejectsInvalidData)
+{
+  auto bytes = v1::WriteBinary(FullConfiguration());
+
+  auto truncated = std::span<const std::byte>(bytes).first(bytes.size() - 1);
+  EXPECT_THROW(v1::ReadBinary(truncated), std::invalid_argument);
+
+  auto trailing = bytes;
+  trailing.push_back(std::byte{ 0 });
+  EXPECT_THROW(v1::ReadBinary(trailing), std::invalid_argument);
+
+  auto wrong_magic = bytes;
+  wrong_magic[0] = std::byte{ 0 };
+  EXPECT_THROW(v1::ReadBinary(wrong_magic), std::invalid_argument);
+
+  EXPECT_THROW(v1::ReadBinary({}), std::invalid_argument);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/diff.hpp>
+#include <mechanism_configuration/v1/parser.hpp>
+
+#include "test_mechanisms.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+using namespace mechanism_configuration;
+using namespace test_mechanisms;
+
+namespace
+{
+  v1::types::Arrhenius Unnamed(const std::string& reactant, const std::string& product, double A)
+  {
+    auto arrhenius = Arrhenius(std::vector<std::string>{ reactant }, std::vector<std::string>{ product });
+    arrhenius.A = A;
+    return arrhenius;
+  }
+}  // namespace
+
+TEST(Diff, IdenticalMechanismsHaveNoChanges)
+{
+  auto mechanism = FullConfiguration();
+  auto diff = v1::Diff(mechanism, mechanism);
+  EXPECT_TRUE(diff.Empty());
+}
+
+TEST(Diff, IgnoresOrdering)
+{
+  auto before = FullConfiguration();
+  auto after = before;
+  std::reverse(after.species.begin(), after.species.end());
+  std::reverse(after.phases.begin(), after.phases.end());
+  v1::types::ForEachReactionList(after.reactions, [](v1::types::ReactionType, auto& list) { std::reverse(list.begin(), list.end()); });
+  for (auto& phase : after.phases)
+  {
+    std::reverse(phase.species.begin(), phase.species.end());
+  }
+  EXPECT_TRUE(v1::Diff(before, after).Empty());
+}
+
+TEST(Diff, FindsSpeciesAndPhaseChanges)
+{
+  auto before = FullConfiguration();
+  auto after = before;
+  v1::types::Species added;
+  added.name = "NEW";
+  after.species.push_back(added);
+  after.species.erase(after.species.begin());
+  after.species[0].molecular_weight = 1.234;
+
+  // move ethanol from the gas phase to the cloud
+  auto& gas = after.phases[0];
+  gas.species.erase(std::find(gas.species.begin(), gas.species.end(), "ethanol"));
+  after.phases[3].species.push_back("ethanol");
+
+  auto diff = v1::Diff(before, after);
+  ASSERT_EQ(diff.species.size(), 3);
+  EXPECT_EQ(diff.species[0].kind, v1::ChangeKind::Modified);
+  EXPECT_EQ(diff.species[0].properties, std::vector<std::string>{ "molecular weight [kg mol-1]" });
+  EXPECT_EQ(diff.species[1].name, "NEW");
+  EXPECT_EQ(diff.species[1].kind, v1::ChangeKind::Added);
+  EXPECT_EQ(diff.species[2].name, before.species[0].name);
+  EXPECT_EQ(diff.species[2].kind, v1::ChangeKind::Removed);
+
+  ASSERT_EQ(diff.phases.size(), 2);
+  EXPECT_EQ(diff.phases[0].removed_species, std::vector<std::string>{ "ethanol" });
+  EXPECT_EQ(diff.phases[1].added_species, std::vector<std::string>{ "ethanol" });
+  ASSERT_EQ(diff.moves.size(), 1);
+  EXPECT_EQ(diff.moves[0].species, "ethanol");
+  EXPECT_EQ(diff.moves[0].removed_from, std::vector<std::string>{ "gas" });
+  EXPECT_EQ(diff.moves[0].added_to, std::vector<std::string>{ "cloud" });
+}
+
+TEST(Diff, MatchesReactionsByNameOrStructure)
+{
+  v1::types::Mechanism before;
+  before.reactions.arrhenius = { Unnamed("A", "B", 1.0), Unnamed("B", "C", 2.0), Unnamed("C", "D", 3.0) };
+  before.reactions.arrhenius[0].name = "first";
+
+  auto after = before;
+  // renamed reactions still match by name, even with new species
+  after.reactions.arrhenius[0].products[0].species_name = "E";
+  // unnamed reactions match by structure and report parameter changes
+  after.reactions.arrhenius[1].A = 4.0;
+  after.reactions.arrhenius[1].products[0].coefficient = 2.0;
+  // a reaction with different species is removed and added
+  after.reactions.arrhenius[2].reactants[0].species_name = "F";
+
+  auto diff = v1::Diff(before, after);
+  ASSERT_EQ(diff.reactions.size(), 4);
+  EXPECT_EQ(diff.reactions[0].kind, v1::ChangeKind::Modified);
+  EXPECT_EQ(diff.reactions[0].description, "first");
+  EXPECT_EQ(diff.reactions[0].fields, std::vector<std::string>{ "products" });
+
+  EXPECT_EQ(diff.reactions[1].kind, v1::ChangeKind::Modified);
+  EXPECT_EQ(diff.reactions[1].description, "B -> 2 C");
+  EXPECT_EQ(diff.reactions[1].before_index, 1);
+  ASSERT_EQ(diff.reactions[1].parameters.size(), 1);
+  EXPECT_EQ(diff.reactions[1].parameters[0].name, "A");
+  EXPECT_EQ(diff.reactions[1].parameters[0].before, 2.0);
+  EXPECT_EQ(diff.reactions[1].parameters[0].after, 4.0);
+  EXPECT_EQ(diff.reactions[1].fields, std::vector<std::string>{ "products" });
+
+  EXPECT_EQ(diff.reactions[2].kind, v1::ChangeKind::Added);
+  EXPECT_EQ(diff.reactions[2].description, "F -> D");
+  EXPECT_EQ(diff.reactions[3].kind, v1::ChangeKind::Removed);
+  EXPECT_EQ(diff.reactions[3].description, "C -> D");
+
+  std::stringstream report;
+  v1::WriteReport(diff, report);
+  EXPECT_EQ(
+      report.str(),
+      "~ ARRHENIUS first: products\n"
+      "~ ARRHENIUS B -> 2 C: A 2 -> 4, products\n"
+      "+ ARRHENIUS F -> D\n"
+      "- ARRHENIUS C -> D\n");
+}
+
+TEST(Diff, PairsDuplicateReactionsOneToOne)
+{
+  v1::types::Mechanism before;
+  before.reactions.arrhenius = { Unnamed("A", "B", 1.0), Unnamed("A", "B", 1.0) };
+  auto after = before;
+  after.reactions.arrhenius.push_back(Unnamed("A", "B", 1.0));
+
+  auto diff = v1::Diff(before, after);
+  ASSERT_EQ(diff.reactions.size(), 1);
+  EXPECT_EQ(diff.reactions[0].kind, v1::ChangeKind::Added);
+  EXPECT_EQ(diff.reactions[0].after_index, 2);
+}
+
+TEST(Diff, TreatsSignedZerosAsEqual)
+{
+  v1::types::Mechanism before;
+  before.reactions.arrhenius = { Unnamed("A", "B", 1.0), Unnamed("A", "B", 2.0) };
+  auto after = before;
+  std::reverse(after.reactions.arrhenius.begin(), after.reactions.arrhenius.end());
+  for (auto& arrhenius : after.reactions.arrhenius)
+  {
+    arrhenius.C = -0.0;
+  }
+
+  // each reaction is still identical to its counterpart, so none are paired by structure alone
+  EXPECT_TRUE(v1::Diff(before, after).Empty());
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/ensemble.hpp>
+#include <mechanism_configuration/v1/rate_constants.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  std::shared_ptr<const v1::types::Mechanism> EnsembleMechanism()
+  {
+    auto mechanism = std::make_shared<v1::types::Mechanism>();
+
+    v1::types::Arrhenius arrhenius;
+    arrhenius.A = 2.0e-12;
+    arrhenius.C = -250.0;
+    mechanism->reactions.arrhenius.push_back(arrhenius);
+
+    v1::types::Branched branched;
+    branched.X = 1.2e-4;
+    branched.Y = 167.0;
+    branched.a0 = 0.15;
+    branched.n = 9;
+    mechanism->reactions.branched.push_back(branched);
+
+    v1::types::Photolysis photolysis;
+    photolysis.scaling_factor = 2.0;
+    mechanism->reactions.photolysis.push_back(photolysis);
+
+    v1::types::Troe troe;
+    troe.k0_A = 1.2e-12;
+    troe.k0_B = -1.8;
+    troe.kinf_A = 1.0e-10;
+    mechanism->reactions.troe.push_back(troe);
+    return mechanism;
+  }
+
+  /// @brief Checks the ensemble's rate constants against those of each materialized member
+  void ExpectMembersMatch(const v1::Ensemble& ensemble, const v1::Conditions& conditions, const std::vector<double>& external)
+  {
+    const std::size_t members = ensemble.NumberOfMembers();
+    std::vector<double> k(ensemble.Size() * members);
+    ensemble.Calculate(conditions, external, k);
+    for (std::size_t m = 0; m < members; ++m)
+    {
+      v1::RateConstants rates(ensemble.Materialize(m));
+      std::vector<double> expected(rates.Size());
+      rates.Calculate(conditions, external, expected);
+      for (std::size_t i = 0; i < expected.size(); ++i)
+      {
+        EXPECT_DOUBLE_EQ(k[i * members + m], expected[i]) << "member " << m << ", rate constant " << i;
+      }
+    }
+  }
+}  // namespace
+
+TEST(Ensemble, NumbersTheRateParametersInLayoutOrder)
+{
+  v1::Ensemble ensemble(EnsembleMechanism());
+  // Arrhenius A-E, branched X, Y, a0, n, the photolysis scaling factor and the eight Troe parameters
+  ASSERT_EQ(ensemble.NumberOfParameters(), 18);
+  EXPECT_EQ(ensemble.Size(), 5);
+
+  auto A = ensemble.FindParameter({ v1::types::ReactionType::Arrhenius, 0 }, "A");
+  ASSERT_TRUE(A.has_value());
+  EXPECT_EQ(*A, 0);
+  EXPECT_EQ(ensemble.Parameters()[*A].value, 2.0e-12);
+  EXPECT_EQ(ensemble.FindParameter({ v1::types::ReactionType::Branched, 0 }, "n"), 8);
+  EXPECT_EQ(ensemble.FindParameter({ v1::types::ReactionType::Photolysis, 0 }, "scaling factor"), 9);
+  EXPECT_EQ(ensemble.FindParameter({ v1::types::ReactionType::Troe, 0 }, "Fc"), 16);
+  EXPECT_FALSE(ensemble.FindParameter({ v1::types::ReactionType::Troe, 0 }, "A").has_value());
+  EXPECT_FALSE(ensemble.FindParameter({ v1::types::ReactionType::Troe, 1 }, "Fc").has_value());
+}
+
+TEST(Ensemble, StoresOnlyTheParametersAMemberChanges)
+{
+  v1::Ensemble ensemble(EnsembleMechanism(), 2);
+  const std::size_t Fc = *ensemble.FindParameter({ v1::types::ReactionType::Troe, 0 }, "Fc");
+  const std::size_t A = *ensemble.FindParameter({ v1::types::ReactionType::Arrhenius, 0 }, "A");
+
+  ensemble.Set(1, Fc, 0.45);
+  ensemble.Set(1, A, 3.0e-12);
+  ASSERT_EQ(ensemble.Overrides(1).size(), 2);
+  EXPECT_EQ(ensemble.Overrides(1)[0].parameter, A);
+  EXPECT_EQ(ensemble.Overrides(1)[1].parameter, Fc);
+  EXPECT_TRUE(ensemble.Overrides(0).empty());
+  EXPECT_EQ(ensemble.Get(0, Fc), 0.6);
+  EXPECT_EQ(ensemble.Get(1, Fc), 0.45);
+
+  // Setting the shared value removes the override
+  ensemble.Set(1, A, 2.0e-12);
+  ASSERT_EQ(ensemble.Overrides(1).size(), 1);
+
+  const std::size_t copy = ensemble.CopyMember(1);
+  EXPECT_EQ(copy, 2);
+  EXPECT_EQ(ensemble.Get(copy, Fc), 0.45);
+  EXPECT_EQ(ensemble.Materialize(copy).reactions.troe[0].Fc, 0.45);
+  EXPECT_EQ(ensemble.Mechanism().reactions.troe[0].Fc, 0.6);
+
+  // Copies of an ensemble share the mechanism
+  v1::Ensemble other = ensemble;
+  EXPECT_EQ(&other.Mechanism(), &ensemble.Mechanism());
+  other.Set(0, Fc, 0.3);
+  EXPECT_EQ(ensemble.Get(0, Fc), 0.6);
+}
+
+TEST(Ensemble, EvaluatesEveryMemberInOnePass)
+{
+  v1::Ensemble ensemble(EnsembleMechanism());
+  const std::size_t base = ensemble.AddMember();
+  const std::size_t fc = ensemble.AddMember();
+  ensemble.Set(fc, *ensemble.FindParameter({ v1::types::ReactionType::Troe, 0 }, "Fc"), 0.45);
+  const std::size_t several = ensemble.AddMember();
+  ensemble.Set(several, *ensemble.FindParameter({ v1::types::ReactionType::Arrhenius, 0 }, "C"), -300.0);
+  ensemble.Set(several, *ensemble.FindParameter({ v1::types::ReactionType::Branched, 0 }, "a0"), 0.2);
+  ensemble.Set(several, *ensemble.FindParameter({ v1::types::ReactionType::Photolysis, 0 }, "scaling factor"), 0.5);
+  EXPECT_EQ(base, 0);
+
+  std::vector<double> external = { 4.0e-3 };
+  ExpectMembersMatch(ensemble, v1::Conditions{ 272.5, 101253.3, 42.2 }, external);
+
+  std::vector<double> k(ensemble.Size() * ensemble.NumberOfMembers());
+  ensemble.Calculate(v1::Conditions{}, external, k);
+  const std::size_t members = ensemble.NumberOfMembers();
+  EXPECT_EQ(k[0 * members + base], k[0 * members + fc]);
+  EXPECT_NE(k[4 * members + base], k[4 * members + fc]);
+  EXPECT_DOUBLE_EQ(k[3 * members + several], 0.5 * 4.0e-3);
+}
+
+TEST(Ensemble, RejectsBadArguments)
+{
+  EXPECT_THROW(v1::Ensemble(nullptr), std::invalid_argument);
+
+  v1::Ensemble ensemble(EnsembleMechanism(), 1);
+  EXPECT_THROW(ensemble.Set(1, 0, 1.0), std::invalid_argument);
+  EXPECT_THROW(ensemble.Set(0, ensemble.NumberOfParameters(), 1.0), std::invalid_argument);
+  EXPECT_THROW(ensemble.Get(0, ensemble.NumberOfParameters()), std::invalid_argument);
+  EXPECT_THROW(ensemble.CopyMember(1), std::invalid_argument);
+  EXPECT_THROW(ensemble.Overrides(1), std::invalid_argument);
+
+  std::vector<double> external = { 1.0 };
+  std::vector<double> k(ensemble.Size() + 1);
+  EXPECT_THROW(ensemble.Calculate(v1::Conditions{}, external, k), std::invalid_argument);
+  k.pop_back();
+  external.clear();
+  EXPECT_THROW(ensemble.Calculate(v1::Conditions{}, external, k), std::invalid_argument);
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/external_rates.hpp>
+#include <mechanism_configuration/v1/rate_constants.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  v1::types::Mechanism ExternalRateMechanism()
+  {
+    v1::types::Mechanism mechanism;
+
+    v1::types::Arrhenius arrhenius;
+    arrhenius.A = 4.0e-13;
+    mechanism.reactions.arrhenius.push_back(arrhenius);
+
+    v1::types::Emission emission;
+    emission.name = "NO";
+    mechanism.reactions.emission.push_back(emission);
+
+    v1::types::FirstOrderLoss loss;
+    loss.name = "NO";
+    loss.scaling_factor = 0.5;
+    mechanism.reactions.first_order_loss.push_back(loss);
+
+    // Two photolysis reactions with the same name
+    v1::types::Photolysis photolysis;
+    photolysis.name = "jNO2";
+    mechanism.reactions.photolysis.push_back(photolysis);
+    photolysis.scaling_factor = 2.0;
+    mechanism.reactions.photolysis.push_back(photolysis);
+    return mechanism;
+  }
+}  // namespace
+
+TEST(ExternalRateRegistry, NumbersRatesAsTheRateConstantLayout)
+{
+  auto mechanism = ExternalRateMechanism();
+  v1::ExternalRateRegistry registry(mechanism);
+  auto layout = v1::RateConstantLayout(mechanism);
+  ASSERT_EQ(registry.Size(), 4);
+  for (std::size_t i = 0; i < registry.Size(); ++i)
+  {
+    EXPECT_EQ(layout[registry[i].rate_constant].external, i);
+  }
+  EXPECT_EQ(registry[0].key, "EMIS.NO");
+  EXPECT_EQ(registry[1].key, "LOSS.NO");
+  EXPECT_EQ(registry[2].key, "PHOTO.jNO2");
+  EXPECT_EQ(registry[3].key, "PHOTO.jNO2#2");
+  EXPECT_EQ(registry[3].name, "jNO2");
+  EXPECT_EQ(registry[3].reaction.type, v1::types::ReactionType::Photolysis);
+  EXPECT_EQ(registry[3].reaction.index, 1);
+}
+
+TEST(ExternalRateRegistry, FindsRatesByKeyAndName)
+{
+  v1::ExternalRateRegistry registry(ExternalRateMechanism());
+  EXPECT_EQ(registry.Find("LOSS.NO"), 1);
+  EXPECT_EQ(registry.Find("PHOTO.jNO2#2"), 3);
+  EXPECT_FALSE(registry.Find("NO").has_value());
+  EXPECT_EQ(registry.FindByName("NO"), (std::vector<std::size_t>{ 0, 1 }));
+  EXPECT_EQ(registry.FindByName("jNO2"), (std::vector<std::size_t>{ 2, 3 }));
+  EXPECT_TRUE(registry.FindByName("jO3").empty());
+}
+
+TEST(ExternalRateRegistry, FillsRowsOfTheParameterArray)
+{
+  auto mechanism = ExternalRateMechanism();
+  v1::ExternalRateRegistry registry(mechanism);
+  v1::RateConstants rates(mechanism);
+  const std::size_t cells = 3;
+
+  std::vector<double> parameters(registry.Size() * cells, 0.0);
+  const std::vector<double> photolysis = { 1.0e-3, 2.0e-3, 3.0e-3 };
+  auto row = registry.Row(parameters, *registry.Find("PHOTO.jNO2#2"), cells);
+  std::copy(photolysis.begin(), photolysis.end(), row.begin());
+  std::fill_n(registry.Row(parameters, *registry.Find("LOSS.NO"), cells).begin(), cells, 4.0);
+
+  std::vector<v1::Conditions> conditions(cells);
+  conditions[1].temperature = 250.0;
+  std::vector<double> k(rates.Size() * cells);
+  rates.Calculate(conditions, parameters, k, cells);
+
+  // Each cell matches the single-cell evaluation
+  for (std::size_t cell = 0; cell < cells; ++cell)
+  {
+    std::vector<double> external(registry.Size());
+    for (std::size_t i = 0; i < registry.Size(); ++i)
+    {
+      external[i] = parameters[i * cells + cell];
+    }
+    std::vector<double> expected(rates.Size());
+    rates.Calculate(conditions[cell], external, expected);
+    for (std::size_t i = 0; i < rates.Size(); ++i)
+    {
+      EXPECT_DOUBLE_EQ(k[i * cells + cell], expected[i]);
+    }
+  }
+  EXPECT_DOUBLE_EQ(k[registry[3].rate_constant * cells + 2], 2.0 * 3.0e-3);
+  EXPECT_DOUBLE_EQ(k[registry[1].rate_constant * cells + 0], 0.5 * 4.0);
+}
+
+TEST(ExternalRateRegistry, RejectsMismatchedArrays)
+{
+  auto mechanism = ExternalRateMechanism();
+  v1::ExternalRateRegistry registry(mechanism);
+  v1::RateConstants rates(mechanism);
+  std::vector<double> parameters(registry.Size() * 2);
+  EXPECT_THROW(registry.Row(parameters, 0, 3), std::invalid_argument);
+  EXPECT_THROW(registry.Row(parameters, registry.Size(), 2), std::invalid_argument);
+
+  std::vector<v1::Conditions> conditions(2);
+  std::vector<double> k(rates.Size() * 2);
+  EXPECT_THROW(rates.Calculate(conditions, parameters, k, 3), std::invalid_argument);
+  parameters.pop_back();
+  EXPECT_THROW(rates.Calculate(conditions, parameters, k, 2), std::invalid_argument);
+}
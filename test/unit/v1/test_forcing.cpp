@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/forcing.hpp>
+
+#include "test_mechanisms.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace mechanism_configuration;
+using namespace test_mechanisms;
+
+TEST(Forcing, ComputesMassActionTendenciesForOneCell)
+{
+  auto mechanism = ForcingMechanism();
+  v1::Forcing forcing(mechanism);
+  ASSERT_EQ(forcing.NumberOfSpecies(), 4);
+  ASSERT_EQ(forcing.NumberOfProcesses(), 7);
+
+  // Processes: dimerization, recycling, nitrate, alkoxy, emission, first-order loss, photolysis
+  std::vector<double> k = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0 };
+  std::vector<double> y = { 0.5, 0.25, 2.0, 3.0 };
+  std::vector<double> f(4);
+  forcing.Calculate(k, y, f, 1);
+
+  const double r[] = { 1.0 * 0.5 * 0.5, 2.0 * 0.5 * 0.25, 3.0 * 2.0, 4.0 * 2.0, 5.0, 6.0 * 3.0, 7.0 * std::sqrt(0.25) };
+  EXPECT_DOUBLE_EQ(f[0], -2.0 * r[0] - 0.5 * r[1] + r[3]);
+  EXPECT_DOUBLE_EQ(f[1], r[0] - r[1] - 0.5 * r[6]);
+  EXPECT_DOUBLE_EQ(f[2], r[1] - r[2] - r[3] + 2.0 * r[6]);
+  EXPECT_DOUBLE_EQ(f[3], r[2] + r[4] - r[5]);
+}
+
+TEST(Forcing, MatchesTheScalarReferenceOverManyCells)
+{
+  auto mechanism = ForcingMechanism();
+  v1::Forcing forcing(mechanism);
+
+  // Not a multiple of the block size, so the last block is partial
+  const std::size_t cells = 3 * v1::Forcing::block_size + 17;
+  std::vector<double> k(forcing.NumberOfProcesses() * cells);
+  std::vector<double> y(forcing.NumberOfSpecies() * cells);
+  for (std::size_t i = 0; i < k.size(); ++i)
+    k[i] = 1.0 + 0.001 * static_cast<double>(i % 97);
+  for (std::size_t i = 0; i < y.size(); ++i)
+    y[i] = 0.1 + 0.01 * static_cast<double>(i % 89);
+
+  std::vector<double> expected(y.size());
+  std::vector<double> actual(y.size(), 123.0);
+  v1::ReferenceForcing(mechanism, k, y, expected, cells);
+  forcing.Calculate(k, y, actual, cells);
+  for (std::size_t i = 0; i < expected.size(); ++i)
+  {
+    EXPECT_NEAR(actual[i], expected[i], 1.0e-13 * std::max(1.0, std::abs(expected[i]))) << "element " << i;
+  }
+}
+
+TEST(Forcing, HandlesNoCells)
+{
+  v1::Forcing forcing(ForcingMechanism());
+  std::vector<double> empty;
+  EXPECT_NO_THROW(forcing.Calculate(empty, empty, std::span<double>(empty), 0));
+}
+
+TEST(Forcing, RejectsMismatchedArrays)
+{
+  v1::Forcing forcing(ForcingMechanism());
+  std::vector<double> k(forcing.NumberOfProcesses() * 2);
+  std::vector<double> y(forcing.NumberOfSpecies() * 2);
+  std::vector<double> f(forcing.NumberOfSpecies() * 3);
+  EXPECT_THROW(forcing.Calculate(k, y, f, 2), std::invalid_argument);
+}
+
+TEST(Forcing, RejectsUnknownSpecies)
+{
+  auto mechanism = ForcingMechanism();
+  mechanism.reactions.arrhenius[0].products = { Component("E") };
+  EXPECT_THROW(v1::Forcing forcing(mechanism), std::invalid_argument);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/incremental_parser.hpp>
+#include <mechanism_configuration/v1/parser.hpp>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  YAML::Node FindReaction(YAML::Node reactions, const std::string& type)
+  {
+    for (auto reaction : reactions)
+    {
+      if (reaction["type"].as<std::string>() == type)
+      {
+        return reaction;
+      }
+    }
+    return YAML::Node();
+  }
+}  // namespace
+
+TEST(IncrementalParser, MatchesFullParse)
+{
+  v1::Parser parser;
+  v1::IncrementalParser incremental;
+  std::vector<std::string> extensions = { ".json", ".yaml" };
+  for (auto& extension : extensions)
+  {
+    std::string path = "examples/v1/full_configuration" + extension;
+    auto expected = parser.Parse(path);
+    auto parsed = incremental.Parse(path);
+    EXPECT_TRUE(expected);
+    EXPECT_TRUE(parsed);
+
+    EXPECT_EQ(parsed.mechanism->name, expected.mechanism->name);
+    EXPECT_EQ(parsed.mechanism->species.size(), expected.mechanism->species.size());
+    EXPECT_EQ(parsed.mechanism->phases.size(), expected.mechanism->phases.size());
+    EXPECT_EQ(parsed.mechanism->reactions.arrhenius.size(), expected.mechanism->reactions.arrhenius.size());
+    EXPECT_EQ(parsed.mechanism->reactions.condensed_phase_arrhenius.size(), expected.mechanism->reactions.condensed_phase_arrhenius.size());
+    EXPECT_EQ(parsed.mechanism->reactions.troe.size(), expected.mechanism->reactions.troe.size());
+    EXPECT_EQ(parsed.mechanism->reactions.henrys_law.size(), expected.mechanism->reactions.henrys_law.size());
+    EXPECT_EQ(parsed.mechanism->reactions.arrhenius[1].A, expected.mechanism->reactions.arrhenius[1].A);
+  }
+}
+
+TEST(IncrementalParser, ReusesUnchangedReactions)
+{
+  v1::IncrementalParser incremental;
+  YAML::Node object = YAML::LoadFile("examples/v1/full_configuration.yaml");
+  std::size_t n_reactions = object["reactions"].size();
+
+  auto parsed = incremental.Parse(object);
+  EXPECT_TRUE(parsed);
+  EXPECT_EQ(incremental.ReusedReactionCount(), 0);
+
+  parsed = incremental.Parse(object);
+  EXPECT_TRUE(parsed);
+  EXPECT_EQ(incremental.ReusedReactionCount(), n_reactions);
+
+  // changing one reaction only re-parses that reaction
+  YAML::Node edited = YAML::Clone(object);
+  FindReaction(edited["reactions"], "TROE")["k0_A"] = 42.0;
+  parsed = incremental.Parse(edited);
+  EXPECT_TRUE(parsed);
+  EXPECT_EQ(incremental.ReusedReactionCount(), n_reactions - 1);
+  EXPECT_EQ(parsed.mechanism->reactions.troe[0].k0_A, 42.0);
+
+  // changing the species invalidates every reaction
+  edited = YAML::Clone(edited);
+  edited["species"][0]["absolute tolerance"] = 1.0e-20;
+  parsed = incremental.Parse(edited);
+  EXPECT_TRUE(parsed);
+  EXPECT_EQ(incremental.ReusedReactionCount(), 0);
+}
+
+TEST(IncrementalParser, ReportsErrorsInChangedReactions)
+{
+  v1::IncrementalParser incremental;
+  YAML::Node object = YAML::LoadFile("examples/v1/full_configuration.yaml");
+  std::size_t n_reactions = object["reactions"].size();
+
+  auto parsed = incremental.Parse(object);
+  EXPECT_TRUE(parsed);
+
+  YAML::Node edited = YAML::Clone(object);
+  FindReaction(edited["reactions"], "ARRHENIUS")["gas phase"] = "not a phase";
+  for (int i = 0; i < 2; ++i)
+  {
+    parsed = incremental.Parse(edited);
+    EXPECT_FALSE(parsed);
+    EXPECT_EQ(parsed.errors.size(), 1);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::UnknownPhase);
+    EXPECT_EQ(incremental.ReusedReactionCount(), n_reactions - 1);
+  }
+}
+
+TEST(IncrementalParser, ReportsDuplicateReactions)
+{
+  v1::IncrementalParser incremental;
+  for (int i = 0; i < 2; ++i)
+  {
+    auto parsed = incremental.Parse("v1_unit_configs/reactions/arrhenius/duplicate_reaction.yaml");
+    EXPECT_FALSE(parsed);
+    ASSERT_EQ(parsed.errors.size(), 1);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::DuplicateReactionDetected);
+  }
+  // the duplicate is found again even though every reaction was reused
+  EXPECT_EQ(incremental.ReusedReactionCount(), 3);
+}
+
+TEST(IncrementalParser, CanonicalTextDistinguishesNodes)
+{
+  EXPECT_EQ(v1::CanonicalText(YAML::Load("{ a: 1, b: [x, y] }")), v1::CanonicalText(YAML::Load("{a: 1, b: [x,y]}")));
+  EXPECT_NE(v1::CanonicalText(YAML::Load("{ ab: c }")), v1::CanonicalText(YAML::Load("{ a: bc }")));
+  EXPECT_NE(v1::CanonicalText(YAML::Load("[a, b]")), v1::CanonicalText(YAML::Load("[ab]")));
+  EXPECT_NE(v1::CanonicalText(YAML::Load("[[a], b]")), v1::CanonicalText(YAML::Load("[[a, b]]")));
+  EXPECT_NE(v1::CanonicalText(YAML::Load("a")), v1::CanonicalText(YAML::Load("[a]")));
+  EXPECT_NE(v1::CanonicalText(YAML::Load("{ a: ~ }")), v1::CanonicalText(YAML::Load("{ a: '' }")));
+}
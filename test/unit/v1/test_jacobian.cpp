@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/forcing.hpp>
+#include <mechanism_configuration/v1/jacobian.hpp>
+
+#include "test_mechanisms.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace mechanism_configuration;
+using namespace test_mechanisms;
+
+TEST(Jacobian, BuildsTheSparsityPattern)
+{
+  v1::Jacobian jacobian(JacobianMechanism());
+  ASSERT_EQ(jacobian.NumberOfSpecies(), 5);
+  // The branched reaction has one process per branch
+  ASSERT_EQ(jacobian.NumberOfProcesses(), 6);
+
+  // Every diagonal element is present, including E, which takes part in no reaction
+  for (std::size_t i = 0; i < 5; ++i)
+  {
+    EXPECT_TRUE(jacobian.NonZeroIndex(i, i).has_value()) << i;
+  }
+  // dA/dB through photolysis, dD/dC through the catalysed reaction, dC/dD through the nitrate branch
+  EXPECT_TRUE(jacobian.NonZeroIndex(0, 1).has_value());
+  EXPECT_TRUE(jacobian.NonZeroIndex(3, 2).has_value());
+  EXPECT_TRUE(jacobian.NonZeroIndex(2, 3).has_value());
+  // C is unchanged by the reaction it catalyses, so its rate of change does not depend on A; E is inert
+  EXPECT_FALSE(jacobian.NonZeroIndex(2, 0).has_value());
+  EXPECT_FALSE(jacobian.NonZeroIndex(4, 0).has_value());
+  EXPECT_FALSE(jacobian.NonZeroIndex(0, 4).has_value());
+
+  const auto& rows = jacobian.RowOffsets();
+  const auto& columns = jacobian.Columns();
+  ASSERT_EQ(rows.size(), 6);
+  EXPECT_EQ(rows.back(), jacobian.NumberOfNonZeros());
+  for (std::size_t i = 0; i < 5; ++i)
+  {
+    EXPECT_TRUE(std::is_sorted(columns.begin() + rows[i], columns.begin() + rows[i + 1]));
+  }
+}
+
+TEST(Jacobian, MatchesFiniteDifferencesOfTheForcing)
+{
+  // Both kernels are built from the same mass-action processes, as a solver would build them
+  const v1::MassActionProcesses processes(JacobianMechanism());
+  v1::Forcing forcing(processes);
+  v1::Jacobian jacobian(processes);
+  const std::size_t species = forcing.NumberOfSpecies();
+
+  // Spans more than one block of cells
+  const std::size_t cells = v1::Jacobian::block_size + 3;
+  std::vector<double> k(forcing.NumberOfProcesses() * cells);
+  std::vector<double> y(species * cells);
+  for (std::size_t i = 0; i < k.size(); ++i)
+    k[i] = 0.5 + 0.01 * static_cast<double>(i % 37);
+  for (std::size_t i = 0; i < y.size(); ++i)
+    y[i] = 0.2 + 0.05 * static_cast<double>(i % 23);
+
+  std::vector<double> values(jacobian.NumberOfNonZeros() * cells);
+  jacobian.Calculate(k, y, values, cells);
+
+  std::vector<double> plus(y.size());
+  std::vector<double> minus(y.size());
+  for (std::size_t j = 0; j < species; ++j)
+  {
+    // Perturb species j in every cell at once; cells are independent
+    std::vector<double> y_plus = y;
+    std::vector<double> y_minus = y;
+    std::vector<double> h(cells);
+    for (std::size_t c = 0; c < cells; ++c)
+    {
+      h[c] = 1.0e-6 * y[j * cells + c];
+      y_plus[j * cells + c] += h[c];
+      y_minus[j * cells + c] -= h[c];
+    }
+    forcing.Calculate(k, y_plus, plus, cells);
+    forcing.Calculate(k, y_minus, minus, cells);
+    for (std::size_t i = 0; i < species; ++i)
+    {
+      auto element = jacobian.NonZeroIndex(i, j);
+      for (std::size_t c = 0; c < cells; ++c)
+      {
+        const double expected = (plus[i * cells + c] - minus[i * cells + c]) / (2.0 * h[c]);
+        const double actual = element ? values[*element * cells + c] : 0.0;
+        EXPECT_NEAR(actual, expected, 1.0e-6 * std::max(1.0, std::abs(expected))) << "d" << i << "/d" << j << " in cell " << c;
+      }
+    }
+  }
+}
+
+TEST(Jacobian, RejectsMismatchedArrays)
+{
+  v1::Jacobian jacobian(JacobianMechanism());
+  std::vector<double> k(jacobian.NumberOfProcesses());
+  std::vector<double> y(jacobian.NumberOfSpecies());
+  std::vector<double> values(jacobian.NumberOfNonZeros() + 1);
+  EXPECT_THROW(jacobian.Calculate(k, y, values, 1), std::invalid_argument);
+}
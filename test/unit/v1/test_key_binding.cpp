@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/key_binding.hpp>
+#include <mechanism_configuration/validate_schema.hpp>
+#include <stdexcept>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  const std::vector<std::string> required = { "type", "reactants", "products" };
+  const std::vector<std::string> optional = { "A", "name" };
+
+  void ExpectSameErrors(const Errors& actual, const Errors& expected)
+  {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (std::size_t i = 0; i < actual.size(); ++i)
+    {
+      EXPECT_EQ(actual[i].status, expected[i].status);
+      EXPECT_EQ(actual[i].key, expected[i].key);
+      EXPECT_EQ(actual[i].line, expected[i].line);
+      EXPECT_EQ(actual[i].column, expected[i].column);
+    }
+  }
+}  // namespace
+
+TEST(KeyBinding, BindsKnownKeysAndComments)
+{
+  v1::KeyTable keys(required, optional);
+  YAML::Node object = YAML::Load(R"(
+type: ARRHENIUS
+reactants: [ { species name: A } ]
+products: []
+A: 1.5
+__note: keep me
+__list: [ 1, 2 ]
+)");
+
+  v1::BoundObject bound(object, keys);
+  EXPECT_TRUE(bound.SchemaErrors().empty());
+  EXPECT_TRUE(bound.Has("A"));
+  EXPECT_FALSE(bound.Has("name"));
+  EXPECT_EQ(bound["A"].as<double>(), 1.5);
+  EXPECT_EQ(bound["type"].as<std::string>(), "ARRHENIUS");
+  EXPECT_EQ(bound["reactants"].size(), 1u);
+
+  auto comments = bound.TakeComments();
+  EXPECT_EQ(comments.size(), 2u);
+  EXPECT_EQ(comments["__note"], "keep me");
+  EXPECT_EQ(comments["__list"], "[1, 2]");
+}
+
+TEST(KeyBinding, ReportsTheSameErrorsAsValidateSchema)
+{
+  v1::KeyTable keys(required, optional);
+  const std::vector<std::string> objects = {
+    "{ type: X, reactants: [], products: [] }",
+    "{ type: X }",
+    "{ zeta: 1, type: X, reactants: [], alpha: 2, products: [], has__underscores: 3 }",
+    "{ A: 1, beta: 2 }",
+  };
+
+  for (const auto& text : objects)
+  {
+    YAML::Node object = YAML::Load(text);
+    v1::BoundObject bound(object, keys);
+    ExpectSameErrors(bound.SchemaErrors(), ValidateSchema(object, required, optional));
+  }
+}
+
+TEST(KeyBinding, ReportsNullObjects)
+{
+  v1::KeyTable keys(required, optional);
+  v1::BoundObject bound(YAML::Node(), keys);
+  ASSERT_EQ(bound.SchemaErrors().size(), 1u);
+  EXPECT_EQ(bound.SchemaErrors()[0].status, ConfigParseStatus::RequiredKeyNotFound);
+}
+
+TEST(KeyBinding, RejectsKeysOutsideTheTable)
+{
+  v1::KeyTable keys(required, optional);
+  v1::BoundObject bound(YAML::Load("{ type: X, reactants: [], products: [] }"), keys);
+  EXPECT_THROW(bound.Has("Ea"), std::logic_error);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/mechanism_graph.hpp>
+#include <mechanism_configuration/v1/parser.hpp>
+
+#include "test_mechanisms.hpp"
+
+using namespace mechanism_configuration;
+using namespace test_mechanisms;
+
+TEST(MechanismGraph, BuildsBipartiteGraph)
+{
+  v1::MechanismGraph graph(CycleMechanism());
+  EXPECT_EQ(graph.NumberOfSpecies(), 8);
+  EXPECT_EQ(graph.NumberOfReactions(), 5);
+  EXPECT_EQ(graph.Reaction(0).type, v1::types::ReactionType::Arrhenius);
+  EXPECT_EQ(graph.Reaction(4).type, v1::types::ReactionType::Emission);
+  EXPECT_EQ(graph.Reaction(4).index, 0);
+  ASSERT_EQ(graph.Reactants(0).size(), 2);
+  EXPECT_EQ(graph.SpeciesName(graph.Products(0)[0]), "NO2");
+  EXPECT_FALSE(graph.SpeciesIndex("unknown").has_value());
+}
+
+TEST(MechanismGraph, FindsReachableAndDeadSpecies)
+{
+  v1::MechanismGraph graph(CycleMechanism());
+  auto reachable = graph.Reachable(std::vector<std::string>{ "NO2", "X" });
+  EXPECT_TRUE(reachable.species[*graph.SpeciesIndex("NO")]);
+  EXPECT_TRUE(reachable.species[*graph.SpeciesIndex("O3")]);
+  EXPECT_TRUE(reachable.species[*graph.SpeciesIndex("E")]);
+  EXPECT_FALSE(reachable.species[*graph.SpeciesIndex("Z")]);
+
+  auto dead_species = graph.DeadSpecies({ "NO2", "X" });
+  ASSERT_EQ(dead_species.size(), 2);
+  EXPECT_EQ(graph.SpeciesName(dead_species[0]), "Y");
+  EXPECT_EQ(graph.SpeciesName(dead_species[1]), "Z");
+
+  auto dead_reactions = graph.DeadReactions({ "NO2", "X" });
+  ASSERT_EQ(dead_reactions.size(), 1);
+  EXPECT_EQ(graph.Reaction(dead_reactions[0]).index, 3);
+
+  // without an initial NOx source the whole cycle is dead
+  dead_reactions = graph.DeadReactions({ "O3" });
+  EXPECT_EQ(dead_reactions.size(), 4);
+}
+
+TEST(MechanismGraph, FindsCycles)
+{
+  v1::MechanismGraph graph(CycleMechanism());
+  auto cycles = graph.Cycles();
+  ASSERT_EQ(cycles.size(), 1);
+  EXPECT_EQ(cycles[0].species.size(), 4);
+  EXPECT_EQ(cycles[0].reactions, (std::vector<std::size_t>{ 0, 1, 2 }));
+}
+
+TEST(MechanismGraph, IgnoresChainedEquilibria)
+{
+  // G <-> A by Henry's law and A <-> I by aqueous equilibrium are strongly connected only through their
+  // reverse directions
+  v1::types::Mechanism mechanism;
+  for (const auto& name : { "G", "A", "I" })
+  {
+    v1::types::Species species;
+    species.name = name;
+    mechanism.species.push_back(species);
+  }
+  v1::types::HenrysLaw henrys_law;
+  henrys_law.gas_phase_species = "G";
+  henrys_law.aerosol_phase_species = "A";
+  mechanism.reactions.henrys_law.push_back(henrys_law);
+  v1::types::AqueousEquilibrium equilibrium;
+  equilibrium.reactants.push_back(Component("A"));
+  equilibrium.products.push_back(Component("I"));
+  mechanism.reactions.aqueous_equilibrium.push_back(equilibrium);
+
+  EXPECT_TRUE(v1::MechanismGraph(mechanism).Cycles().empty());
+
+  // an irreversible I -> G closes a cycle through the forward directions
+  mechanism.reactions.arrhenius.push_back(Arrhenius({ "I" }, { "G" }));
+  auto cycles = v1::MechanismGraph(mechanism).Cycles();
+  ASSERT_EQ(cycles.size(), 1);
+  EXPECT_EQ(cycles[0].species.size(), 3);
+  EXPECT_EQ(cycles[0].reactions.size(), 3);
+
+  // but not one that runs against them
+  mechanism.reactions.arrhenius[0] = Arrhenius({ "G" }, { "I" });
+  EXPECT_TRUE(v1::MechanismGraph(mechanism).Cycles().empty());
+}
+
+TEST(MechanismGraph, FindsSelfRegeneratingReactions)
+{
+  v1::types::Mechanism mechanism;
+  for (const auto& name : { "X", "Y" })
+  {
+    v1::types::Species species;
+    species.name = name;
+    mechanism.species.push_back(species);
+  }
+  mechanism.reactions.arrhenius.push_back(Arrhenius({ "X" }, { "X", "Y" }));
+  auto cycles = v1::MechanismGraph(mechanism).Cycles();
+  ASSERT_EQ(cycles.size(), 1);
+  EXPECT_EQ(cycles[0].species, (std::vector<std::size_t>{ 0 }));
+  EXPECT_EQ(cycles[0].reactions, (std::vector<std::size_t>{ 0 }));
+}
+
+TEST(MechanismGraph, IgnoresSingleReversibleReactions)
+{
+  v1::Parser parser;
+  auto parsed = parser.Parse("examples/v1/full_configuration.yaml");
+  ASSERT_TRUE(parsed);
+  v1::MechanismGraph graph(*parsed);
+  EXPECT_EQ(graph.NumberOfSpecies(), parsed.mechanism->species.size());
+  EXPECT_EQ(graph.NumberOfReactions(), 16);
+  for (const auto& cycle : graph.Cycles())
+  {
+    EXPECT_FALSE(cycle.reactions.size() == 1 && graph.IsReversible(cycle.reactions[0]));
+  }
+}
@@ -0,0 +1,172 @@
+// Reaction and mechanism factories shared by the v1 unit tests
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/parser.hpp>
+#include <mechanism_configuration/v1/types.hpp>
+
+#include <string>
+#include <vector>
+
+namespace test_mechanisms
+{
+  namespace types = mechanism_configuration::v1::types;
+
+  inline types::ReactionComponent Component(const std::string& name, double coefficient = 1.0)
+  {
+    types::ReactionComponent component;
+    component.species_name = name;
+    component.coefficient = coefficient;
+    return component;
+  }
+
+  /// @brief A gas-phase Arrhenius reaction
+  inline types::Arrhenius Arrhenius(const std::vector<types::ReactionComponent>& reactants, const std::vector<types::ReactionComponent>& products)
+  {
+    types::Arrhenius arrhenius;
+    arrhenius.reactants = reactants;
+    arrhenius.products = products;
+    arrhenius.gas_phase = "gas";
+    return arrhenius;
+  }
+
+  /// @brief A gas-phase Arrhenius reaction with a coefficient of one for each species
+  inline types::Arrhenius Arrhenius(const std::vector<std::string>& reactants, const std::vector<std::string>& products)
+  {
+    types::Arrhenius arrhenius = Arrhenius(std::vector<types::ReactionComponent>{}, std::vector<types::ReactionComponent>{});
+    for (const auto& name : reactants)
+      arrhenius.reactants.push_back(Component(name));
+    for (const auto& name : products)
+      arrhenius.products.push_back(Component(name));
+    return arrhenius;
+  }
+
+  /// @brief A mechanism with the named species and no reactions
+  inline types::Mechanism WithSpecies(const std::vector<std::string>& names)
+  {
+    types::Mechanism mechanism;
+    for (const auto& name : names)
+    {
+      types::Species species;
+      species.name = name;
+      mechanism.species.push_back(species);
+    }
+    return mechanism;
+  }
+
+  inline types::Mechanism FullConfiguration()
+  {
+    mechanism_configuration::v1::Parser parser;
+    auto parsed = parser.Parse("examples/v1/full_configuration.yaml");
+    EXPECT_TRUE(parsed);
+    return *parsed.mechanism;
+  }
+
+  inline types::Mechanism JacobianMechanism()
+  {
+    auto mechanism = WithSpecies({ "A", "B", "C", "D", "E" });
+
+    // 2A -> B
+    types::Arrhenius dimerization;
+    dimerization.reactants = { Component("A", 2.0) };
+    dimerization.products = { Component("B") };
+    mechanism.reactions.arrhenius.push_back(dimerization);
+
+    // A + B + C -> C + D, with C as a catalyst
+    types::Arrhenius catalysed;
+    catalysed.reactants = { Component("A"), Component("B"), Component("C") };
+    catalysed.products = { Component("C"), Component("D", 1.5) };
+    mechanism.reactions.arrhenius.push_back(catalysed);
+
+    types::Branched branched;
+    branched.reactants = { Component("D") };
+    branched.nitrate_products = { Component("C") };
+    branched.alkoxy_products = { Component("A", 2.0) };
+    mechanism.reactions.branched.push_back(branched);
+
+    types::Emission emission;
+    emission.products = { Component("A") };
+    mechanism.reactions.emission.push_back(emission);
+
+    types::Photolysis photolysis;
+    photolysis.reactants = { Component("B", 1.5) };
+    photolysis.products = { Component("A") };
+    mechanism.reactions.photolysis.push_back(photolysis);
+    return mechanism;
+  }
+
+  inline types::Mechanism ForcingMechanism()
+  {
+    auto mechanism = WithSpecies({ "A", "B", "C", "D" });
+
+    // 2A -> B
+    types::Arrhenius dimerization;
+    dimerization.reactants = { Component("A", 2.0) };
+    dimerization.products = { Component("B") };
+    mechanism.reactions.arrhenius.push_back(dimerization);
+
+    // A + B -> C + 0.5 A, a net loss of half an A
+    types::Arrhenius recycling;
+    recycling.reactants = { Component("A"), Component("B") };
+    recycling.products = { Component("C"), Component("A", 0.5) };
+    mechanism.reactions.arrhenius.push_back(recycling);
+
+    // C -> D on the nitrate branch and C -> A on the alkoxy branch
+    types::Branched branched;
+    branched.reactants = { Component("C") };
+    branched.nitrate_products = { Component("D") };
+    branched.alkoxy_products = { Component("A") };
+    mechanism.reactions.branched.push_back(branched);
+
+    types::Emission emission;
+    emission.products = { Component("D") };
+    mechanism.reactions.emission.push_back(emission);
+
+    types::FirstOrderLoss loss;
+    loss.reactants = { Component("D") };
+    mechanism.reactions.first_order_loss.push_back(loss);
+
+    // A fractional reactant coefficient
+    types::Photolysis photolysis;
+    photolysis.reactants = { Component("B", 0.5) };
+    photolysis.products = { Component("C", 2.0) };
+    mechanism.reactions.photolysis.push_back(photolysis);
+    return mechanism;
+  }
+
+  // NO + O3 -> NO2, NO2 -> NO + O, O -> O3 forms a cycle; X + Y -> Z can never proceed without Y; E is emitted
+  inline types::Mechanism CycleMechanism()
+  {
+    auto mechanism = WithSpecies({ "NO", "NO2", "O", "O3", "X", "Y", "Z", "E" });
+    mechanism.reactions.arrhenius.push_back(Arrhenius({ "NO", "O3" }, { "NO2" }));
+    mechanism.reactions.arrhenius.push_back(Arrhenius({ "NO2" }, { "NO", "O" }));
+    mechanism.reactions.arrhenius.push_back(Arrhenius({ "O" }, { "O3" }));
+    mechanism.reactions.arrhenius.push_back(Arrhenius({ "X", "Y" }, { "Z" }));
+    types::Emission emission;
+    emission.products.push_back(Component("E"));
+    mechanism.reactions.emission.push_back(emission);
+    return mechanism;
+  }
+
+  // A -> B -> C forms a chain feeding C; D -> E is unrelated; F + G -> C needs G, which is never emitted
+  inline types::Mechanism ChainMechanism()
+  {
+    auto mechanism = WithSpecies({ "A", "B", "C", "D", "E", "F", "G" });
+    types::Phase gas;
+    gas.name = "gas";
+    for (const auto& species : mechanism.species)
+      gas.species.push_back(species.name);
+    mechanism.phases.push_back(gas);
+    mechanism.reactions.arrhenius.push_back(Arrhenius({ "A" }, { "B" }));
+    mechanism.reactions.arrhenius.push_back(Arrhenius({ "D" }, { "E" }));
+    mechanism.reactions.arrhenius.push_back(Arrhenius({ "B" }, { "C" }));
+    mechanism.reactions.arrhenius.push_back(Arrhenius({ "F", "G" }, { "C" }));
+    types::Emission emission;
+    emission.gas_phase = "gas";
+    emission.products.push_back(Component("A"));
+    mechanism.reactions.emission.push_back(emission);
+    return mechanism;
+  }
+}  // namespace test_mechanisms
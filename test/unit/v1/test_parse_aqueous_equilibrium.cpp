@@ -59,11 +59,11 @@ TEST(ParserBase, AqueousEquilibriumDetectsUnknownSpecies)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 2);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::ReactionRequiresUnknownSpecies);
-    EXPECT_EQ(parsed.errors[1].first, ConfigParseStatus::RequestedAerosolSpeciesNotIncludedInAerosolPhase);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::ReactionRequiresUnknownSpecies);
+    EXPECT_EQ(parsed.errors[1].status, ConfigParseStatus::RequestedAerosolSpeciesNotIncludedInAerosolPhase);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << std::endl;
+      std::cout << error.to_string() << std::endl;
     }
   }
 }
@@ -78,15 +78,15 @@ TEST(ParserBase, AqueousEquilibriumDetectsBadReactionComponent)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 6);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[1].first, ConfigParseStatus::InvalidKey);
-    EXPECT_EQ(parsed.errors[2].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[3].first, ConfigParseStatus::InvalidKey);
-    EXPECT_EQ(parsed.errors[4].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[5].first, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[1].status, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[2].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[3].status, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[4].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[5].status, ConfigParseStatus::InvalidKey);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -101,10 +101,10 @@ TEST(ParserBase, AqueousEquilibriumDetectsUnknownPhase)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::UnknownPhase);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::UnknownPhase);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
\ No newline at end of file
@@ -78,10 +78,10 @@ TEST(ParserBase, ArrheniusDetectsUnknownSpecies)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::ReactionRequiresUnknownSpecies);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::ReactionRequiresUnknownSpecies);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -96,10 +96,10 @@ TEST(ParserBase, ArrheniusDetectsMutuallyExclusiveOptions)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::MutuallyExclusiveOption);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::MutuallyExclusiveOption);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -114,11 +114,11 @@ TEST(ParserBase, ArrheniusDetectsBadReactionComponent)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 2);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::RequiredKeyNotFound);
-    EXPECT_EQ(parsed.errors[1].first, ConfigParseStatus::InvalidKey);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::RequiredKeyNotFound);
+    EXPECT_EQ(parsed.errors[1].status, ConfigParseStatus::InvalidKey);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
 }
@@ -133,10 +133,29 @@ TEST(ParserBase, ArrheniusDetectsUnknownPhase)
     auto parsed = parser.Parse(file);
     EXPECT_FALSE(parsed);
     EXPECT_EQ(parsed.errors.size(), 1);
-    EXPECT_EQ(parsed.errors[0].first, ConfigParseStatus::UnknownPhase);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::UnknownPhase);
     for (auto& error : parsed.errors)
     {
-      std::cout << error.second << " " << configParseStatusToString(error.first) << std::endl;
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
     }
   }
-}
\ No newline at end of file
+}
+
+TEST(ParserBase, ArrheniusDetectsDuplicateReaction)
+{
+  v1::Parser parser;
+  std::vector<std::string> extensions = { ".json", ".yaml" };
+  for (auto& extension : extensions)
+  {
+    std::string file = std::string("v1_unit_configs/reactions/arrhenius/duplicate_reaction") + extension;
+    auto parsed = parser.Parse(file);
+    EXPECT_FALSE(parsed);
+    // the second reaction has different rate parameters, so only the third repeats the first
+    EXPECT_EQ(parsed.errors.size(), 1);
+    EXPECT_EQ(parsed.errors[0].status, ConfigParseStatus::DuplicateReactionDetected);
+    for (auto& error : parsed.errors)
+    {
+      std::cout << error.to_string() << " " << configParseStatusToString(error.status) << std::endl;
+    }
+  }
+}
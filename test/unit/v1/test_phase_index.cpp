@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/phase_index.hpp>
+#include <mechanism_configuration/v1/utils.hpp>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  std::vector<v1::types::Species> Species(const std::vector<std::string>& names)
+  {
+    std::vector<v1::types::Species> species;
+    for (const auto& name : names)
+    {
+      v1::types::Species spec;
+      spec.name = name;
+      species.push_back(spec);
+    }
+    return species;
+  }
+
+  v1::types::Phase Phase(const std::string& name, const std::vector<std::string>& species)
+  {
+    v1::types::Phase phase;
+    phase.name = name;
+    phase.species = species;
+    return phase;
+  }
+}  // namespace
+
+TEST(PhaseIndex, LooksUpSpeciesAndPhases)
+{
+  v1::PhaseIndex index(Species({ "A", "B", "H2O" }), { Phase("gas", { "A", "B" }), Phase("aqueous", { "B", "H2O" }) });
+
+  EXPECT_TRUE(index.HasSpecies("A"));
+  EXPECT_FALSE(index.HasSpecies("C"));
+  EXPECT_EQ(index.SpeciesOrdinal("H2O"), 2u);
+  EXPECT_EQ(index.SpeciesOrdinal("C"), std::nullopt);
+
+  EXPECT_TRUE(index.HasPhase("aqueous"));
+  EXPECT_FALSE(index.HasPhase("organic"));
+  EXPECT_EQ(index.PhaseOrdinal("aqueous"), 1u);
+
+  EXPECT_TRUE(index.PhaseHasSpecies("gas", "A"));
+  EXPECT_FALSE(index.PhaseHasSpecies("gas", "H2O"));
+  EXPECT_TRUE(index.PhaseHasSpecies("aqueous", "H2O"));
+  EXPECT_FALSE(index.PhaseHasSpecies("organic", "A"));
+  EXPECT_FALSE(index.PhaseHasSpecies("gas", "C"));
+}
+
+TEST(PhaseIndex, ChecksRequestedSpecies)
+{
+  v1::PhaseIndex index(Species({ "A", "B", "H2O" }), { Phase("gas", { "A", "B" }), Phase("aqueous", { "B", "H2O" }) });
+
+  EXPECT_FALSE(index.RequiresUnknownSpecies({ "A", "H2O" }));
+  EXPECT_TRUE(index.RequiresUnknownSpecies({ "A", "C" }));
+  EXPECT_FALSE(index.RequiresUnknownSpecies({}));
+
+  EXPECT_FALSE(index.PhaseRequiresUnknownSpecies("aqueous", { "B", "H2O" }));
+  EXPECT_TRUE(index.PhaseRequiresUnknownSpecies("aqueous", { "A", "H2O" }));
+  EXPECT_TRUE(index.PhaseRequiresUnknownSpecies("organic", {}));
+}
+
+TEST(PhaseIndex, FirstPhaseWithANameWins)
+{
+  v1::PhaseIndex index(Species({ "A", "B" }), { Phase("gas", { "A" }), Phase("gas", { "B" }) });
+
+  EXPECT_EQ(index.PhaseOrdinal("gas"), 0u);
+  EXPECT_TRUE(index.PhaseHasSpecies("gas", "A"));
+  EXPECT_FALSE(index.PhaseHasSpecies("gas", "B"));
+}
+
+TEST(PhaseIndex, EmptyIndexKnowsNothing)
+{
+  v1::PhaseIndex index;
+
+  EXPECT_FALSE(index.HasSpecies("A"));
+  EXPECT_FALSE(index.HasPhase("gas"));
+  EXPECT_TRUE(index.RequiresUnknownSpecies({ "A" }));
+}
+
+TEST(PhaseIndex, ContainsUniqueObjectsByName)
+{
+  EXPECT_TRUE(v1::ContainsUniqueObjectsByName(Species({ "A", "B", "C" })));
+  EXPECT_FALSE(v1::ContainsUniqueObjectsByName(Species({ "A", "B", "A" })));
+  EXPECT_TRUE(v1::ContainsUniqueObjectsByName(Species({})));
+}
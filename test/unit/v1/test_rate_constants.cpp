@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/rate_constants.hpp>
+#include <mechanism_configuration/v1/rate_kernel.hpp>
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  v1::types::Mechanism RateMechanism()
+  {
+    v1::types::Mechanism mechanism;
+
+    v1::types::Arrhenius full;
+    full.A = 2.0e-12;
+    full.B = 1.5;
+    full.C = -250.0;
+    full.D = 250.0;
+    full.E = 1.0e-5;
+    mechanism.reactions.arrhenius.push_back(full);
+
+    // Shares exp(-250 / T) with the first reaction and has no (T / D)^B or pressure term
+    v1::types::Arrhenius simple;
+    simple.A = 3.0e-11;
+    simple.C = -250.0;
+    mechanism.reactions.arrhenius.push_back(simple);
+
+    v1::types::Arrhenius constant;
+    constant.A = 4.0e-13;
+    mechanism.reactions.arrhenius.push_back(constant);
+
+    v1::types::Branched branched;
+    branched.X = 1.2e-4;
+    branched.Y = 167.0;
+    branched.a0 = 0.15;
+    branched.n = 9;
+    mechanism.reactions.branched.push_back(branched);
+
+    v1::types::Photolysis photolysis;
+    photolysis.scaling_factor = 2.0;
+    mechanism.reactions.photolysis.push_back(photolysis);
+
+    v1::types::Emission emission;
+    mechanism.reactions.emission.push_back(emission);
+
+    v1::types::Troe troe;
+    troe.k0_A = 1.2e-12;
+    troe.k0_B = -1.8;
+    troe.kinf_A = 1.0e-10;
+    troe.kinf_C = 23.0;
+    mechanism.reactions.troe.push_back(troe);
+
+    v1::types::Tunneling tunneling;
+    tunneling.A = 5.0;
+    tunneling.B = 100.0;
+    tunneling.C = 1.0e5;
+    mechanism.reactions.tunneling.push_back(tunneling);
+
+    // Surface reactions depend on the aerosol state and have no rate constant
+    mechanism.reactions.surface.push_back(v1::types::Surface{});
+    return mechanism;
+  }
+}  // namespace
+
+TEST(RateConstants, LaysOutRatesInReactionListOrder)
+{
+  auto layout = v1::RateConstantLayout(RateMechanism());
+  ASSERT_EQ(layout.size(), 9);
+  // Emission comes before photolysis in types::Reactions
+  EXPECT_EQ(layout[3].reaction.type, v1::types::ReactionType::Branched);
+  EXPECT_EQ(layout[3].channel, v1::RateChannel::Nitrate);
+  EXPECT_EQ(layout[4].channel, v1::RateChannel::Alkoxy);
+  EXPECT_EQ(layout[5].reaction.type, v1::types::ReactionType::Emission);
+  EXPECT_EQ(layout[5].external, 0);
+  EXPECT_EQ(layout[6].reaction.type, v1::types::ReactionType::Photolysis);
+  EXPECT_EQ(layout[6].external, 1);
+  EXPECT_EQ(layout[7].reaction.type, v1::types::ReactionType::Troe);
+  EXPECT_FALSE(layout[7].external.has_value());
+  EXPECT_EQ(layout[8].reaction.type, v1::types::ReactionType::Tunneling);
+}
+
+TEST(RateConstants, EvaluatesEachRateExpression)
+{
+  v1::RateConstants rates(RateMechanism());
+  ASSERT_EQ(rates.Size(), 9);
+  ASSERT_EQ(rates.NumberOfExternalRates(), 2);
+
+  v1::Conditions conditions{ 272.5, 101253.3, 42.2 };
+  std::vector<double> external = { 0.5, 3.0 };
+  std::vector<double> k(rates.Size());
+  rates.Calculate(conditions, external, k);
+
+  const double T = conditions.temperature;
+  EXPECT_DOUBLE_EQ(k[0], 2.0e-12 * std::exp(-250.0 / T) * std::pow(T / 250.0, 1.5) * (1.0 + 1.0e-5 * conditions.pressure));
+  EXPECT_DOUBLE_EQ(k[1], 3.0e-11 * std::exp(-250.0 / T));
+  EXPECT_DOUBLE_EQ(k[2], 4.0e-13);
+  EXPECT_NEAR(k[3] + k[4], 1.2e-4 * std::exp(-167.0 / T), 1.0e-4 * 1.0e-12);
+  EXPECT_GT(k[3], 0.0);
+  EXPECT_GT(k[4], 0.0);
+  EXPECT_DOUBLE_EQ(k[5], 0.5);
+  EXPECT_DOUBLE_EQ(k[6], 6.0);
+  EXPECT_DOUBLE_EQ(k[8], 5.0 * std::exp(-100.0 / T + 1.0e5 / (T * T * T)));
+
+  const double k0 = 1.2e-12 * std::pow(T / 300.0, -1.8);
+  const double kinf = 1.0e-10 * std::exp(23.0 / T);
+  const double M = conditions.air_density;
+  EXPECT_DOUBLE_EQ(k[7], k0 * M / (1.0 + k0 * M / kinf) * std::pow(0.6, 1.0 / (1.0 + std::pow(std::log10(k0 * M / kinf), 2))));
+}
+
+TEST(RateConstants, RejectsMismatchedBuffers)
+{
+  v1::RateConstants rates(RateMechanism());
+  std::vector<double> k(rates.Size());
+  std::vector<double> external(1);
+  EXPECT_THROW(rates.Calculate({}, external, k), std::invalid_argument);
+  external.resize(2);
+  k.pop_back();
+  EXPECT_THROW(rates.Calculate({}, external, k), std::invalid_argument);
+}
+
+TEST(RateKernel, SharesExponentialsAndDropsZeroTerms)
+{
+  std::ostringstream stream;
+  v1::WriteRateKernel(RateMechanism(), stream);
+  std::string source = stream.str();
+
+  EXPECT_NE(source.find("mechanism_rate_constant_count()\n{\n  return 9;"), std::string::npos);
+  EXPECT_NE(source.find("mechanism_external_rate_count()\n{\n  return 2;"), std::string::npos);
+
+  // exp(-250 / T) is computed once for the two reactions that use it
+  EXPECT_NE(source.find("std::exp(-250.0 * inv_T)"), std::string::npos);
+  EXPECT_EQ(source.find("std::exp(-250.0 * inv_T)"), source.rfind("std::exp(-250.0 * inv_T)"));
+  EXPECT_NE(source.find("k[1] = 3e-11 * exp_"), std::string::npos);
+  EXPECT_NE(source.find("k[2] = 4e-13;"), std::string::npos);
+  EXPECT_NE(source.find("k[5] = external[0];"), std::string::npos);
+  EXPECT_NE(source.find("k[6] = 2.0 * external[1];"), std::string::npos);
+}
+
+TEST(RateKernel, WritesAKernelForAnEmptyMechanism)
+{
+  std::ostringstream stream;
+  v1::WriteRateKernel(v1::types::Mechanism{}, stream);
+  EXPECT_NE(stream.str().find("return 0;"), std::string::npos);
+  EXPECT_NE(stream.str().find("(void)k;"), std::string::npos);
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/reaction_parameters.hpp>
+#include <mechanism_configuration/v1/utils.hpp>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  v1::PhaseIndex Index()
+  {
+    std::vector<v1::types::Species> species(4);
+    species[0].name = "A";
+    species[1].name = "B";
+    species[2].name = "H2O";
+    species[3].name = "C";
+    std::vector<v1::types::Phase> phases(2);
+    phases[0].name = "gas";
+    phases[0].species = { "A", "B", "C" };
+    phases[1].name = "aqueous";
+    phases[1].species = { "B", "H2O" };
+    return v1::PhaseIndex(species, phases);
+  }
+
+  std::vector<ConfigParseStatus> Statuses(const Errors& errors)
+  {
+    std::vector<ConfigParseStatus> statuses;
+    for (const auto& error : errors)
+    {
+      statuses.push_back(error.status);
+    }
+    return statuses;
+  }
+}  // namespace
+
+TEST(ReactionDescriptors, ParsesFieldsInOnePass)
+{
+  v1::types::Reactions reactions;
+  auto errors = v1::ParseReaction(
+      YAML::Load(R"({ type: TROE, gas phase: gas, reactants: [ { species name: A } ], products: [ { species name: B, coefficient: 2 } ],
+                     k0_A: 2.5, N: 0.5, name: t, __source: test })"),
+      Index(),
+      reactions);
+
+  EXPECT_TRUE(errors.empty());
+  ASSERT_EQ(reactions.troe.size(), 1u);
+  const auto& troe = reactions.troe[0];
+  EXPECT_EQ(troe.name, "t");
+  EXPECT_EQ(troe.gas_phase, "gas");
+  EXPECT_EQ(troe.k0_A, 2.5);
+  EXPECT_EQ(troe.N, 0.5);
+  EXPECT_EQ(troe.Fc, 0.6);
+  ASSERT_EQ(troe.products.size(), 1u);
+  EXPECT_EQ(troe.products[0].coefficient, 2.0);
+  EXPECT_EQ(troe.unknown_properties.at("__source"), "test");
+}
+
+TEST(ReactionDescriptors, RequiredNumbersAreReportedWhenMissing)
+{
+  v1::types::Reactions reactions;
+  auto errors = v1::ParseReaction(
+      YAML::Load(R"({ type: BRANCHED_NO_RO2, gas phase: gas, reactants: [], nitrate products: [], alkoxy products: [], X: 1, Y: 2, a0: 3 })"),
+      Index(),
+      reactions);
+
+  ASSERT_EQ(errors.size(), 1u);
+  EXPECT_EQ(errors[0].status, ConfigParseStatus::RequiredKeyNotFound);
+  EXPECT_EQ(errors[0].key, "n");
+  EXPECT_TRUE(reactions.branched.empty());
+}
+
+TEST(ReactionDescriptors, ChecksListedSpeciesAgainstTheirPhase)
+{
+  v1::types::Reactions reactions;
+  auto errors = v1::ParseReaction(
+      YAML::Load(R"({ type: HL_PHASE_TRANSFER, gas phase: gas, gas-phase species: A, aerosol phase: aqueous,
+                     aerosol-phase species: C, aerosol-phase water: H2O })"),
+      Index(),
+      reactions);
+
+  EXPECT_EQ(Statuses(errors), std::vector<ConfigParseStatus>{ ConfigParseStatus::RequestedAerosolSpeciesNotIncludedInAerosolPhase });
+  ASSERT_EQ(reactions.henrys_law.size(), 1u);
+  EXPECT_EQ(reactions.henrys_law[0].aerosol_phase_species, "C");
+}
+
+TEST(ReactionDescriptors, ReportsUnknownPhasesAtTheirKey)
+{
+  v1::types::Reactions reactions;
+  auto errors = v1::ParseReaction(
+      YAML::Load("{ type: CONDENSED_PHASE_ARRHENIUS, aerosol phase: organic, aerosol-phase water: H2O, reactants: [], products: [] }"),
+      Index(),
+      reactions);
+
+  ASSERT_EQ(errors.size(), 1u);
+  EXPECT_EQ(errors[0].status, ConfigParseStatus::UnknownPhase);
+  EXPECT_EQ(errors[0].key, v1::validation::keys.aerosol_phase);
+  EXPECT_EQ(errors[0].detail, "organic");
+}
+
+TEST(ReactionDescriptors, VisitsParametersInDescriptorOrder)
+{
+  std::vector<std::string> names;
+  v1::types::Troe troe;
+  v1::ForEachParameter(troe, [&](const std::string& name, double) { names.push_back(name); });
+  EXPECT_EQ(names, (std::vector<std::string>{ "k0_A", "k0_B", "k0_C", "kinf_A", "kinf_B", "kinf_C", "Fc", "N" }));
+
+  names.clear();
+  std::vector<double> values;
+  v1::types::SimpolPhaseTransfer simpol;
+  simpol.B = { 1, 2, 3, 4 };
+  v1::ForEachParameter(
+      simpol,
+      [&](const std::string& name, double value)
+      {
+        names.push_back(name);
+        values.push_back(value);
+      });
+  EXPECT_EQ(names, (std::vector<std::string>{ "B[0]", "B[1]", "B[2]", "B[3]" }));
+  EXPECT_EQ(values, (std::vector<double>{ 1, 2, 3, 4 }));
+
+  names.clear();
+  v1::ForEachParameter(v1::types::HenrysLaw{}, [&](const std::string& name, double) { names.push_back(name); });
+  EXPECT_TRUE(names.empty());
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/parser.hpp>
+#include <mechanism_configuration/v1/reaction_hash.hpp>
+
+#include "test_mechanisms.hpp"
+
+using namespace mechanism_configuration;
+using namespace test_mechanisms;
+
+TEST(ReactionHash, IgnoresOrderNamesAndParameters)
+{
+  auto a = Arrhenius({ Component("A"), Component("B") }, { Component("C", 0.5), Component("D") });
+  auto b = Arrhenius({ Component("B"), Component("A") }, { Component("D"), Component("C", 0.5) });
+  b.name = "renamed";
+  b.A = 42.0;
+  EXPECT_EQ(v1::CanonicalHash(a), v1::CanonicalHash(b));
+}
+
+TEST(ReactionHash, MergesRepeatedSpecies)
+{
+  auto a = Arrhenius({ Component("A"), Component("A") }, { Component("B") });
+  auto b = Arrhenius({ Component("A", 2.0) }, { Component("B") });
+  EXPECT_EQ(v1::CanonicalHash(a), v1::CanonicalHash(b));
+  EXPECT_EQ(v1::CanonicalComponents(a), v1::CanonicalComponents(b));
+}
+
+TEST(ReactionHash, DistinguishesStructure)
+{
+  auto base = Arrhenius({ Component("A") }, { Component("B") });
+  auto swapped = Arrhenius({ Component("B") }, { Component("A") });
+  auto coefficient = Arrhenius({ Component("A") }, { Component("B", 2.0) });
+  auto phase = base;
+  phase.gas_phase = "other";
+  EXPECT_NE(v1::CanonicalHash(base), v1::CanonicalHash(swapped));
+  EXPECT_NE(v1::CanonicalHash(base), v1::CanonicalHash(coefficient));
+  EXPECT_NE(v1::CanonicalHash(base), v1::CanonicalHash(phase));
+
+  // the same species in a different reaction type is a different reaction
+  v1::types::Troe troe;
+  troe.reactants = base.reactants;
+  troe.products = base.products;
+  troe.gas_phase = base.gas_phase;
+  EXPECT_NE(v1::CanonicalHash(base), v1::CanonicalHash(troe));
+
+  // nitrate and alkoxy products are different roles
+  v1::types::Branched nitrate, alkoxy;
+  nitrate.reactants = alkoxy.reactants = base.reactants;
+  nitrate.nitrate_products = base.products;
+  alkoxy.alkoxy_products = base.products;
+  EXPECT_NE(v1::CanonicalHash(nitrate), v1::CanonicalHash(alkoxy));
+}
+
+TEST(ReactionHash, FindsDuplicates)
+{
+  v1::types::Reactions reactions;
+  reactions.arrhenius = { Arrhenius({ Component("A") }, { Component("B") }),
+                          Arrhenius({ Component("C") }, { Component("D") }),
+                          Arrhenius({ Component("A") }, { Component("B") }),
+                          Arrhenius({ Component("A") }, { Component("B") }) };
+  reactions.arrhenius[2].A = 2.0;
+  reactions.arrhenius[3].A = 2.0;
+  v1::types::Photolysis photolysis;
+  photolysis.reactants = { Component("A") };
+  photolysis.products = { Component("B") };
+  photolysis.gas_phase = "gas";
+  reactions.photolysis = { photolysis, photolysis };
+
+  auto duplicates = v1::FindDuplicateReactions(reactions);
+  ASSERT_EQ(duplicates.size(), 3);
+
+  // a second term of the rate, with different parameters
+  EXPECT_EQ(duplicates[0].original.index, 0);
+  EXPECT_EQ(duplicates[0].duplicate.index, 2);
+  EXPECT_FALSE(duplicates[0].identical_parameters);
+
+  // an exact repeat of that second term
+  EXPECT_EQ(duplicates[1].original.index, 2);
+  EXPECT_EQ(duplicates[1].duplicate.index, 3);
+  EXPECT_TRUE(duplicates[1].identical_parameters);
+
+  EXPECT_TRUE(duplicates[1].identical_names);
+
+  EXPECT_EQ(duplicates[2].duplicate.type, v1::types::ReactionType::Photolysis);
+  EXPECT_EQ(duplicates[2].original.index, 0);
+  EXPECT_EQ(duplicates[2].duplicate.index, 1);
+  EXPECT_TRUE(duplicates[2].identical_parameters);
+}
+
+TEST(ReactionHash, PairsDuplicatesWithTheClosestOriginal)
+{
+  v1::types::Reactions reactions;
+  reactions.arrhenius.assign(6, Arrhenius({ Component("A") }, { Component("B") }));
+  const std::vector<std::pair<std::string, double>> names_and_rates{ { "x", 1.0 }, { "y", 2.0 }, { "z", 2.0 },
+                                                                     { "y", 2.0 }, { "x", 3.0 }, { "w", -0.0 } };
+  for (std::size_t i = 0; i < names_and_rates.size(); ++i)
+  {
+    reactions.arrhenius[i].name = names_and_rates[i].first;
+    reactions.arrhenius[i].A = names_and_rates[i].second;
+  }
+  reactions.arrhenius.push_back(reactions.arrhenius[5]);
+  reactions.arrhenius.back().name = "v";
+  reactions.arrhenius.back().A = 0.0;
+
+  auto duplicates = v1::FindDuplicateReactions(reactions);
+  ASSERT_EQ(duplicates.size(), 6);
+
+  // identical parameters under another name
+  EXPECT_EQ(duplicates[1].original.index, 1);
+  EXPECT_EQ(duplicates[1].duplicate.index, 2);
+  EXPECT_TRUE(duplicates[1].identical_parameters);
+  EXPECT_FALSE(duplicates[1].identical_names);
+
+  // an exact repeat is preferred over an earlier reaction with identical parameters
+  EXPECT_EQ(duplicates[2].original.index, 1);
+  EXPECT_EQ(duplicates[2].duplicate.index, 3);
+  EXPECT_TRUE(duplicates[2].identical_names);
+
+  // new parameters pair with the earliest reaction, which here has the same name
+  EXPECT_EQ(duplicates[3].original.index, 0);
+  EXPECT_EQ(duplicates[3].duplicate.index, 4);
+  EXPECT_FALSE(duplicates[3].identical_parameters);
+  EXPECT_TRUE(duplicates[3].identical_names);
+
+  // +0 and -0 are the same rate
+  EXPECT_EQ(duplicates[5].original.index, 5);
+  EXPECT_EQ(duplicates[5].duplicate.index, 6);
+  EXPECT_TRUE(duplicates[5].identical_parameters);
+}
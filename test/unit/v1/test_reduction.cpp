@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/parser.hpp>
+#include <mechanism_configuration/v1/reduction.hpp>
+
+#include "test_mechanisms.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace mechanism_configuration;
+using namespace test_mechanisms;
+
+namespace
+{
+  std::vector<std::string> Names(const v1::types::Mechanism& mechanism)
+  {
+    std::vector<std::string> names;
+    for (const auto& species : mechanism.species)
+      names.push_back(species.name);
+    return names;
+  }
+}  // namespace
+
+TEST(Reduction, KeepsTheClosureOfTheTargets)
+{
+  auto reduced = v1::Reduce(ChainMechanism(), { "C" });
+  EXPECT_EQ(Names(reduced.mechanism), (std::vector<std::string>{ "A", "B", "C", "F", "G" }));
+  EXPECT_EQ(reduced.species, (std::vector<std::size_t>{ 0, 1, 2, 5, 6 }));
+  ASSERT_EQ(reduced.mechanism.reactions.arrhenius.size(), 3);
+  ASSERT_EQ(reduced.mechanism.reactions.emission.size(), 1);
+  ASSERT_EQ(reduced.reactions.size(), 4);
+  EXPECT_EQ(reduced.reactions[0].index, 0);
+  EXPECT_EQ(reduced.reactions[1].index, 2);
+  EXPECT_EQ(reduced.reactions[2].index, 3);
+  EXPECT_EQ(reduced.reactions[3].type, v1::types::ReactionType::Emission);
+  ASSERT_EQ(reduced.mechanism.phases.size(), 1);
+  EXPECT_EQ(reduced.mechanism.phases[0].species.size(), 5);
+}
+
+TEST(Reduction, DropsReactionsThatCannotProceedFromEmissions)
+{
+  auto reduced = v1::Reduce(ChainMechanism(), { "C" }, { "A" });
+  EXPECT_EQ(Names(reduced.mechanism), (std::vector<std::string>{ "A", "B", "C" }));
+  ASSERT_EQ(reduced.reactions.size(), 3);
+  EXPECT_EQ(reduced.reactions[1].index, 2);
+}
+
+TEST(Reduction, ThrowsOnUnknownSpecies)
+{
+  EXPECT_THROW(v1::Reduce(ChainMechanism(), { "unknown" }), std::invalid_argument);
+  EXPECT_THROW(v1::Reduce(ChainMechanism(), { "C" }, { "unknown" }), std::invalid_argument);
+}
+
+TEST(Reduction, ProducesAConsistentMechanism)
+{
+  v1::Parser parser;
+  auto parsed = parser.Parse("examples/v1/full_configuration.json");
+  ASSERT_TRUE(parsed);
+  const auto& original = *parsed.mechanism;
+
+  for (const auto& target : original.species)
+  {
+    auto reduced = v1::Reduce(original, { target.name });
+    auto names = Names(reduced.mechanism);
+    auto known = [&](const std::string& name) { return std::find(names.begin(), names.end(), name) != names.end(); };
+    ASSERT_EQ(reduced.species.size(), names.size());
+    for (std::size_t s = 0; s < names.size(); ++s)
+      EXPECT_EQ(original.species[reduced.species[s]].name, names[s]);
+    for (const auto& phase : reduced.mechanism.phases)
+      for (const auto& name : phase.species)
+        EXPECT_TRUE(known(name)) << name;
+    v1::types::ForEachReactionList(
+        reduced.mechanism.reactions,
+        [&](v1::types::ReactionType, const auto& list)
+        {
+          for (const auto& reaction : list)
+            v1::types::ForEachSpeciesName(reaction, [&](const std::string& name) { EXPECT_TRUE(known(name)) << name; });
+        });
+    EXPECT_TRUE(known(target.name));
+  }
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <mechanism_configuration/v1/parser.hpp>
+#include <mechanism_configuration/v1/serializer.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+
+using namespace mechanism_configuration;
+
+namespace
+{
+  v1::types::Mechanism ParseFile(const std::filesystem::path& path)
+  {
+    v1::Parser parser;
+    auto parsed = parser.Parse(path);
+    EXPECT_TRUE(parsed) << path;
+    for (const auto& error : parsed.errors)
+      ADD_FAILURE() << error.to_string();
+    return parsed ? *parsed.mechanism : v1::types::Mechanism{};
+  }
+
+  v1::types::Mechanism RoundTrip(const v1::types::Mechanism& mechanism, const std::string& extension)
+  {
+    auto path = std::filesystem::temp_directory_path() / ("mechanism_configuration_serializer_test" + extension);
+    v1::WriteMechanism(mechanism, path);
+    auto read = ParseFile(path);
+    std::filesystem::remove(path);
+    return read;
+  }
+}  // namespace
+
+TEST(Serializer, RoundTripsTheFullConfiguration)
+{
+  for (const auto& source : { "examples/v1/full_configuration.yaml", "examples/v1/full_configuration.json" })
+  {
+    auto mechanism = ParseFile(source);
+    for (const auto& extension : { ".yaml", ".json" })
+    {
+      auto read = RoundTrip(mechanism, extension);
+      EXPECT_EQ(read.name, mechanism.name);
+      EXPECT_EQ(read.species.size(), mechanism.species.size());
+      EXPECT_EQ(read.phases.size(), mechanism.phases.size());
+      EXPECT_EQ(read.reactions.arrhenius[0].C, mechanism.reactions.arrhenius[0].C);
+      EXPECT_EQ(read.species[0].unknown_properties, mechanism.species[0].unknown_properties);
+
+      // the output is canonical, so an exact round trip writes identical text
+      EXPECT_EQ(v1::ToString(read, v1::OutputFormat::Yaml), v1::ToString(mechanism, v1::OutputFormat::Yaml));
+      EXPECT_EQ(v1::ToString(read, v1::OutputFormat::Json), v1::ToString(mechanism, v1::OutputFormat::Json));
+    }
+  }
+}
+
+TEST(Serializer, PreservesNumbersExactly)
+{
+  auto mechanism = ParseFile("examples/v1/full_configuration.yaml");
+  auto& arrhenius = mechanism.reactions.arrhenius[0];
+  arrhenius.A = 0.1 + 0.2;
+  arrhenius.B = std::numeric_limits<double>::denorm_min();
+  arrhenius.D = std::numeric_limits<double>::max();
+  arrhenius.E = -1.0 / 3.0;
+  mechanism.species[0].unknown_properties["__note"] = "quotes \" and\nnew lines";
+
+  for (const auto& extension : { ".yaml", ".json" })
+  {
+    auto read = RoundTrip(mechanism, extension);
+    EXPECT_EQ(read.reactions.arrhenius[0].A, arrhenius.A);
+    EXPECT_EQ(read.reactions.arrhenius[0].B, arrhenius.B);
+    EXPECT_EQ(read.reactions.arrhenius[0].D, arrhenius.D);
+    EXPECT_EQ(read.reactions.arrhenius[0].E, arrhenius.E);
+    EXPECT_EQ(read.species[0].unknown_properties.at("__note"), "quotes \" and\nnew lines");
+  }
+}
+
+TEST(Serializer, WritesValidJson)
+{
+  auto json = v1::ToString(ParseFile("examples/v1/full_configuration.json"), v1::OutputFormat::Json);
+  EXPECT_EQ(json.front(), '{');
+  EXPECT_NE(json.find("\"version\": \"1.0.0\""), std::string::npos);
+  EXPECT_NE(json.find("\"type\": \"ARRHENIUS\""), std::string::npos);
+  auto node = YAML::Load(json);
+  EXPECT_TRUE(node.IsMap());
+  EXPECT_EQ(node["reactions"].size(), 16);
+}
+
+TEST(Serializer, FormatsCppNumbers)
+{
+  EXPECT_EQ(v1::FormatCppNumber(2.0), "2.0");
+  EXPECT_EQ(v1::FormatCppNumber(0.1), "0.1");
+  EXPECT_EQ(v1::FormatCppNumber(-7.409558837908838e+24), "-7.409558837908838e+24");
+  EXPECT_EQ(v1::FormatCppNumber(std::numeric_limits<double>::infinity()), "std::numeric_limits<double>::infinity()");
+  EXPECT_EQ(v1::FormatCppNumber(-std::numeric_limits<double>::infinity()), "-std::numeric_limits<double>::infinity()");
+  EXPECT_EQ(v1::FormatCppNumber(std::numeric_limits<double>::quiet_NaN()), "std::numeric_limits<double>::quiet_NaN()");
+}
@@ -0,0 +1,57 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Loads the configuration given to the code generators, mechanism_embed and mechanism_rate_kernel
+
+#pragma once
+
+#include <mechanism_configuration/v0/conversion.hpp>
+#include <mechanism_configuration/v0/parser.hpp>
+#include <mechanism_configuration/v1/parser.hpp>
+
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace mechanism_tools
+{
+  /// @brief Parses a version 1 configuration, or a version 0 configuration converted to version 1
+  ///
+  /// Parse errors and conversion warnings are printed to stderr. As in mechanism_convert, a conversion that
+  /// changes the rate of any reaction is refused unless allow_approximate is set.
+  /// @param allow_approximate Whether to accept a conversion that changes the rate of any reaction
+  inline std::optional<mechanism_configuration::v1::types::Mechanism> LoadMechanism(const std::filesystem::path& config, bool allow_approximate)
+  {
+    namespace mc = mechanism_configuration;
+    auto parsed = mc::v1::Parser{}.Parse(config);
+    if (parsed)
+    {
+      return std::move(*parsed.mechanism);
+    }
+    auto v0 = mc::v0::Parser{}.Parse(config);
+    if (v0)
+    {
+      std::vector<mc::v0::ConversionWarning> warnings;
+      auto converted = mc::v0::ConvertToV1(*v0.mechanism, warnings);
+      for (const auto& warning : warnings)
+      {
+        std::cerr << config.string() << ": " << warning.to_string() << std::endl;
+      }
+      if (!warnings.empty() && !allow_approximate)
+      {
+        std::cerr << config.string() << ": error: converting would change the rates of " << warnings.size()
+                  << (warnings.size() == 1 ? " reaction" : " reactions") << "; use --allow-approximate to convert anyway" << std::endl;
+        return std::nullopt;
+      }
+      return converted;
+    }
+    for (const auto& error : parsed.errors)
+    {
+      std::cerr << error.to_string() << std::endl;
+    }
+    return std::nullopt;
+  }
+}  // namespace mechanism_tools
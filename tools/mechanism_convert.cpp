@@ -0,0 +1,210 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Converts version 0 (CAMP) configurations to version 1 mechanism files
+//
+//   mechanism_convert [--format json|yaml] [--jobs N] [--allow-approximate] <input> <output>
+//
+// If the input is a file, it is converted to the output file. If the input is a directory, every directory
+// below it that holds a config.json or config.yaml is converted, in parallel, to
+// <output>/<relative directory>/mechanism.<format>.
+//
+// Some version 0 reactions have no exact version 1 counterpart, and converting them changes their rates. Each is
+// printed as a warning, and a configuration with any of them is not converted unless --allow-approximate is
+// given.
+
+#include <mechanism_configuration/parser.hpp>
+#include <mechanism_configuration/v0/conversion.hpp>
+#include <mechanism_configuration/v0/parser.hpp>
+#include <mechanism_configuration/v1/serializer.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+  namespace fs = std::filesystem;
+  namespace mc = mechanism_configuration;
+
+  int Usage()
+  {
+    std::cerr << "usage: mechanism_convert [--format json|yaml] [--jobs N] [--allow-approximate] <input> <output>" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  /// @brief Reads a whole, non-negative number
+  std::optional<std::size_t> ParseCount(const std::string& value)
+  {
+    std::size_t count = 0;
+    auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), count);
+    if (error != std::errc() || end != value.data() + value.size())
+    {
+      return std::nullopt;
+    }
+    return count;
+  }
+
+  bool HasConfig(const fs::path& directory)
+  {
+    return fs::exists(directory / "config.json") || fs::exists(directory / "config.yaml");
+  }
+
+  /// @brief Finds every directory at or below root that holds a version 0 configuration
+  std::vector<fs::path> FindConfigurations(const fs::path& root)
+  {
+    std::vector<fs::path> configurations;
+    if (HasConfig(root))
+    {
+      configurations.push_back(root);
+    }
+    for (const auto& entry : fs::recursive_directory_iterator(root, fs::directory_options::skip_permission_denied))
+    {
+      if (entry.is_directory() && HasConfig(entry.path()))
+      {
+        configurations.push_back(entry.path());
+      }
+    }
+    std::sort(configurations.begin(), configurations.end());
+    return configurations;
+  }
+
+  bool Convert(
+      const mc::ParserResult<mc::v0::types::Mechanism>& parsed,
+      const fs::path& input,
+      const fs::path& output,
+      mc::v1::OutputFormat format,
+      bool allow_approximate)
+  {
+    if (!parsed)
+    {
+      for (const auto& error : parsed.errors)
+      {
+        std::cerr << error.to_string() << std::endl;
+      }
+      return false;
+    }
+    std::vector<mc::v0::ConversionWarning> warnings;
+    auto mechanism = mc::v0::ConvertToV1(*parsed.mechanism, warnings);
+    for (const auto& warning : warnings)
+    {
+      std::cerr << input.string() << ": " << warning.to_string() << std::endl;
+    }
+    if (!warnings.empty() && !allow_approximate)
+    {
+      std::cerr << input.string() << ": error: converting would change the rates of " << warnings.size()
+                << (warnings.size() == 1 ? " reaction" : " reactions") << "; use --allow-approximate to convert anyway" << std::endl;
+      return false;
+    }
+    try
+    {
+      if (output.has_parent_path())
+      {
+        fs::create_directories(output.parent_path());
+      }
+      std::ofstream stream(output);
+      mc::v1::WriteMechanism(mechanism, stream, format);
+      if (!stream)
+      {
+        throw std::runtime_error("Unable to write " + output.string());
+      }
+    }
+    catch (const std::exception& e)
+    {
+      std::cerr << e.what() << std::endl;
+      return false;
+    }
+    return true;
+  }
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  std::vector<std::string> positional;
+  std::optional<mc::v1::OutputFormat> format;
+  std::size_t jobs = 0;
+  bool allow_approximate = false;
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+    if (arg == "--format" && i + 1 < argc)
+    {
+      std::string value = argv[++i];
+      if (value == "json")
+        format = mc::v1::OutputFormat::Json;
+      else if (value == "yaml")
+        format = mc::v1::OutputFormat::Yaml;
+      else
+        return Usage();
+    }
+    else if (arg == "--jobs" && i + 1 < argc)
+    {
+      auto count = ParseCount(argv[++i]);
+      if (!count)
+        return Usage();
+      jobs = *count;
+    }
+    else if (arg == "--allow-approximate")
+    {
+      allow_approximate = true;
+    }
+    else if (arg.starts_with("--"))
+    {
+      return Usage();
+    }
+    else
+    {
+      positional.push_back(arg);
+    }
+  }
+  if (positional.size() != 2)
+  {
+    return Usage();
+  }
+  fs::path input = positional[0];
+  fs::path output = positional[1];
+
+  if (!fs::is_directory(input))
+  {
+    if (!format)
+    {
+      format = output.extension() == ".json" ? mc::v1::OutputFormat::Json : mc::v1::OutputFormat::Yaml;
+    }
+    return Convert(mc::v0::Parser{}.Parse(input), input, output, *format, allow_approximate) ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  if (!format)
+  {
+    format = mc::v1::OutputFormat::Yaml;
+  }
+  const std::string file_name = *format == mc::v1::OutputFormat::Json ? "mechanism.json" : "mechanism.yaml";
+
+  auto configurations = FindConfigurations(input);
+  if (configurations.empty())
+  {
+    std::cerr << "No version 0 configurations found in " << input.string() << std::endl;
+    return EXIT_FAILURE;
+  }
+  auto results = mc::ParseConcurrently<mc::v0::Parser>(configurations, jobs);
+
+  std::size_t failures = 0;
+  for (std::size_t i = 0; i < configurations.size(); ++i)
+  {
+    fs::path destination = output / fs::relative(configurations[i], input) / file_name;
+    if (!Convert(results[i], configurations[i], destination.lexically_normal(), *format, allow_approximate))
+    {
+      ++failures;
+      std::cerr << "Failed to convert " << configurations[i].string() << std::endl;
+    }
+  }
+  std::cout << "Converted " << configurations.size() - failures << " of " << configurations.size() << " configurations" << std::endl;
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,457 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Embeds a mechanism configuration in a C++ header
+//
+//   mechanism_embed [--namespace NAME] [--allow-approximate] <config> <output.hpp>
+//
+// The configuration is parsed once, at build time, and written out as static data: constexpr tables of the
+// species and phase names and of every reaction's rate parameters, and a Mechanism() function that returns a
+// v1::types::Mechanism built from them on first use. The header includes only v1/types.hpp, so programs that
+// use it neither parse the configuration at startup nor need yaml-cpp at run time. A version 0 configuration
+// is converted to version 1 first. As in mechanism_convert, a configuration whose conversion changes the rate
+// of any reaction is refused unless --allow-approximate is given. Most builds call this through the
+// mechanism_configuration_embed() CMake function rather than directly.
+
+#include <mechanism_configuration/v1/reaction_descriptors.hpp>
+#include <mechanism_configuration/v1/serializer.hpp>
+
+#include "load_mechanism.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  namespace fs = std::filesystem;
+  namespace mc = mechanism_configuration;
+  namespace types = mc::v1::types;
+  namespace descriptors = mc::v1::descriptors;
+
+  /// @brief The C++ name of each reaction type and its member of types::Reactions, in ReactionType order
+  struct ReactionNames
+  {
+    const char* type;
+    const char* list;
+  };
+
+  constexpr ReactionNames reaction_names[] = {
+    { "Arrhenius", "arrhenius" },
+    { "Branched", "branched" },
+    { "CondensedPhaseArrhenius", "condensed_phase_arrhenius" },
+    { "CondensedPhasePhotolysis", "condensed_phase_photolysis" },
+    { "Emission", "emission" },
+    { "FirstOrderLoss", "first_order_loss" },
+    { "SimpolPhaseTransfer", "simpol_phase_transfer" },
+    { "AqueousEquilibrium", "aqueous_equilibrium" },
+    { "WetDeposition", "wet_deposition" },
+    { "HenrysLaw", "henrys_law" },
+    { "Photolysis", "photolysis" },
+    { "Surface", "surface" },
+    { "Troe", "troe" },
+    { "Tunneling", "tunneling" },
+  };
+  static_assert(std::size(reaction_names) == types::NumberOfReactionLists());
+  static_assert(std::string_view(reaction_names[static_cast<int>(types::ReactionType::Arrhenius)].type) == "Arrhenius");
+  static_assert(std::string_view(reaction_names[static_cast<int>(types::ReactionType::Tunneling)].type) == "Tunneling");
+
+  int Usage()
+  {
+    std::cerr << "usage: mechanism_embed [--namespace NAME] [--allow-approximate] <config> <output.hpp>" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  bool IsIdentifier(const std::string& name)
+  {
+    if (name.empty() || std::isdigit(static_cast<unsigned char>(name.front())))
+    {
+      return false;
+    }
+    return std::all_of(
+        name.begin(), name.end(), [](char c) { return c == '_' || c == ':' || std::isalnum(static_cast<unsigned char>(c)); });
+  }
+
+  /// @brief A C++ string literal holding value. Characters outside printable ASCII are written as octal escapes,
+  ///        which never run into the character that follows.
+  std::string Literal(const std::string& value)
+  {
+    std::string literal = "\"";
+    for (unsigned char c : value)
+    {
+      if (c == '"' || c == '\\')
+      {
+        literal += '\\';
+        literal += static_cast<char>(c);
+      }
+      else if (c < 0x20 || c >= 0x7f)
+      {
+        char escape[5];
+        std::snprintf(escape, sizeof(escape), "\\%03o", c);
+        literal += escape;
+      }
+      else
+      {
+        literal += static_cast<char>(c);
+      }
+    }
+    return literal + "\"";
+  }
+
+  std::string Number(double value)
+  {
+    return mc::v1::FormatCppNumber(value);
+  }
+
+  std::string Number(int value)
+  {
+    return std::to_string(value);
+  }
+
+  /// @brief An initializer for a map of unknown properties, in key order so the output does not depend on hashing
+  std::string Properties(const std::unordered_map<std::string, std::string>& properties)
+  {
+    std::vector<std::pair<std::string, std::string>> sorted(properties.begin(), properties.end());
+    std::sort(sorted.begin(), sorted.end());
+    std::string initializer = "{";
+    for (std::size_t i = 0; i < sorted.size(); ++i)
+    {
+      initializer += (i == 0 ? " { " : ", { ") + Literal(sorted[i].first) + ", " + Literal(sorted[i].second) + " }";
+    }
+    return initializer + (sorted.empty() ? "}" : " }");
+  }
+
+  std::string Component(const types::ReactionComponent& component)
+  {
+    return "{ " + Literal(component.species_name) + ", " + Number(component.coefficient) + ", " + Properties(component.unknown_properties) +
+           " }";
+  }
+
+  class HeaderWriter
+  {
+   public:
+    HeaderWriter(std::ostream& out, std::string name_space)
+        : out_(out),
+          namespace_(std::move(name_space))
+    {
+    }
+
+    void Write(const types::Mechanism& mechanism, const fs::path& source)
+    {
+      out_ << "// Generated by mechanism_embed from " << source.filename().string() << ". Do not edit.\n";
+      out_ << "\n#pragma once\n\n";
+      out_ << "#include <mechanism_configuration/v1/types.hpp>\n\n";
+      out_ << "#include <array>\n#include <limits>\n#include <string_view>\n\n";
+      out_ << "namespace " << namespace_ << "\n{\n";
+      WriteTables(mechanism);
+      WriteMechanism(mechanism);
+      out_ << "}  // namespace " << namespace_ << "\n";
+    }
+
+   private:
+    void WriteTables(const types::Mechanism& mechanism)
+    {
+      out_ << "  inline constexpr std::string_view name = " << Literal(mechanism.name) << ";\n\n";
+
+      out_ << "  inline constexpr std::array<std::string_view, " << mechanism.species.size() << "> species_names = {";
+      for (std::size_t i = 0; i < mechanism.species.size(); ++i)
+      {
+        out_ << (i == 0 ? " " : ", ") << Literal(mechanism.species[i].name);
+      }
+      out_ << (mechanism.species.empty() ? "};\n\n" : " };\n\n");
+
+      out_ << "  inline constexpr std::array<std::string_view, " << mechanism.phases.size() << "> phase_names = {";
+      for (std::size_t i = 0; i < mechanism.phases.size(); ++i)
+      {
+        out_ << (i == 0 ? " " : ", ") << Literal(mechanism.phases[i].name);
+      }
+      out_ << (mechanism.phases.empty() ? "};\n" : " };\n");
+
+      types::ForEachReactionList(
+          mechanism.reactions,
+          [this](types::ReactionType type, const auto& list)
+          {
+            using R = typename std::decay_t<decltype(list)>::value_type;
+            if (!list.empty() && HasParameters<R>())
+            {
+              WriteParameterTable(reaction_names[static_cast<int>(type)], list);
+            }
+          });
+      out_ << "\n";
+    }
+
+    template<typename R>
+    static constexpr bool HasParameters()
+    {
+      bool any = false;
+      mc::v1::ForEachField(
+          mc::v1::ReactionDescriptor<R>::fields,
+          [&any](const auto& field)
+          {
+            constexpr auto kind = std::decay_t<decltype(field)>::kind;
+            any = any || kind == descriptors::FieldKind::Number || kind == descriptors::FieldKind::NumberList;
+          });
+      return any;
+    }
+
+    /// @brief Writes a struct of the type's rate parameters and a constexpr table with one entry per reaction
+    template<typename R>
+    void WriteParameterTable(const ReactionNames& names, const std::vector<R>& list)
+    {
+      const auto& fields = mc::v1::ReactionDescriptor<R>::fields;
+      out_ << "\n  struct " << names.type << "Parameters\n  {\n";
+      mc::v1::ForEachField(
+          fields,
+          [&](const auto& field)
+          {
+            constexpr auto kind = std::decay_t<decltype(field)>::kind;
+            if constexpr (kind == descriptors::FieldKind::Number || kind == descriptors::FieldKind::NumberList)
+            {
+              out_ << "    decltype(mechanism_configuration::v1::types::" << names.type << "::" << field.attribute << ") " << field.attribute
+                   << ";\n";
+            }
+          });
+      out_ << "  };\n\n";
+
+      out_ << "  inline constexpr std::array<" << names.type << "Parameters, " << list.size() << "> " << names.list << "_parameters = { {\n";
+      for (const auto& reaction : list)
+      {
+        out_ << "    {";
+        bool first = true;
+        mc::v1::ForEachField(
+            fields,
+            [&](const auto& field)
+            {
+              constexpr auto kind = std::decay_t<decltype(field)>::kind;
+              if constexpr (kind == descriptors::FieldKind::Number)
+              {
+                out_ << (first ? " " : ", ") << Number(reaction.*field.member);
+                first = false;
+              }
+              else if constexpr (kind == descriptors::FieldKind::NumberList)
+              {
+                out_ << (first ? " {" : ", {");
+                const auto& values = reaction.*field.member;
+                for (std::size_t i = 0; i < values.size(); ++i)
+                {
+                  out_ << (i == 0 ? " " : ", ") << Number(values[i]);
+                }
+                out_ << " }";
+                first = false;
+              }
+            });
+        out_ << " },\n";
+      }
+      out_ << "  } };\n";
+    }
+
+    void WriteMechanism(const types::Mechanism& mechanism)
+    {
+      out_ << "  /// @brief The embedded mechanism, built from the tables above on first use\n";
+      out_ << "  inline const mechanism_configuration::v1::types::Mechanism& Mechanism()\n  {\n";
+      out_ << "    static const mechanism_configuration::v1::types::Mechanism mechanism = []()\n    {\n";
+      out_ << "      namespace types = mechanism_configuration::v1::types;\n";
+      out_ << "      types::Mechanism m;\n";
+      out_ << "      m.name = std::string(name);\n";
+      out_ << "      m.version = mechanism_configuration::Version(" << mechanism.version.major << ", " << mechanism.version.minor << ", "
+           << mechanism.version.patch << ");\n";
+
+      out_ << "      m.species.resize(species_names.size());\n";
+      for (std::size_t i = 0; i < mechanism.species.size(); ++i)
+      {
+        WriteSpecies(i, mechanism.species[i]);
+      }
+      out_ << "      m.phases.resize(phase_names.size());\n";
+      for (std::size_t i = 0; i < mechanism.phases.size(); ++i)
+      {
+        const auto& phase = mechanism.phases[i];
+        out_ << "      m.phases[" << i << "].name = std::string(phase_names[" << i << "]);\n";
+        out_ << "      m.phases[" << i << "].species = {";
+        for (std::size_t j = 0; j < phase.species.size(); ++j)
+        {
+          out_ << (j == 0 ? " " : ", ") << Literal(phase.species[j]);
+        }
+        out_ << (phase.species.empty() ? "};\n" : " };\n");
+        if (!phase.unknown_properties.empty())
+        {
+          out_ << "      m.phases[" << i << "].unknown_properties = " << Properties(phase.unknown_properties) << ";\n";
+        }
+      }
+
+      types::ForEachReactionList(
+          mechanism.reactions,
+          [this](types::ReactionType type, const auto& list)
+          {
+            for (std::size_t i = 0; i < list.size(); ++i)
+            {
+              WriteReaction(reaction_names[static_cast<int>(type)], i, list[i]);
+            }
+          });
+      out_ << "      return m;\n    }();\n    return mechanism;\n  }\n";
+    }
+
+    void WriteSpecies(std::size_t i, const types::Species& species)
+    {
+      const std::string target = "      m.species[" + std::to_string(i) + "].";
+      out_ << target << "name = std::string(species_names[" << i << "]);\n";
+      auto optional = [&](const char* member, const std::optional<double>& value)
+      {
+        if (value)
+        {
+          out_ << target << member << " = " << Number(*value) << ";\n";
+        }
+      };
+      optional("absolute_tolerance", species.absolute_tolerance);
+      optional("diffusion_coefficient", species.diffusion_coefficient);
+      optional("molecular_weight", species.molecular_weight);
+      optional("henrys_law_constant_298", species.henrys_law_constant_298);
+      optional("henrys_law_constant_exponential_factor", species.henrys_law_constant_exponential_factor);
+      optional("n_star", species.n_star);
+      optional("density", species.density);
+      if (species.tracer_type)
+      {
+        out_ << target << "tracer_type = " << Literal(*species.tracer_type) << ";\n";
+      }
+      if (!species.unknown_properties.empty())
+      {
+        out_ << target << "unknown_properties = " << Properties(species.unknown_properties) << ";\n";
+      }
+    }
+
+    /// @brief Writes a block that builds one reaction, taking its rate parameters from the type's table
+    template<typename R>
+    void WriteReaction(const ReactionNames& names, std::size_t i, const R& reaction)
+    {
+      out_ << "      {\n        types::" << names.type << " r;\n";
+      mc::v1::ForEachField(
+          mc::v1::ReactionDescriptor<R>::fields,
+          [&](const auto& field)
+          {
+            constexpr auto kind = std::decay_t<decltype(field)>::kind;
+            if constexpr (kind == descriptors::FieldKind::Number || kind == descriptors::FieldKind::NumberList)
+            {
+              out_ << "        r." << field.attribute << " = " << names.list << "_parameters[" << i << "]." << field.attribute << ";\n";
+            }
+            else if constexpr (kind == descriptors::FieldKind::Components)
+            {
+              const auto& components = reaction.*field.member;
+              out_ << "        r." << field.attribute << " = {";
+              for (std::size_t j = 0; j < components.size(); ++j)
+              {
+                out_ << (j == 0 ? " " : ", ") << Component(components[j]);
+              }
+              out_ << (components.empty() ? "};\n" : " };\n");
+            }
+            else if constexpr (kind == descriptors::FieldKind::Species)
+            {
+              const auto& species = reaction.*field.member;
+              if constexpr (std::is_same_v<std::decay_t<decltype(species)>, std::string>)
+              {
+                out_ << "        r." << field.attribute << " = " << Literal(species) << ";\n";
+              }
+              else
+              {
+                out_ << "        r." << field.attribute << " = types::ReactionComponent" << Component(species) << ";\n";
+              }
+            }
+            else if constexpr (kind == descriptors::FieldKind::Phase)
+            {
+              out_ << "        r." << field.attribute << " = " << Literal(reaction.*field.member) << ";\n";
+            }
+          });
+      // AqueousEquilibrium keeps a gas phase that its configuration does not describe
+      if constexpr (std::is_same_v<R, types::AqueousEquilibrium>)
+      {
+        if (!reaction.gas_phase.empty())
+        {
+          out_ << "        r.gas_phase = " << Literal(reaction.gas_phase) << ";\n";
+        }
+      }
+      if (!reaction.name.empty())
+      {
+        out_ << "        r.name = " << Literal(reaction.name) << ";\n";
+      }
+      if (!reaction.unknown_properties.empty())
+      {
+        out_ << "        r.unknown_properties = " << Properties(reaction.unknown_properties) << ";\n";
+      }
+      out_ << "        m.reactions." << names.list << ".push_back(std::move(r));\n      }\n";
+    }
+
+    std::ostream& out_;
+    std::string namespace_;
+  };
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  std::vector<std::string> positional;
+  std::string name_space = "embedded_mechanism";
+  bool allow_approximate = false;
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+    if (arg == "--namespace" && i + 1 < argc)
+    {
+      name_space = argv[++i];
+      if (!IsIdentifier(name_space))
+      {
+        return Usage();
+      }
+    }
+    else if (arg == "--allow-approximate")
+    {
+      allow_approximate = true;
+    }
+    else if (arg.starts_with("--"))
+    {
+      return Usage();
+    }
+    else
+    {
+      positional.push_back(arg);
+    }
+  }
+  if (positional.size() != 2)
+  {
+    return Usage();
+  }
+  fs::path input = positional[0];
+  fs::path output = positional[1];
+
+  auto mechanism = mechanism_tools::LoadMechanism(input, allow_approximate);
+  if (!mechanism)
+  {
+    std::cerr << "Failed to load " << input.string() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Write to a string first so a failed run never leaves a partial header behind for the build to pick up
+  std::ostringstream header;
+  HeaderWriter(header, name_space).Write(*mechanism, input);
+  if (output.has_parent_path())
+  {
+    fs::create_directories(output.parent_path());
+  }
+  std::ofstream stream(output);
+  stream << header.str();
+  if (!stream)
+  {
+    std::cerr << "Unable to write " << output.string() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
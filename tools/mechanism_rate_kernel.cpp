@@ -0,0 +1,88 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Writes a rate kernel specialized to one mechanism
+//
+//   mechanism_rate_kernel [--allow-approximate] <config> <output.cpp>
+//
+// The kernel is C++ source with C entry points for the mechanism's rate constants and species tendencies, as
+// described by v1::WriteRateKernel. Build it as a shared library and load it with v1::RateKernelPlugin. Most
+// builds call this through the mechanism_configuration_rate_kernel() CMake function rather than directly. A
+// version 0 configuration is converted to version 1 first. As in mechanism_convert, a configuration whose
+// conversion changes the rate of any reaction is refused unless --allow-approximate is given.
+
+#include <mechanism_configuration/v1/rate_kernel.hpp>
+
+#include "load_mechanism.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+  namespace fs = std::filesystem;
+  namespace mc = mechanism_configuration;
+
+  int Usage()
+  {
+    std::cerr << "usage: mechanism_rate_kernel [--allow-approximate] <config> <output.cpp>" << std::endl;
+    return EXIT_FAILURE;
+  }
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  std::vector<std::string> positional;
+  bool allow_approximate = false;
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+    if (arg == "--allow-approximate")
+    {
+      allow_approximate = true;
+    }
+    else if (arg.starts_with("--"))
+    {
+      return Usage();
+    }
+    else
+    {
+      positional.push_back(arg);
+    }
+  }
+  if (positional.size() != 2)
+  {
+    return Usage();
+  }
+  fs::path input = positional[0];
+  fs::path output = positional[1];
+
+  auto mechanism = mechanism_tools::LoadMechanism(input, allow_approximate);
+  if (!mechanism)
+  {
+    std::cerr << "Failed to load " << input.string() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Write to a string first so a failed run never leaves a partial source file behind for the build to pick up
+  std::ostringstream source;
+  mc::v1::WriteRateKernel(*mechanism, source);
+  if (output.has_parent_path())
+  {
+    fs::create_directories(output.parent_path());
+  }
+  std::ofstream stream(output);
+  stream << source.str();
+  if (!stream)
+  {
+    std::cerr << "Unable to write " << output.string() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,348 @@
+// Copyright (C) 2023-2024 National Center for Atmospheric Research, University of Illinois at Urbana-Champaign
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Validates mechanism configurations of any version
+//
+//   mechanism_validate [--format text|json|sarif] [--jobs N] <path>...
+//
+// Each path is a configuration file or a directory. Directories are searched recursively. A directory holding a
+// config.json or config.yaml is a single configuration, which may be a version 0 configuration that refers to
+// other files, so nothing else below it is validated on its own. Elsewhere, every .json, .yaml and .yml file is
+// a configuration. Configurations are validated in parallel and the exit status is nonzero if any is invalid.
+
+#include <mechanism_configuration/parser.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  namespace fs = std::filesystem;
+  namespace mc = mechanism_configuration;
+
+  enum class ReportFormat
+  {
+    Text,
+    Json,
+    Sarif
+  };
+
+  /// @brief The outcome of validating one configuration
+  struct Validation
+  {
+    bool valid{ false };
+    std::string version;
+    double seconds{ 0 };
+    mc::Errors errors;
+  };
+
+  /// @brief Validates with UniversalParser and keeps only what the report needs, so parsed mechanisms are
+  ///        released as soon as each configuration is done
+  class ValidatingParser
+  {
+   public:
+    Validation Parse(const fs::path& config_path)
+    {
+      auto start = std::chrono::steady_clock::now();
+      auto result = parser_.Parse(config_path);
+      Validation validation;
+      validation.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      validation.valid = static_cast<bool>(result);
+      if (result.mechanism)
+      {
+        validation.version = result.mechanism->version.to_string();
+      }
+      validation.errors = std::move(result.errors);
+      return validation;
+    }
+
+   private:
+    mc::UniversalParser parser_;
+  };
+
+  int Usage()
+  {
+    std::cerr << "usage: mechanism_validate [--format text|json|sarif] [--jobs N] <path>..." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  /// @brief Reads a whole, non-negative number
+  std::optional<std::size_t> ParseCount(const std::string& value)
+  {
+    std::size_t count = 0;
+    auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), count);
+    if (error != std::errc() || end != value.data() + value.size())
+    {
+      return std::nullopt;
+    }
+    return count;
+  }
+
+  bool IsConfigurationFile(const fs::path& path)
+  {
+    auto extension = path.extension();
+    return extension == ".json" || extension == ".yaml" || extension == ".yml";
+  }
+
+  std::optional<fs::path> DefaultConfiguration(const fs::path& directory)
+  {
+    for (const char* name : { "config.yaml", "config.json" })
+    {
+      if (fs::is_regular_file(directory / name))
+      {
+        return directory / name;
+      }
+    }
+    return std::nullopt;
+  }
+
+  void FindConfigurations(const fs::path& root, std::vector<fs::path>& configurations)
+  {
+    if (!fs::is_directory(root))
+    {
+      configurations.push_back(root);
+      return;
+    }
+    if (auto config = DefaultConfiguration(root))
+    {
+      configurations.push_back(*config);
+      return;
+    }
+    std::vector<fs::path> entries;
+    for (const auto& entry : fs::directory_iterator(root, fs::directory_options::skip_permission_denied))
+    {
+      entries.push_back(entry.path());
+    }
+    std::sort(entries.begin(), entries.end());
+    for (const auto& entry : entries)
+    {
+      if (fs::is_directory(entry))
+      {
+        FindConfigurations(entry, configurations);
+      }
+      else if (IsConfigurationFile(entry))
+      {
+        configurations.push_back(entry);
+      }
+    }
+  }
+
+  std::string EscapeJson(const std::string& value)
+  {
+    std::string escaped;
+    escaped.reserve(value.size() + 2);
+    escaped += '"';
+    for (char c : value)
+    {
+      switch (c)
+      {
+        case '"': escaped += "\\\""; break;
+        case '\\': escaped += "\\\\"; break;
+        case '\n': escaped += "\\n"; break;
+        case '\r': escaped += "\\r"; break;
+        case '\t': escaped += "\\t"; break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20)
+          {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+            escaped += buffer;
+          }
+          else
+          {
+            escaped += c;
+          }
+      }
+    }
+    escaped += '"';
+    return escaped;
+  }
+
+  /// @brief The error description without its location
+  std::string Message(const mc::ParseError& error)
+  {
+    std::string message = mc::configParseStatusToString(error.status);
+    if (!error.detail.empty())
+    {
+      message += ": " + error.detail;
+    }
+    if (!error.key.empty())
+    {
+      message += " [" + error.key + "]";
+    }
+    return message;
+  }
+
+  /// @brief The file an error was found in, which for version 0 configurations may be a referenced file
+  std::string ErrorFile(const mc::ParseError& error, const fs::path& configuration)
+  {
+    return error.file ? error.file->generic_string() : configuration.generic_string();
+  }
+
+  void WriteText(const std::vector<fs::path>& configurations, const std::vector<Validation>& validations, double seconds)
+  {
+    std::size_t invalid = 0;
+    for (std::size_t i = 0; i < configurations.size(); ++i)
+    {
+      const auto& validation = validations[i];
+      invalid += validation.valid ? 0 : 1;
+      std::cout << (validation.valid ? "ok      " : "invalid ") << configurations[i].generic_string() << " ("
+                << validation.seconds * 1000.0 << " ms)" << std::endl;
+      for (const auto& error : validation.errors)
+      {
+        std::cout << "  " << error.to_string() << std::endl;
+      }
+    }
+    std::cout << configurations.size() - invalid << " of " << configurations.size() << " configurations are valid ("
+              << seconds << " s)" << std::endl;
+  }
+
+  void WriteJson(const std::vector<fs::path>& configurations, const std::vector<Validation>& validations, double seconds)
+  {
+    std::size_t invalid = 0;
+    std::cout << "{\n  \"files\": [";
+    for (std::size_t i = 0; i < configurations.size(); ++i)
+    {
+      const auto& validation = validations[i];
+      invalid += validation.valid ? 0 : 1;
+      std::cout << (i == 0 ? "\n" : ",\n") << "    {\"path\": " << EscapeJson(configurations[i].generic_string())
+                << ", \"valid\": " << (validation.valid ? "true" : "false");
+      if (!validation.version.empty())
+      {
+        std::cout << ", \"version\": " << EscapeJson(validation.version);
+      }
+      std::cout << ", \"seconds\": " << validation.seconds << ", \"errors\": [";
+      for (std::size_t j = 0; j < validation.errors.size(); ++j)
+      {
+        const auto& error = validation.errors[j];
+        std::cout << (j == 0 ? "\n" : ",\n") << "      {\"status\": " << EscapeJson(mc::configParseStatusToString(error.status))
+                  << ", \"file\": " << EscapeJson(ErrorFile(error, configurations[i])) << ", \"line\": " << error.line
+                  << ", \"column\": " << error.column << ", \"key\": " << EscapeJson(error.key)
+                  << ", \"message\": " << EscapeJson(Message(error)) << "}";
+      }
+      std::cout << (validation.errors.empty() ? "]}" : "\n    ]}");
+    }
+    std::cout << (configurations.empty() ? "]" : "\n  ]") << ",\n  \"summary\": {\"files\": " << configurations.size()
+              << ", \"invalid\": " << invalid << ", \"seconds\": " << seconds << "}\n}" << std::endl;
+  }
+
+  /// @brief Writes a SARIF 2.1.0 log. Each parse status is a rule, and per-file timing is kept in the run's
+  ///        property bag.
+  void WriteSarif(const std::vector<fs::path>& configurations, const std::vector<Validation>& validations, double seconds)
+  {
+    std::vector<std::string> rules;
+    for (const auto& validation : validations)
+    {
+      for (const auto& error : validation.errors)
+      {
+        rules.push_back(mc::configParseStatusToString(error.status));
+      }
+    }
+    std::sort(rules.begin(), rules.end());
+    rules.erase(std::unique(rules.begin(), rules.end()), rules.end());
+
+    std::cout << "{\n  \"$schema\": \"https://json.schemastore.org/sarif-2.1.0.json\",\n  \"version\": \"2.1.0\",\n"
+              << "  \"runs\": [{\n    \"tool\": {\"driver\": {\"name\": \"mechanism_validate\", \"rules\": [";
+    for (std::size_t i = 0; i < rules.size(); ++i)
+    {
+      std::cout << (i == 0 ? "" : ", ") << "{\"id\": " << EscapeJson(rules[i]) << "}";
+    }
+    std::cout << "]}},\n    \"results\": [";
+    bool first = true;
+    for (std::size_t i = 0; i < configurations.size(); ++i)
+    {
+      for (const auto& error : validations[i].errors)
+      {
+        std::cout << (first ? "\n" : ",\n") << "      {\"ruleId\": " << EscapeJson(mc::configParseStatusToString(error.status))
+                  << ", \"level\": \"error\", \"message\": {\"text\": " << EscapeJson(Message(error)) << "}, "
+                  << "\"locations\": [{\"physicalLocation\": {\"artifactLocation\": {\"uri\": "
+                  << EscapeJson(ErrorFile(error, configurations[i])) << "}";
+        if (error.line > 0)
+        {
+          std::cout << ", \"region\": {\"startLine\": " << error.line << ", \"startColumn\": " << std::max(error.column, 1) << "}";
+        }
+        std::cout << "}}]}";
+        first = false;
+      }
+    }
+    std::cout << (first ? "]" : "\n    ]") << ",\n    \"properties\": {\"seconds\": " << seconds << ", \"files\": [";
+    for (std::size_t i = 0; i < configurations.size(); ++i)
+    {
+      std::cout << (i == 0 ? "\n" : ",\n") << "      {\"uri\": " << EscapeJson(configurations[i].generic_string())
+                << ", \"valid\": " << (validations[i].valid ? "true" : "false") << ", \"seconds\": " << validations[i].seconds << "}";
+    }
+    std::cout << (configurations.empty() ? "]}" : "\n    ]}") << "\n  }]\n}" << std::endl;
+  }
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  ReportFormat format = ReportFormat::Text;
+  std::size_t jobs = 0;
+  std::vector<fs::path> roots;
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string arg = argv[i];
+    if (arg == "--format" && i + 1 < argc)
+    {
+      std::string value = argv[++i];
+      if (value == "text")
+        format = ReportFormat::Text;
+      else if (value == "json")
+        format = ReportFormat::Json;
+      else if (value == "sarif")
+        format = ReportFormat::Sarif;
+      else
+        return Usage();
+    }
+    else if (arg == "--jobs" && i + 1 < argc)
+    {
+      auto count = ParseCount(argv[++i]);
+      if (!count)
+        return Usage();
+      jobs = *count;
+    }
+    else if (arg.starts_with("--"))
+    {
+      return Usage();
+    }
+    else
+    {
+      roots.push_back(arg);
+    }
+  }
+  if (roots.empty())
+  {
+    return Usage();
+  }
+
+  std::vector<fs::path> configurations;
+  for (const auto& root : roots)
+  {
+    FindConfigurations(root, configurations);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  auto validations = mc::ParseConcurrently<ValidatingParser>(configurations, jobs);
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  switch (format)
+  {
+    case ReportFormat::Text: WriteText(configurations, validations, seconds); break;
+    case ReportFormat::Json: WriteJson(configurations, validations, seconds); break;
+    case ReportFormat::Sarif: WriteSarif(configurations, validations, seconds); break;
+  }
+
+  bool all_valid = std::all_of(validations.begin(), validations.end(), [](const Validation& v) { return v.valid; });
+  return all_valid ? EXIT_SUCCESS : EXIT_FAILURE;
+}